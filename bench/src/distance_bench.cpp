@@ -0,0 +1,40 @@
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "distance.hpp"
+
+using oocdda::trig_dist;
+
+namespace {
+/// How trig_dist() was worked out before it used a table.
+auto old_trig_dist(const int x1, const int y1, const int x2, const int y2) -> int
+{
+    return int(std::sqrt(std::pow(x1 - x2, 2) + std::pow(y1 - y2, 2)));
+}
+
+/// Every monster on the 3x3 submap window against the player, as Game::sound used to do.
+template<auto Dist>
+void BM_TrigDist(benchmark::State& state)
+{
+    constexpr int window {36};
+    const int px {static_cast<int>(state.range(0))};
+
+    for (auto _ : state) {
+        int sum {0};
+
+        for (int y {-window}; y < 2 * window; ++y) {
+            for (int x {-window}; x < 2 * window; ++x) {
+                sum += Dist(x, y, px, window / 2);
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 9 * window * window);
+}
+} // namespace
+
+BENCHMARK(BM_TrigDist<old_trig_dist>)->Arg(18);
+BENCHMARK(BM_TrigDist<trig_dist>)->Arg(18);
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include "scent_map.hpp"
+
+using oocdda::ScentMap;
+
+namespace {
+/// A map with walls every few squares, some slime and a trail of scent, like a busy town.
+auto make_map(const int size) -> ScentMap
+{
+    ScentMap map {size, size};
+
+    for (int y {0}; y < size; ++y) {
+        for (int x {0}; x < size; ++x) {
+            map.at(x, y) = (x + y) % 7 == 0 ? 500 : 0;
+            map.set_square(x, y, x % 9 != 4 || y % 5 == 0,
+                           (x * y) % 31 == 0 ? 20 : ScentMap::no_floor);
+        }
+    }
+
+    return map;
+}
+
+void BM_ScentDiffuse(benchmark::State& state)
+{
+    const auto size {static_cast<int>(state.range(0))};
+    auto map {make_map(size)};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.diffuse());
+        map.at(size / 2, size / 2) = 500; // The player keeps the trail fresh.
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+} // namespace
+
+// 36 is today's 3x3 submap window; the larger sizes show how the kernel scales with it.
+BENCHMARK(BM_ScentDiffuse)->Arg(36)->Arg(72)->Arg(144);
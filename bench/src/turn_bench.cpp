@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "game.hpp"
+#include "headless.hpp"
+#include "keypress.hpp"
+#include "mapdata.hpp"
+#include "monster.hpp"
+#include "monster_type.hpp"
+#include "overmap.hpp"
+#include "rng.hpp"
+#include "trap.hpp"
+
+namespace {
+std::atomic<std::uint64_t> allocations {0};
+} // namespace
+
+// Every allocation in the process is counted, the I/O thread's included, so scenarios can report
+// how many a turn makes.
+auto operator new(const std::size_t size) -> void*
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* const memory {std::malloc(size == 0 ? 1 : size)}) {
+        return memory;
+    }
+
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* const memory) noexcept { std::free(memory); }
+void operator delete(void* const memory, std::size_t) noexcept { std::free(memory); }
+
+namespace {
+using oocdda::Game;
+
+/**
+ * \brief Presses one key a turn; should the game want more, gets it past whatever it asks and
+ * then waits.
+ */
+class TurnInput final : public oocdda::InputSource {
+public:
+    explicit TurnInput(const long key)
+        : key_ {key}
+    {
+    }
+
+    /// Called before each turn, which starts again with the key.
+    void reset() { pressed_ = 0; }
+
+    auto next_key() -> long override
+    {
+        if (pressed_++ == 0) {
+            return key_;
+        }
+
+        return after[(pressed_ - 2) % after.size()];
+    }
+
+private:
+    static constexpr std::array<long, 4> after {KEY_ESCAPE, ' ', 'N', '.'};
+
+    long key_;
+    std::size_t pressed_ {0};
+};
+
+/**
+ * \brief A headless game made from a fixed seed, with a random character in the usual first house.
+ *
+ * Each world is played in an empty directory of its own, with the submap and overmap caches
+ * emptied, so a scenario sees the same world whichever others run before it.
+ */
+class World {
+public:
+    World(const std::uint64_t seed, const long key)
+        : input_ {key}
+    {
+        oocdda::seed_rng(seed);
+        oocdda::set_input_source(&input_);
+        game_ = std::make_unique<Game>(true);
+    }
+
+    World(const World&) = delete;
+    World(World&&) = delete;
+    auto operator=(const World&) -> World& = delete;
+    auto operator=(World&&) -> World& = delete;
+
+    ~World()
+    {
+        game_.reset();
+        oocdda::set_input_source(nullptr);
+    }
+
+    [[nodiscard]] auto game() -> Game& { return *game_; }
+
+    void turn()
+    {
+        input_.reset();
+        game_->do_turn();
+    }
+
+private:
+    oocdda::SaveDir dir_ {{}, OOCDDA_DATA_DIR};
+    oocdda::NullScreen screen_;
+    TurnInput input_;
+    std::unique_ptr<Game> game_;
+};
+
+/// Runs \p step once an iteration and reports its rate, latency percentiles and allocations.
+template<typename Step>
+void measure(benchmark::State& state, Step&& step)
+{
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<std::size_t>(state.max_iterations));
+    const std::uint64_t allocated {allocations.load()};
+
+    for (auto _ : state) {
+        const auto start {std::chrono::steady_clock::now()};
+        step();
+        const std::chrono::duration<double, std::micro> took {std::chrono::steady_clock::now()
+                                                               - start};
+        latencies.push_back(took.count());
+    }
+
+    const auto made {static_cast<double>(allocations.load() - allocated)};
+    std::sort(latencies.begin(), latencies.end());
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["p50_us"] = latencies[latencies.size() / 2];
+    state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+    state.counters["allocs"] = benchmark::Counter(made, benchmark::Counter::kAvgIterations);
+}
+
+/// 200 zombies spread around the player, who stands and waits.
+void BM_Horde(benchmark::State& state)
+{
+    World world {0x4f12, '.'};
+    Game& g {world.game()};
+    oocdda::Rng placement {1};
+
+    for (int placed {0}, tries {0}; placed < 200 && tries < 100000; ++tries) {
+        const auto x {static_cast<int>(placement.range(0, SEEX * 3 - 1))};
+        const auto y {static_cast<int>(placement.range(0, SEEY * 3 - 1))};
+
+        if (g.m.move_cost(x, y) > 0 && g.mon_at(x, y) == -1 && (x != g.u.posx || y != g.u.posy)) {
+            g.z.push_back(oocdda::Monster(g.mtypes[oocdda::mon_zombie], x, y));
+            ++placed;
+        }
+    }
+
+    measure(state, [&] { world.turn(); });
+}
+
+/// A forest, set alight along its western edge; the player waits in a clearing in the middle.
+void BM_ForestFire(benchmark::State& state)
+{
+    World world {0xf17e, '.'};
+    Game& g {world.game()};
+
+    for (int x {0}; x < SEEX * 3; ++x) {
+        for (int y {0}; y < SEEY * 3; ++y) {
+            if (std::abs(x - g.u.posx) <= 3 && std::abs(y - g.u.posy) <= 3) {
+                g.m.set_ter(x, y, oocdda::t_dirt);
+            } else {
+                g.m.set_ter(x, y, (x + y) % 3 == 0 ? oocdda::t_grass : oocdda::t_tree);
+            }
+
+            if (x == 0) {
+                g.m.add_field(&g, x, y, oocdda::fd_fire, 3);
+            }
+        }
+    }
+
+    measure(state, [&] { world.turn(); });
+}
+
+/// A big explosion with shrapnel somewhere near the player every turn.
+void BM_Explosions(benchmark::State& state)
+{
+    World world {0xb00b, '.'};
+    Game& g {world.game()};
+    oocdda::Rng placement {2};
+
+    measure(state, [&] {
+        const auto dx {static_cast<int>(placement.range(6, 12))};
+        const auto dy {static_cast<int>(placement.range(-12, 12))};
+        g.explosion(g.u.posx + (placement.one_in(2) ? dx : -dx), g.u.posy + dy, 40, 10, false);
+        world.turn();
+    });
+}
+
+/// Walking east, through anything in the way, so the map shifts every SEEX turns.
+void BM_Travel(benchmark::State& state)
+{
+    World world {0x7a7e, 'l'};
+    Game& g {world.game()};
+    const int start {g.levx};
+
+    measure(state, [&] {
+        const int x {g.u.posx + 1};
+        const int y {g.u.posy};
+        g.m.set_ter(x, y, oocdda::t_dirt);
+        g.m.field_at(x, y) = oocdda::field();
+        g.m.tr_at(x, y) = oocdda::tr_null;
+        world.turn();
+    });
+
+    state.counters["shifts"] = g.levx - start;
+}
+
+/// Overmaps no one has been to yet, in a row heading east, so each has a neighbour to match.
+void BM_OvermapGeneration(benchmark::State& state)
+{
+    World world {0x0e7a, '.'};
+    int x {100};
+
+    measure(state, [&] {
+        const oocdda::overmap generated {&world.game(), x++, 0, 0};
+        benchmark::DoNotOptimize(&generated);
+    });
+}
+} // namespace
+
+// Fixed iteration counts keep every run on the same turns of the same worlds.
+BENCHMARK(BM_Horde)->Iterations(200)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ForestFire)->Iterations(200)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Explosions)->Iterations(100)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Travel)->Iterations(300)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_OvermapGeneration)->Iterations(16)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,205 @@
+#include <utility>
+
+#include "async_record_store.hpp"
+
+namespace oocdda {
+namespace {
+// Prefetched records nobody asked for are dropped once this many pile up.
+constexpr std::size_t max_prefetched {64};
+} // namespace
+
+AsyncRecordStore::AsyncRecordStore(RecordStore& backing, IoWorker& worker)
+    : backing_ {backing}
+    , worker_ {worker}
+{
+}
+
+AsyncRecordStore::~AsyncRecordStore() { worker_.wait_idle(); }
+
+auto AsyncRecordStore::contains(const RecordKey& key) -> bool
+{
+    rethrow_worker_error();
+
+    {
+        const std::lock_guard lock {state_mutex_};
+
+        if (pending_.contains(key)) {
+            return true;
+        }
+
+        if (const auto it {prefetched_.find(key)}; it != prefetched_.end() && it->second.ready) {
+            return it->second.data.has_value();
+        }
+    }
+
+    const std::lock_guard lock {backing_mutex_};
+    return backing_.contains(key);
+}
+
+auto AsyncRecordStore::load(const RecordKey& key) -> std::optional<std::string_view>
+{
+    rethrow_worker_error();
+
+    {
+        const std::lock_guard lock {state_mutex_};
+
+        if (const auto it {pending_.find(key)}; it != pending_.end()) {
+            loaded_ = it->second.data;
+            return loaded_;
+        }
+
+        if (const auto it {prefetched_.find(key)}; it != prefetched_.end()) {
+            // Still in flight or not, the entry is used up; a late read_ahead finds it gone.
+            auto prefetched {std::move(it->second)};
+            prefetched_.erase(it);
+
+            if (prefetched.ready) {
+                if (!prefetched.data) {
+                    return std::nullopt;
+                }
+
+                loaded_ = std::move(*prefetched.data);
+                return loaded_;
+            }
+        }
+    }
+
+    const std::lock_guard lock {backing_mutex_};
+    const auto data {backing_.load(key)};
+
+    if (!data) {
+        return std::nullopt;
+    }
+
+    loaded_.assign(*data);
+    return loaded_;
+}
+
+void AsyncRecordStore::store(const RecordKey& key, const std::string_view data)
+{
+    rethrow_worker_error();
+
+    {
+        const std::lock_guard lock {state_mutex_};
+        pending_.insert_or_assign(key, Pending {std::string {data}, ++next_version_});
+        prefetched_.erase(key);
+    }
+
+    worker_.submit([this, key] { write_behind(key); });
+}
+
+void AsyncRecordStore::flush()
+{
+    worker_.wait_idle();
+    rethrow_worker_error();
+
+    const std::lock_guard lock {backing_mutex_};
+    backing_.flush();
+}
+
+void AsyncRecordStore::prefetch(const RecordKey& key)
+{
+    {
+        const std::lock_guard lock {state_mutex_};
+
+        if (pending_.contains(key) || prefetched_.contains(key)) {
+            return;
+        }
+
+        if (prefetched_.size() >= max_prefetched) {
+            std::erase_if(prefetched_, [](const auto& entry) { return entry.second.ready; });
+        }
+
+        prefetched_.emplace(key, Prefetched {});
+    }
+
+    worker_.submit([this, key] { read_ahead(key); });
+}
+
+void AsyncRecordStore::close()
+{
+    worker_.wait_idle();
+    rethrow_worker_error();
+
+    {
+        const std::lock_guard lock {state_mutex_};
+        prefetched_.clear();
+    }
+
+    const std::lock_guard lock {backing_mutex_};
+    backing_.close();
+}
+
+void AsyncRecordStore::write_behind(const RecordKey& key)
+{
+    Pending pending;
+
+    {
+        const std::lock_guard lock {state_mutex_};
+        const auto it {pending_.find(key)};
+
+        if (it == pending_.end()) {
+            // An earlier job already wrote the newest data.
+            return;
+        }
+
+        pending = it->second;
+    }
+
+    try {
+        const std::lock_guard lock {backing_mutex_};
+        backing_.store(key, pending.data);
+    } catch (...) {
+        const std::lock_guard lock {state_mutex_};
+        worker_error_ = std::current_exception();
+        return;
+    }
+
+    const std::lock_guard lock {state_mutex_};
+
+    // A newer store may have come in meanwhile; its own job will write it.
+    if (const auto it {pending_.find(key)};
+        it != pending_.end() && it->second.version == pending.version) {
+        pending_.erase(it);
+    }
+}
+
+void AsyncRecordStore::read_ahead(const RecordKey& key)
+{
+    std::optional<std::string> data;
+
+    try {
+        const std::lock_guard lock {backing_mutex_};
+
+        if (const auto record {backing_.load(key)}) {
+            data.emplace(*record);
+        }
+    } catch (...) {
+        // Leave the entry in flight; load() then asks the backing store itself and reports the
+        // error on the game thread.
+        return;
+    }
+
+    const std::lock_guard lock {state_mutex_};
+
+    // The entry is gone if the record was loaded or stored in the meantime.
+    if (const auto it {prefetched_.find(key)}; it != prefetched_.end()) {
+        it->second.ready = true;
+        it->second.data = std::move(data);
+    }
+}
+
+void AsyncRecordStore::rethrow_worker_error()
+{
+    std::exception_ptr error;
+
+    {
+        const std::lock_guard lock {state_mutex_};
+        error = std::exchange(worker_error_, nullptr);
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+} // namespace oocdda
@@ -0,0 +1,81 @@
+#ifndef OOCDDA_ASYNC_RECORD_STORE_HPP
+#define OOCDDA_ASYNC_RECORD_STORE_HPP
+
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "io_worker.hpp"
+#include "region_store.hpp"
+
+namespace oocdda {
+/**
+ * \brief Puts a RecordStore behind an IoWorker.
+ *
+ * Stores return as soon as the data is copied; the worker writes it to the backing store later.
+ * Until then the pending copy answers loads, so callers never see the write being late. Prefetched
+ * records are read by the worker ahead of time and handed out from memory.
+ *
+ * Errors raised by the backing store on the worker thread are rethrown by the next call made from
+ * the game thread.
+ */
+class AsyncRecordStore final : public RecordStore {
+public:
+    AsyncRecordStore(RecordStore& backing, IoWorker& worker);
+    AsyncRecordStore(const AsyncRecordStore&) = delete;
+    AsyncRecordStore(AsyncRecordStore&&) = delete;
+    auto operator=(const AsyncRecordStore&) -> AsyncRecordStore& = delete;
+    auto operator=(AsyncRecordStore&&) -> AsyncRecordStore& = delete;
+
+    /// Waits for outstanding writes; the backing store must outlive this.
+    ~AsyncRecordStore() override;
+
+    [[nodiscard]] auto contains(const RecordKey& key) -> bool override;
+    [[nodiscard]] auto load(const RecordKey& key) -> std::optional<std::string_view> override;
+    void store(const RecordKey& key, std::string_view data) override;
+
+    /// Waits until every store so far has reached the backing store, then flushes it.
+    void flush() override;
+
+    void prefetch(const RecordKey& key) override;
+    /// Flushes, forgets every prefetched record and closes the backing store.
+    void close() override;
+
+private:
+    struct Pending {
+        std::string data;
+        std::uint64_t version {0};
+    };
+
+    struct Prefetched {
+        bool ready {false};
+        std::optional<std::string> data;
+    };
+
+    void write_behind(const RecordKey& key);
+    void read_ahead(const RecordKey& key);
+    void rethrow_worker_error();
+
+    RecordStore& backing_;
+    IoWorker& worker_;
+
+    // Guards backing_. Never held together with state_mutex_.
+    std::mutex backing_mutex_;
+
+    // Guards everything below.
+    std::mutex state_mutex_;
+    std::map<RecordKey, Pending> pending_;
+    std::map<RecordKey, Prefetched> prefetched_;
+    std::uint64_t next_version_ {0};
+    std::exception_ptr worker_error_;
+
+    // Backs the view returned by load(); only touched by the caller's thread.
+    std::string loaded_;
+};
+} // namespace oocdda
+
+#endif // OOCDDA_ASYNC_RECORD_STORE_HPP
@@ -0,0 +1,144 @@
+#ifndef OOCDDA_BYTE_BUFFER_HPP
+#define OOCDDA_BYTE_BUFFER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace oocdda {
+/**
+ * \brief Appends little-endian integers and raw byte runs to a growable buffer.
+ *
+ * Used by the binary save formats; every integer is stored with a fixed width so records can be
+ * read back with plain copies.
+ */
+class ByteWriter {
+public:
+    template<std::integral T>
+    void write(const T value)
+    {
+        const auto offset {bytes_.size()};
+        bytes_.resize(offset + sizeof(T));
+        std::memcpy(bytes_.data() + offset, &value, sizeof(T));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            std::reverse(bytes_.begin() + static_cast<std::ptrdiff_t>(offset), bytes_.end());
+        }
+    }
+
+    void write_bytes(const void* data, const std::size_t size)
+    {
+        const auto offset {bytes_.size()};
+        bytes_.resize(offset + size);
+        std::memcpy(bytes_.data() + offset, data, size);
+    }
+
+    /// Writes a 32-bit length followed by the characters of \p text.
+    void write_string(const std::string_view text)
+    {
+        write(static_cast<std::uint32_t>(text.size()));
+        write_bytes(text.data(), text.size());
+    }
+
+    /// Overwrites a previously written 32-bit value, e.g. a section length.
+    void patch(const std::size_t offset, const std::uint32_t value)
+    {
+        std::memcpy(bytes_.data() + offset, &value, sizeof(value));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            std::reverse(bytes_.begin() + static_cast<std::ptrdiff_t>(offset),
+                         bytes_.begin() + static_cast<std::ptrdiff_t>(offset + sizeof(value)));
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return bytes_.size(); }
+    [[nodiscard]] auto bytes() && noexcept -> std::vector<char> { return std::move(bytes_); }
+
+private:
+    std::vector<char> bytes_;
+};
+
+/**
+ * \brief Reads back what a ByteWriter produced.
+ *
+ * Every read reports failure instead of running past the end of the input, so truncated or
+ * corrupted records are rejected rather than misparsed.
+ */
+class ByteReader {
+public:
+    explicit ByteReader(const std::string_view data) noexcept
+        : data_ {data}
+    {
+    }
+
+    template<std::integral T>
+    [[nodiscard]] auto read(T& value) noexcept -> bool
+    {
+        if (remaining() < sizeof(T)) {
+            return false;
+        }
+
+        char buffer[sizeof(T)];
+        std::memcpy(buffer, data_.data() + offset_, sizeof(T));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            std::reverse(std::begin(buffer), std::end(buffer));
+        }
+
+        std::memcpy(&value, buffer, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    [[nodiscard]] auto read_bytes(void* out, const std::size_t size) noexcept -> bool
+    {
+        if (remaining() < size) {
+            return false;
+        }
+
+        std::memcpy(out, data_.data() + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    [[nodiscard]] auto read_string(std::string& text) -> bool
+    {
+        std::uint32_t size {0};
+
+        if (!read(size) || remaining() < size) {
+            return false;
+        }
+
+        text.assign(data_.substr(offset_, size));
+        offset_ += size;
+        return true;
+    }
+
+    [[nodiscard]] auto skip(const std::size_t size) noexcept -> bool
+    {
+        if (remaining() < size) {
+            return false;
+        }
+
+        offset_ += size;
+        return true;
+    }
+
+    [[nodiscard]] auto remaining() const noexcept -> std::size_t { return data_.size() - offset_; }
+    [[nodiscard]] auto offset() const noexcept -> std::size_t { return offset_; }
+
+private:
+    std::string_view data_;
+    std::size_t offset_ {0};
+};
+} // namespace oocdda
+
+#endif // OOCDDA_BYTE_BUFFER_HPP
@@ -796,7 +796,7 @@ void Game::complete_craft()
                 int ch {0};
 
                 do {
-                    ch = getch();
+                    ch = get_key();
                 } while (ch < '1' || ch >= '1' + static_cast<int>(you_have.size()));
 
                 ch -= '1';
@@ -472,7 +472,7 @@ void dis_effect(Game* g, player& p, disease& dis)
                     y = p.posy + rng(-4, 4);
                 } while ((x == p.posx && y == p.posy) || g->mon_at(x, y) != -1);
                 if (g->m.move_cost(x, y) == 0)
-                    g->m.ter(x, y) = t_rubble;
+                    g->m.set_ter(x, y, t_rubble);
                 beast.spawn(x, y);
                 g->z.push_back(beast);
                 if (g->u_see(x, y, junk))
@@ -0,0 +1,90 @@
+#ifndef OOCDDA_DISTANCE_HPP
+#define OOCDDA_DISTANCE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oocdda {
+/// The largest r with r * r <= \p n, for \p n >= 0; exact for every value, unlike a double sqrt.
+[[nodiscard]] constexpr auto isqrt(std::int64_t n) noexcept -> std::int64_t
+{
+    std::int64_t root {0};
+    std::int64_t bit {std::int64_t {1} << 62};
+
+    while (bit > n) {
+        bit >>= 2;
+    }
+
+    // One result bit a step, from the top: the digit-by-digit method in base 4.
+    for (; bit != 0; bit >>= 2) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+    }
+
+    return root;
+}
+
+/// Squared straight-line distance; exact, so the thing to compare distances by.
+[[nodiscard]] constexpr auto square_dist(const int x1, const int y1, const int x2,
+                                         const int y2) noexcept -> std::int64_t
+{
+    const std::int64_t dx {std::int64_t {x1} - x2};
+    const std::int64_t dy {std::int64_t {y1} - y2};
+    return dx * dx + dy * dy;
+}
+
+namespace detail {
+/// std::abs() isn't constexpr before C++23.
+[[nodiscard]] constexpr auto gap(const int a, const int b) noexcept -> int
+{
+    return a > b ? a - b : b - a;
+}
+
+/// Offsets up to this far apart on both axes are looked up rather than worked out.
+inline constexpr int trig_table_size {128};
+
+inline constexpr auto trig_table {[] {
+    std::array<std::uint8_t, trig_table_size * trig_table_size> table {};
+
+    for (int dy {0}; dy < trig_table_size; ++dy) {
+        for (int dx {0}; dx < trig_table_size; ++dx) {
+            table[static_cast<std::size_t>(dy * trig_table_size + dx)]
+                = static_cast<std::uint8_t>(isqrt(square_dist(dx, dy, 0, 0)));
+        }
+    }
+
+    return table;
+}()};
+} // namespace detail
+
+/// Straight-line distance rounded down.
+[[nodiscard]] constexpr auto trig_dist(const int x1, const int y1, const int x2,
+                                       const int y2) noexcept -> int
+{
+    const int dx {detail::gap(x1, x2)};
+    const int dy {detail::gap(y1, y2)};
+
+    // Everything on the map and most of the overmap fits the table.
+    if (dx < detail::trig_table_size && dy < detail::trig_table_size) {
+        return detail::trig_table[static_cast<std::size_t>(dy * detail::trig_table_size + dx)];
+    }
+
+    return static_cast<int>(isqrt(square_dist(x1, y1, x2, y2)));
+}
+
+/// Number of king's moves between the two squares.
+[[nodiscard]] constexpr auto rl_dist(const int x1, const int y1, const int x2,
+                                     const int y2) noexcept -> int
+{
+    const int dx {detail::gap(x1, x2)};
+    const int dy {detail::gap(y1, y2)};
+    return dx > dy ? dx : dy;
+}
+} // namespace oocdda
+
+#endif // OOCDDA_DISTANCE_HPP
@@ -16,345 +16,384 @@
 #include "player.hpp"
 #include "pldata.hpp"
 #include "point.hpp"
+#include "profiler.hpp"
 #include "rng.hpp"
 
 namespace oocdda {
 bool Map::process_fields(Game* g)
 {
+    const ProfileScope profile {Phase::fields};
     bool found_field = false;
-    field* cur;
-    field_id curtype;
-    for (int x = 0; x < SEEX * 3; x++) {
-        for (int y = 0; y < SEEY * 3; y++) {
-            cur = &field_at(x, y);
-            curtype = cur->type;
-            if (!found_field && curtype != fd_null)
-                found_field = true;
-            if (cur->density > 3)
-                debugmsg("Whoooooa density of %d", cur->density);
-
-            if (cur->age == 0) // Don't process "newborn" fields
-                curtype = fd_null;
-
-            switch (curtype) {
-            case fd_null:
-            default:
-                break;
+    // Squares listed while the pass runs are visited if they come later in map order, just as the
+    // old sweep over every square would have reached them.
+    for (std::size_t n : field_squares) {
+        const int x = int(n % (SEEX * 3)), y = int(n / (SEEX * 3));
+        if (process_field(g, x, y))
+            found_field = true;
+    }
+    prune_fields();
+    return found_field;
+}
 
-            case fd_blood:
-            case fd_bile:
-                if (has_flag(swimmable, x, y)) // Dissipate faster in water
-                    cur->age += 250;
-                break;
+bool Map::process_field(Game* g, int x, int y)
+{
+    field* cur = &field_at(x, y);
+    field_id curtype = cur->type;
+    const bool found_field = curtype != fd_null;
+    if (cur->density > 3)
+        debugmsg("Whoooooa density of %d", cur->density);
 
-            case fd_acid:
-                if (has_flag(swimmable, x, y)) // Dissipate faster in water
-                    cur->age += 20;
-
-                for (std::size_t i {0}; i < i_at(x, y).size(); ++i) {
-                    if (i_at(x, y)[i].made_of(material::LIQUID)
-                        || i_at(x, y)[i].made_of(material::VEGGY)
-                        || i_at(x, y)[i].made_of(material::FLESH)
-                        || i_at(x, y)[i].made_of(material::POWDER)
-                        || i_at(x, y)[i].made_of(material::COTTON)
-                        || i_at(x, y)[i].made_of(material::WOOL)
-                        || i_at(x, y)[i].made_of(material::PAPER)
-                        || i_at(x, y)[i].made_of(material::PLASTIC)
-                        || i_at(x, y)[i].made_of(material::GLASS)) {
-                        // Acid-destructable.
-                        cur->age += static_cast<int>(i_at(x, y)[i].volume());
-
-                        for (const auto& content : i_at(x, y)[i].contents) {
-                            i_at(x, y).push_back(content);
-                        }
-
-                        i_at(x, y).erase(i_at(x, y).begin() + static_cast<std::ptrdiff_t>(i));
-                        --i;
-                    }
-                }
+    if (cur->age == 0) // Don't process "newborn" fields
+        curtype = fd_null;
 
-                break;
+    switch (curtype) {
+    case fd_null:
+    default:
+        break;
 
-            case fd_fire:
-                // Consume items as fuel to help us grow/last longer.
-                bool destroyed;
-                int vol;
-
-                for (std::size_t i {0}; i < i_at(x, y).size(); ++i) {
-                    destroyed = false;
-                    vol = i_at(x, y)[i].volume();
-                    if (i_at(x, y)[i].is_ammo()) {
-                        cur->age /= 2;
-                        cur->age -= 300;
-                        destroyed = true;
-                    } else if (i_at(x, y)[i].made_of(PAPER)) {
-                        cur->age -= vol * 10;
-                        destroyed = true;
-                    } else if ((i_at(x, y)[i].made_of(WOOD) || i_at(x, y)[i].made_of(VEGGY))
-                               && (vol <= cur->density * 10
-                                           - (cur->age > 0 ? rng(0, cur->age / 10) : 0)
-                                   || cur->density == 3)) {
-                        cur->age -= vol * 10;
-                        destroyed = true;
-                    } else if ((i_at(x, y)[i].made_of(COTTON) || i_at(x, y)[i].made_of(FLESH)
-                                || i_at(x, y)[i].made_of(WOOL))
-                               && (vol <= cur->density * 2 || (cur->density == 3 && one_in(vol)))) {
-                        cur->age -= vol * 5;
-                        destroyed = true;
-                    } else if (i_at(x, y)[i].made_of(LIQUID) || i_at(x, y)[i].made_of(POWDER)
-                               || i_at(x, y)[i].made_of(PLASTIC)
-                               || (cur->density >= 2 && i_at(x, y)[i].made_of(GLASS))
-                               || (cur->density == 3 && i_at(x, y)[i].made_of(IRON))) {
-                        switch (i_at(x, y)[i].type->id) { // TODO: Make this be not a hack.
-                        case itm_whiskey:
-                        case itm_vodka:
-                        case itm_rum:
-                        case itm_tequila:
-                            cur->age -= 220;
-                            break;
-                        }
-                        destroyed = true;
-                    }
-                    if (destroyed) {
-                        for (const auto& content : i_at(x, y)[i].contents) {
-                            i_at(x, y).push_back(content);
-                        }
+    case fd_blood:
+    case fd_bile:
+        if (has_flag(swimmable, x, y)) // Dissipate faster in water
+            cur->age += 250;
+        break;
 
-                        i_at(x, y).erase(i_at(x, y).begin() + i);
-                        i--;
-                    }
+    case fd_acid:
+        if (has_flag(swimmable, x, y)) // Dissipate faster in water
+            cur->age += 20;
+
+        for (std::size_t i {0}; i < i_at(x, y).size(); ++i) {
+            if (i_at(x, y)[i].made_of(material::LIQUID)
+                || i_at(x, y)[i].made_of(material::VEGGY)
+                || i_at(x, y)[i].made_of(material::FLESH)
+                || i_at(x, y)[i].made_of(material::POWDER)
+                || i_at(x, y)[i].made_of(material::COTTON)
+                || i_at(x, y)[i].made_of(material::WOOL)
+                || i_at(x, y)[i].made_of(material::PAPER)
+                || i_at(x, y)[i].made_of(material::PLASTIC)
+                || i_at(x, y)[i].made_of(material::GLASS)) {
+                // Acid-destructable.
+                cur->age += static_cast<int>(i_at(x, y)[i].volume());
+
+                for (const auto& content : i_at(x, y)[i].contents) {
+                    i_at(x, y).push_back(content);
                 }
 
-                // Consume the terrain we're on
-                if (terlist[ter(x, y)].flags & flag_to_bit_position(flammable)
-                    && one_in(8 - cur->density)) {
-                    cur->age -= cur->density * cur->density * 40;
-                    if (cur->density == 3)
-                        ter(x, y) = t_rubble;
-                } else if (terlist[ter(x, y)].flags & flag_to_bit_position(explodes)) {
-                    ter(x, y) = t_gas_pump_smashed;
-                    cur->age = 0;
-                    cur->density = 3;
-                    g->explosion(x, y, 40, 0, true);
-                } else if (terlist[ter(x, y)].flags & flag_to_bit_position(swimmable))
-                    cur->age += 800; // Flames die quickly on water
-                // If we consumed a lot, the flames grow higher
-                while (cur->density < 3 && cur->age < 0) {
-                    cur->age += 300;
-                    cur->density++;
+                i_at(x, y).erase(i_at(x, y).begin() + static_cast<std::ptrdiff_t>(i));
+                --i;
+            }
+        }
+
+        break;
+
+    case fd_fire:
+        // Consume items as fuel to help us grow/last longer.
+        bool destroyed;
+        int vol;
+
+        for (std::size_t i {0}; i < i_at(x, y).size(); ++i) {
+            destroyed = false;
+            vol = i_at(x, y)[i].volume();
+            if (i_at(x, y)[i].is_ammo()) {
+                cur->age /= 2;
+                cur->age -= 300;
+                destroyed = true;
+            } else if (i_at(x, y)[i].made_of(PAPER)) {
+                cur->age -= vol * 10;
+                destroyed = true;
+            } else if ((i_at(x, y)[i].made_of(WOOD) || i_at(x, y)[i].made_of(VEGGY))
+                       && (vol <= cur->density * 10
+                                   - (cur->age > 0 ? rng(0, cur->age / 10) : 0)
+                           || cur->density == 3)) {
+                cur->age -= vol * 10;
+                destroyed = true;
+            } else if ((i_at(x, y)[i].made_of(COTTON) || i_at(x, y)[i].made_of(FLESH)
+                        || i_at(x, y)[i].made_of(WOOL))
+                       && (vol <= cur->density * 2 || (cur->density == 3 && one_in(vol)))) {
+                cur->age -= vol * 5;
+                destroyed = true;
+            } else if (i_at(x, y)[i].made_of(LIQUID) || i_at(x, y)[i].made_of(POWDER)
+                       || i_at(x, y)[i].made_of(PLASTIC)
+                       || (cur->density >= 2 && i_at(x, y)[i].made_of(GLASS))
+                       || (cur->density == 3 && i_at(x, y)[i].made_of(IRON))) {
+                switch (i_at(x, y)[i].type->id) { // TODO: Make this be not a hack.
+                case itm_whiskey:
+                case itm_vodka:
+                case itm_rum:
+                case itm_tequila:
+                    cur->age -= 220;
+                    break;
                 }
-                // If the flames are REALLY big, they contribute to adjacent flames
-                if (cur->density == 3 && cur->age < 0) {
-                    // Randomly offset our x/y shifts by 0-2, to randomly pick a square to spread to
-                    int starti = rng(0, 2);
-                    int startj = rng(0, 2);
-                    for (int i = 0; i < 3 && cur->age < 0; i++) {
-                        for (int j = 0; j < 3 && cur->age < 0; j++) {
-                            if (field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).type
-                                    == fd_fire
-                                && field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).density
-                                    < 3) {
-                                field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).density++;
-                                field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).age = 0;
-                                cur->age = 0;
-                            }
-                        }
+                destroyed = true;
+            }
+            if (destroyed) {
+                for (const auto& content : i_at(x, y)[i].contents) {
+                    i_at(x, y).push_back(content);
+                }
+
+                i_at(x, y).erase(i_at(x, y).begin() + i);
+                i--;
+            }
+        }
+
+        // Consume the terrain we're on
+        if (terlist[ter(x, y)].flags & flag_to_bit_position(flammable)
+            && one_in(8 - cur->density)) {
+            cur->age -= cur->density * cur->density * 40;
+            if (cur->density == 3)
+                set_ter(x, y, t_rubble);
+        } else if (terlist[ter(x, y)].flags & flag_to_bit_position(explodes)) {
+            set_ter(x, y, t_gas_pump_smashed);
+            cur->age = 0;
+            cur->density = 3;
+            g->explosion(x, y, 40, 0, true);
+        } else if (terlist[ter(x, y)].flags & flag_to_bit_position(swimmable))
+            cur->age += 800; // Flames die quickly on water
+        // If we consumed a lot, the flames grow higher
+        while (cur->density < 3 && cur->age < 0) {
+            cur->age += 300;
+            cur->density++;
+        }
+        // If the flames are REALLY big, they contribute to adjacent flames
+        if (cur->density == 3 && cur->age < 0) {
+            // Randomly offset our x/y shifts by 0-2, to randomly pick a square to spread to
+            int starti = rng(0, 2);
+            int startj = rng(0, 2);
+            for (int i = 0; i < 3 && cur->age < 0; i++) {
+                for (int j = 0; j < 3 && cur->age < 0; j++) {
+                    if (field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).type
+                            == fd_fire
+                        && field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).density
+                            < 3) {
+                        field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).density++;
+                        field_at(x + ((i + starti) % 3), y + ((j + startj) % 3)).age = 0;
+                        cur->age = 0;
                     }
                 }
-                // Consume adjacent fuel / terrain to spread.
-                for (int i = -1; i <= 1; i++) {
-                    for (int j = -1; j <= 1; j++) {
-                        if (x + i >= 0 && y + j >= 0 && x + i < SEEX * 3 && y + j <= SEEY * 3) {
-                            if (has_flag(explodes, x + i, y + j) && one_in(8 - cur->density)) {
-                                ter(x + i, y + j) = t_gas_pump_smashed;
-                                g->explosion(x + i, y + j, 40, 0, true);
-                            } else if ((i != 0 || j != 0)
-                                       && (i_at(x + i, y + j).size() > 0
-                                           || rng(15, 120) < cur->density * 10)) {
-                                if (field_at(x + i, y + j).type == fd_smoke)
-                                    field_at(x + i, y + j) = field(fd_fire, 1, 0);
-                                else
-                                    add_field(g, x + i, y + j, fd_fire, 1);
-                                // If we're not spreading, maybe we'll stick out some smoke, huh?
-                            } else if (move_cost(x + i, y + j) > 0 && rng(7, 40) < cur->density * 10
-                                       && cur->age < 1000) {
-                                add_field(g, x + i, y + j, fd_smoke, rng(1, cur->density));
-                            }
-                        }
+            }
+        }
+        // Consume adjacent fuel / terrain to spread.
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++) {
+                if (x + i >= 0 && y + j >= 0 && x + i < SEEX * 3 && y + j <= SEEY * 3) {
+                    if (has_flag(explodes, x + i, y + j) && one_in(8 - cur->density)) {
+                        set_ter(x + i, y + j, t_gas_pump_smashed);
+                        g->explosion(x + i, y + j, 40, 0, true);
+                    } else if ((i != 0 || j != 0)
+                               && (i_at(x + i, y + j).size() > 0
+                                   || rng(15, 120) < cur->density * 10)) {
+                        if (field_at(x + i, y + j).type == fd_smoke)
+                            field_at(x + i, y + j) = field(fd_fire, 1, 0);
+                        else
+                            add_field(g, x + i, y + j, fd_fire, 1);
+                        // If we're not spreading, maybe we'll stick out some smoke, huh?
+                    } else if (move_cost(x + i, y + j) > 0 && rng(7, 40) < cur->density * 10
+                               && cur->age < 1000) {
+                        add_field(g, x + i, y + j, fd_smoke, rng(1, cur->density));
                     }
                 }
-                break;
+            }
+        }
+        break;
 
-            case fd_smoke:
-                for (int i = -1; i <= 1; i++) {
-                    for (int j = -1; j <= 1; j++)
-                        g->scent(x + i, y + j) = 0;
+    case fd_smoke:
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++)
+                g->scent(x + i, y + j) = 0;
+        }
+        if (one_in(3)) {
+            std::vector<Point> spread;
+            for (int a = -1; a <= 1; a++) {
+                for (int b = -1; b <= 1; b++) {
+                    if ((field_at(x + a, y + b).type == fd_smoke
+                         && field_at(x + a, y + b).density < 3)
+                        || (field_at(x + a, y + b).is_null()
+                            && move_cost(x + a, y + b) > 0))
+                        spread.push_back(Point(x + a, y + b));
                 }
-                if (one_in(3)) {
-                    std::vector<Point> spread;
-                    for (int a = -1; a <= 1; a++) {
-                        for (int b = -1; b <= 1; b++) {
-                            if ((field_at(x + a, y + b).type == fd_smoke
-                                 && field_at(x + a, y + b).density < 3)
-                                || (field_at(x + a, y + b).is_null()
-                                    && move_cost(x + a, y + b) > 0))
-                                spread.push_back(Point(x + a, y + b));
-                        }
-                    }
-                    if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
-                        Point p = spread[rng(0, spread.size() - 1)];
-                        if (field_at(p.x, p.y).type == fd_smoke && field_at(p.x, p.y).density < 3) {
-                            field_at(p.x, p.y).density++;
-                            cur->density--;
-                        } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
-                                   && add_field(g, p.x, p.y, fd_smoke, 1)) {
-                            cur->density--;
-                            field_at(p.x, p.y).age = cur->age;
-                        }
-                    }
+            }
+            if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
+                Point p = spread[rng(0, spread.size() - 1)];
+                if (field_at(p.x, p.y).type == fd_smoke && field_at(p.x, p.y).density < 3) {
+                    field_at(p.x, p.y).density++;
+                    cur->density--;
+                } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
+                           && add_field(g, p.x, p.y, fd_smoke, 1)) {
+                    cur->density--;
+                    field_at(p.x, p.y).age = cur->age;
                 }
-                break;
+            }
+        }
+        break;
 
-            case fd_tear_gas:
-                // Reset nearby scents to zero
-                for (int i = -1; i <= 1; i++) {
-                    for (int j = -1; j <= 1; j++)
-                        g->scent(x + i, y + j) = 0;
+    case fd_tear_gas:
+        // Reset nearby scents to zero
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++)
+                g->scent(x + i, y + j) = 0;
+        }
+        // One in three chance that it spreads (less than smoke!)
+        if (one_in(3)) {
+            std::vector<Point> spread;
+            // Pick all eligible points to spread to
+            for (int a = -1; a <= 1; a++) {
+                for (int b = -1; b <= 1; b++) {
+                    if (((field_at(x + a, y + b).type == fd_smoke
+                          || field_at(x + a, y + b).type == fd_tear_gas)
+                         && field_at(x + a, y + b).density < 3)
+                        || (field_at(x + a, y + b).is_null()
+                            && move_cost(x + a, y + b) > 0))
+                        spread.push_back(Point(x + a, y + b));
                 }
-                // One in three chance that it spreads (less than smoke!)
-                if (one_in(3)) {
-                    std::vector<Point> spread;
-                    // Pick all eligible points to spread to
-                    for (int a = -1; a <= 1; a++) {
-                        for (int b = -1; b <= 1; b++) {
-                            if (((field_at(x + a, y + b).type == fd_smoke
-                                  || field_at(x + a, y + b).type == fd_tear_gas)
-                                 && field_at(x + a, y + b).density < 3)
-                                || (field_at(x + a, y + b).is_null()
-                                    && move_cost(x + a, y + b) > 0))
-                                spread.push_back(Point(x + a, y + b));
-                        }
-                    }
-                    // Then, spread to a nearby point
-                    if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
-                        Point p = spread[rng(0, spread.size() - 1)];
-                        // Nearby teargas grows thicker
-                        if (field_at(p.x, p.y).type == fd_tear_gas
-                            && field_at(p.x, p.y).density < 3) {
-                            field_at(p.x, p.y).density++;
-                            cur->density--;
-                            // Nearby smoke is converted into teargas
-                        } else if (field_at(p.x, p.y).type == fd_smoke) {
-                            field_at(p.x, p.y).type = fd_tear_gas;
-                            // Or, just create a new field.
-                        } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
-                                   && add_field(g, p.x, p.y, fd_tear_gas, 1)) {
-                            cur->density--;
-                            field_at(p.x, p.y).age = cur->age;
-                        }
-                    }
+            }
+            // Then, spread to a nearby point
+            if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
+                Point p = spread[rng(0, spread.size() - 1)];
+                // Nearby teargas grows thicker
+                if (field_at(p.x, p.y).type == fd_tear_gas
+                    && field_at(p.x, p.y).density < 3) {
+                    field_at(p.x, p.y).density++;
+                    cur->density--;
+                    // Nearby smoke is converted into teargas
+                } else if (field_at(p.x, p.y).type == fd_smoke) {
+                    field_at(p.x, p.y).type = fd_tear_gas;
+                    // Or, just create a new field.
+                } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
+                           && add_field(g, p.x, p.y, fd_tear_gas, 1)) {
+                    cur->density--;
+                    field_at(p.x, p.y).age = cur->age;
                 }
-                break;
+            }
+        }
+        break;
 
-            case fd_nuke_gas:
-                // Reset nearby scents to zero
-                for (int i = -1; i <= 1; i++) {
-                    for (int j = -1; j <= 1; j++)
-                        g->scent(x + i, y + j) = 0;
+    case fd_nuke_gas:
+        // Reset nearby scents to zero
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++)
+                g->scent(x + i, y + j) = 0;
+        }
+        // Increase long-term radiation in the land underneath
+        radiation(x, y) += rng(0, cur->density);
+        if (one_in(2)) {
+            std::vector<Point> spread;
+            // Pick all eligible points to spread to
+            for (int a = -1; a <= 1; a++) {
+                for (int b = -1; b <= 1; b++) {
+                    if (((field_at(x + a, y + b).type == fd_smoke
+                          || field_at(x + a, y + b).type == fd_tear_gas
+                          || field_at(x + a, y + b).type == fd_nuke_gas)
+                         && field_at(x + a, y + b).density < 3)
+                        || (field_at(x + a, y + b).is_null()
+                            && move_cost(x + a, y + b) > 0))
+                        spread.push_back(Point(x + a, y + b));
                 }
-                // Increase long-term radiation in the land underneath
-                radiation(x, y) += rng(0, cur->density);
-                if (one_in(2)) {
-                    std::vector<Point> spread;
-                    // Pick all eligible points to spread to
-                    for (int a = -1; a <= 1; a++) {
-                        for (int b = -1; b <= 1; b++) {
-                            if (((field_at(x + a, y + b).type == fd_smoke
-                                  || field_at(x + a, y + b).type == fd_tear_gas
-                                  || field_at(x + a, y + b).type == fd_nuke_gas)
-                                 && field_at(x + a, y + b).density < 3)
-                                || (field_at(x + a, y + b).is_null()
-                                    && move_cost(x + a, y + b) > 0))
-                                spread.push_back(Point(x + a, y + b));
-                        }
-                    }
-                    // Then, spread to a nearby point
-                    if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
-                        Point p = spread[rng(0, spread.size() - 1)];
-                        // Nearby nukegas grows thicker
-                        if (field_at(p.x, p.y).type == fd_nuke_gas
-                            && field_at(p.x, p.y).density < 3) {
-                            field_at(p.x, p.y).density++;
-                            cur->density--;
-                            // Nearby smoke & teargas is converted into nukegas
-                        } else if (field_at(p.x, p.y).type == fd_smoke
-                                   || field_at(p.x, p.y).type == fd_tear_gas) {
-                            field_at(p.x, p.y).type = fd_nuke_gas;
-                            // Or, just create a new field.
-                        } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
-                                   && add_field(g, p.x, p.y, fd_nuke_gas, 1)) {
-                            cur->density--;
-                            field_at(p.x, p.y).age = cur->age;
-                        }
-                    }
+            }
+            // Then, spread to a nearby point
+            if (cur->density > 0 && cur->age > 0 && spread.size() > 0) {
+                Point p = spread[rng(0, spread.size() - 1)];
+                // Nearby nukegas grows thicker
+                if (field_at(p.x, p.y).type == fd_nuke_gas
+                    && field_at(p.x, p.y).density < 3) {
+                    field_at(p.x, p.y).density++;
+                    cur->density--;
+                    // Nearby smoke & teargas is converted into nukegas
+                } else if (field_at(p.x, p.y).type == fd_smoke
+                           || field_at(p.x, p.y).type == fd_tear_gas) {
+                    field_at(p.x, p.y).type = fd_nuke_gas;
+                    // Or, just create a new field.
+                } else if (cur->density > 0 && move_cost(p.x, p.y) > 0
+                           && add_field(g, p.x, p.y, fd_nuke_gas, 1)) {
+                    cur->density--;
+                    field_at(p.x, p.y).age = cur->age;
                 }
-                break;
-            case fd_electricity:
-                if (!one_in(5)) { // 4 in 5 chance to spread
-                    std::vector<Point> valid;
-                    if (move_cost(x, y) == 0 && cur->density > 1) { // We're grounded
-                        int tries = 0;
-                        while (tries < 10 && cur->age < 50) {
-                            int cx = x + rng(-1, 1), cy = y + rng(-1, 1);
-                            if (move_cost(cx, cy) != 0 && field_at(cx, cy).is_null()) {
-                                add_field(g, cx, cy, fd_electricity, 1);
-                                cur->density--;
-                                tries = 0;
-                            } else
-                                tries++;
-                        }
-                    } else { // We're not grounded; attempt to ground
-                        for (int a = -1; a <= 1; a++) {
-                            for (int b = -1; b <= 1; b++) {
-                                if (move_cost(x + a, y + b) == 0 && // Grounded tiles first
-                                    field_at(x + a, y + b).is_null())
-                                    valid.push_back(Point(x + a, y + b));
-                            }
-                        }
-                        if (valid.size() == 0) { // Spread to adjacent space, then
-                            int px = x + rng(-1, 1), py = y + rng(-1, 1);
-                            if (move_cost(px, py) > 0 && field_at(px, py).type == fd_electricity
-                                && field_at(px, py).density < 3)
-                                field_at(px, py).density++;
-                            else if (move_cost(px, py) > 0)
-                                add_field(g, px, py, fd_electricity, 1);
-                            cur->density--;
-                        }
-                        while (valid.size() > 0 && cur->density > 0) {
-                            int index = rng(0, valid.size() - 1);
-                            add_field(g, valid[index].x, valid[index].y, fd_electricity, 1);
-                            cur->density--;
-                            valid.erase(valid.begin() + index);
-                        }
+            }
+        }
+        break;
+    case fd_electricity:
+        if (!one_in(5)) { // 4 in 5 chance to spread
+            std::vector<Point> valid;
+            if (move_cost(x, y) == 0 && cur->density > 1) { // We're grounded
+                int tries = 0;
+                while (tries < 10 && cur->age < 50) {
+                    int cx = x + rng(-1, 1), cy = y + rng(-1, 1);
+                    if (move_cost(cx, cy) != 0 && field_at(cx, cy).is_null()) {
+                        add_field(g, cx, cy, fd_electricity, 1);
+                        cur->density--;
+                        tries = 0;
+                    } else
+                        tries++;
+                }
+            } else { // We're not grounded; attempt to ground
+                for (int a = -1; a <= 1; a++) {
+                    for (int b = -1; b <= 1; b++) {
+                        if (move_cost(x + a, y + b) == 0 && // Grounded tiles first
+                            field_at(x + a, y + b).is_null())
+                            valid.push_back(Point(x + a, y + b));
                     }
                 }
-                break;
-            }
-
-            if (cur->type != fd_null) {
-                cur->age++;
-                if (cur->age > 0 && dice(3, cur->age) > dice(3, fieldlist[cur->type].halflife)) {
-                    cur->age = 0;
+                if (valid.size() == 0) { // Spread to adjacent space, then
+                    int px = x + rng(-1, 1), py = y + rng(-1, 1);
+                    if (move_cost(px, py) > 0 && field_at(px, py).type == fd_electricity
+                        && field_at(px, py).density < 3)
+                        field_at(px, py).density++;
+                    else if (move_cost(px, py) > 0)
+                        add_field(g, px, py, fd_electricity, 1);
                     cur->density--;
                 }
-                if (cur->density <= 0)
-                    field_at(x, y) = field();
+                while (valid.size() > 0 && cur->density > 0) {
+                    int index = rng(0, valid.size() - 1);
+                    add_field(g, valid[index].x, valid[index].y, fd_electricity, 1);
+                    cur->density--;
+                    valid.erase(valid.begin() + index);
+                }
             }
         }
+        break;
     }
+
+    if (cur->type != fd_null) {
+        cur->age++;
+        if (cur->age > 0 && dice(3, cur->age) > dice(3, fieldlist[cur->type].halflife)) {
+            cur->age = 0;
+            cur->density--;
+        }
+        if (cur->density <= 0)
+            field_at(x, y) = field();
+    }
+    // Fields changed through cur after the square was last looked at.
+    invalidate_square(x, y);
     return found_field;
 }
 
+void Map::advance_fields(Game* g, int turns)
+{
+    // Fire, gases and electricity reach into their neighbours, so while any are about every field
+    // has to be stepped a turn at a time, in map order.
+    int t = 0;
+    for (; t < turns; t++) {
+        bool spreading = false;
+        for (std::size_t n : field_squares) {
+            field_id type = fld_tiles[n].type;
+            if (type == fd_fire || type == fd_smoke || type == fd_tear_gas || type == fd_nuke_gas
+                || type == fd_electricity) {
+                spreading = true;
+                break;
+            }
+        }
+        if (!spreading)
+            break;
+        if (!process_fields(g))
+            return;
+    }
+    // What's left keeps to its own square, so each one can be run out on its own.
+    for (std::size_t n : field_squares) {
+        const int x = int(n % (SEEX * 3)), y = int(n / (SEEX * 3));
+        for (int i = t; i < turns && fld_tiles[n].type != fd_null; i++)
+            process_field(g, x, y);
+    }
+    prune_fields();
+}
+
 void Map::step_in_field(int x, int y, Game* g)
 {
     field* cur = &field_at(x, y);
@@ -0,0 +1,174 @@
+#ifndef OOCDDA_FLOW_FIELD_HPP
+#define OOCDDA_FLOW_FIELD_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+#include "point.hpp"
+
+namespace oocdda {
+/**
+ * \brief How far every square of a width by height window is from the nearest of a set of goals.
+ *
+ * A square's distance is the total cost of the squares on the cheapest way from it to a goal,
+ * counting itself but not the goal, so the neighbour with the least distance is always the
+ * cheapest next step.
+ *
+ * Filled in one Dijkstra pass, after which anything on the window can head for the goals one
+ * step at a time by moving to its cheapest neighbour, without a search of its own. All eight
+ * neighbours are one step away, as they are for moving about the map.
+ */
+class FlowField {
+public:
+    /// The distance of squares the goals can't be reached from.
+    static constexpr int unreachable {INT_MAX};
+
+    FlowField(const int width, const int height)
+        : width_ {width}
+        , height_ {height}
+        , distance_(static_cast<std::size_t>(width * height), unreachable)
+    {
+        open_.reserve(static_cast<std::size_t>(width * height));
+    }
+
+    /**
+     * \brief Recomputes the field for \p goals.
+     *
+     * \param cost Called as cost(x, y) for squares inside the window; gives the cost of stepping
+     * onto that square, or 0 if it can't be entered. Goals count whatever their cost, so a noise in
+     * a wall still draws things to it.
+     */
+    template<typename Cost>
+    void compute(const std::vector<Point>& goals, const Cost& cost)
+    {
+        std::fill(distance_.begin(), distance_.end(), unreachable);
+        open_.clear();
+
+        for (const auto& goal : goals) {
+            if (inside(goal) && distance_[cell(goal)] != 0) {
+                distance_[cell(goal)] = 0;
+                open_.push_back({cell(goal), 0});
+            }
+        }
+
+        std::make_heap(open_.begin(), open_.end(), farther);
+
+        while (!open_.empty()) {
+            std::pop_heap(open_.begin(), open_.end(), farther);
+            const Node node {open_.back()};
+            open_.pop_back();
+
+            if (node.distance != distance_[node.cell]) {
+                continue; // Already reached by a shorter way
+            }
+
+            const Point here {point(node.cell)};
+
+            for (const auto& offset : offsets) {
+                const Point next {here.x + offset.x, here.y + offset.y};
+
+                if (!inside(next)) {
+                    continue;
+                }
+
+                const int step {cost(next.x, next.y)};
+
+                if (step <= 0) {
+                    continue;
+                }
+
+                const int total {node.distance + step};
+                const std::size_t n {cell(next)};
+
+                if (total < distance_[n]) {
+                    distance_[n] = total;
+                    open_.push_back({n, total});
+                    std::push_heap(open_.begin(), open_.end(), farther);
+                }
+            }
+        }
+    }
+
+    /// unreachable for squares outside the window.
+    [[nodiscard]] auto distance(const int x, const int y) const -> int
+    {
+        return inside({x, y}) ? distance_[cell({x, y})] : unreachable;
+    }
+
+    [[nodiscard]] auto reachable(const int x, const int y) const -> bool
+    {
+        return distance(x, y) != unreachable;
+    }
+
+    /**
+     * \brief The neighbour of (\p x, \p y) closest to the goals.
+     *
+     * \return (\p x, \p y) itself if it's a goal, or if it's unreachable or no neighbour is closer.
+     */
+    [[nodiscard]] auto next_step(const int x, const int y) const -> Point
+    {
+        Point best {x, y};
+        int best_distance {distance(x, y)};
+
+        if (best_distance == 0 || best_distance == unreachable) {
+            return best;
+        }
+
+        for (const auto& offset : offsets) {
+            const int d {distance(x + offset.x, y + offset.y)};
+
+            if (d < best_distance) {
+                best = {x + offset.x, y + offset.y};
+                best_distance = d;
+            }
+        }
+
+        return best;
+    }
+
+    [[nodiscard]] auto inside(const Point p) const -> bool
+    {
+        return p.x >= 0 && p.x < width_ && p.y >= 0 && p.y < height_;
+    }
+
+private:
+    struct Node {
+        std::size_t cell;
+        int distance;
+    };
+
+    /// Straight neighbours first, so ties go to them and paths don't zigzag.
+    static constexpr std::array<Point, 8> offsets {{
+        {0, -1},
+        {1, 0},
+        {0, 1},
+        {-1, 0},
+        {1, -1},
+        {1, 1},
+        {-1, 1},
+        {-1, -1},
+    }};
+
+    static auto farther(const Node& a, const Node& b) -> bool { return a.distance > b.distance; }
+
+    [[nodiscard]] auto cell(const Point p) const -> std::size_t
+    {
+        return static_cast<std::size_t>(p.y * width_ + p.x);
+    }
+
+    [[nodiscard]] auto point(const std::size_t n) const -> Point
+    {
+        return {static_cast<int>(n) % width_, static_cast<int>(n) / width_};
+    }
+
+    int width_;
+    int height_;
+    std::vector<int> distance_;
+    std::vector<Node> open_; ///< Binary heap, nearest on top.
+};
+} // namespace oocdda
+
+#endif // OOCDDA_FLOW_FIELD_HPP
@@ -8,7 +8,10 @@
 #include <ctime>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "game.hpp"
@@ -30,9 +33,13 @@
 #include "npc.hpp"
 #include "omdata.hpp"
 #include "output.hpp"
+#include "overmap_cache.hpp"
 #include "pldata.hpp"
+#include "profiler.hpp"
+#include "region_store.hpp"
 #include "rng.hpp"
 #include "skill.hpp"
+#include "submap_cache.hpp"
 #include "trap.hpp"
 #include "tutorial.hpp"
 
@@ -47,9 +54,17 @@ nc_color sev(int a); // Right now, ONLY used for scent debugging....
 
 // This is the main game set-up process.
 Game::Game()
+    : Game(false)
 {
-    clear(); // Clear the screen
-    intro(); // Print an intro screen, make sure we're at least 80x25
+}
+
+Game::Game(bool headless)
+    : headless(headless)
+{
+    if (!headless) {
+        clear(); // Clear the screen
+        intro(); // Print an intro screen, make sure we're at least 80x25
+    }
 
     ensure_save_directory_exists();
 
@@ -68,6 +83,7 @@ Game::Game()
     // Aw hell, we getting ncursey up in here!
     w_terrain = newwin(SEEY * 2 + 1, SEEX * 2 + 1, 0, 0);
     werase(w_terrain);
+    w_terrain_back = newpad(SEEY * 2 + 1, SEEX * 2 + 1);
     w_minimap = newwin(7, 7, 0, SEEX * 2 + 1);
     werase(w_minimap);
     w_HP = newwin(14, 7, 7, SEEX * 2 + 1);
@@ -92,13 +108,13 @@ Game::Game()
     }
 
     // Set the scent map to 0.
-    for (auto& rows : grscent) {
-        for (int& scent : rows) {
-            scent = 0;
-        }
-    }
+    grscent.clear();
 
-    if (opening_screen()) { // Opening menu
+    if (headless) { // Nobody to ask, so a random character it is
+        u.create(this, PLTYPE_RANDOM, "Headless");
+        start_game();
+        run_mode = 0; // Nobody to be startled by monsters, so waiting is always allowed
+    } else if (opening_screen()) { // Opening menu
         // Finally, draw the screen!
         refresh_all();
         draw();
@@ -107,6 +123,9 @@ Game::Game()
 
 Game::~Game()
 {
+    // Cached submaps hold items that point into itypes; write them out while those still exist.
+    submap_cache().flush();
+
     for (const auto& itype : itypes) {
         delete itype;
     }
@@ -120,6 +139,7 @@ Game::~Game()
     }
 
     delwin(w_terrain);
+    delwin(w_terrain_back);
     delwin(w_minimap);
     delwin(w_HP);
     delwin(w_moninfo);
@@ -369,11 +389,7 @@ void Game::start_tutorial(tut_type type)
     }
 
     // Set the scent map to 0.
-    for (auto& row : grscent) {
-        for (int& element : row) {
-            element = 0;
-        }
-    }
+    grscent.clear();
 
     temp = 65; // Kind of cool for June, but okay.
     in_tutorial = true;
@@ -456,6 +472,7 @@ bool Game::do_turn()
     if (is_game_over())
         return true;
     turn++;
+    fov_stale = true;
     process_events();
     if (in_tutorial) {
         if (turn == 1) {
@@ -536,16 +553,19 @@ bool Game::do_turn()
     u.suffer(this);
     check_warmth();
     update_skills();
-    if (u.has_disease(DI_SLEEP)) {
+    if (u.has_disease(DI_SLEEP) && !headless) {
         draw();
         refresh();
     }
     process_activity();
     if (is_game_over())
         return true;
+    prefetch_map();
     while (u.moves > 0) {
-        draw();
+        if (!headless)
+            draw();
         get_input();
+        fov_stale = true;
         if (is_game_over())
             return true;
     }
@@ -555,6 +575,7 @@ bool Game::do_turn()
 
 void Game::update_skills()
 {
+    const ProfileScope profile {Phase::skills};
     //    SKILL   TURNS/--
     //	1	2048
     //	2	1024
@@ -591,6 +612,7 @@ void Game::update_skills()
 
 void Game::process_events()
 {
+    const ProfileScope profile {Phase::events};
     for (std::size_t i {0}; i < events.size(); ++i) {
         if (events[i].turn <= static_cast<int>(turn)) {
             events[i].actualize(this);
@@ -602,11 +624,13 @@ void Game::process_events()
 
 void Game::process_activity()
 {
+    const ProfileScope profile {Phase::activity};
     it_gun* reloading {nullptr};
     it_book* reading {nullptr};
 
     if (u.activity.type != ACT_NULL) {
-        draw();
+        if (!headless)
+            draw();
         if (u.activity.type == ACT_WAIT) { // Based on time, not speed
             u.activity.moves_left -= 100;
             u.moves = 0;
@@ -693,6 +717,7 @@ void Game::cancel_activity_query(std::string message)
 
 void Game::get_input()
 {
+    const ProfileScope profile {Phase::input};
     char ch = input(); // See keypress.h
 
     // These are the default characters for all actions.  It's the job of input(),
@@ -778,7 +803,7 @@ void Game::get_input()
         }
 
         mvprintw(20, 0, "Turn %d; nextspawn %d", turn, nextspawn);
-        getch();
+        get_key();
     } else if (ch == 'Z')
         wish();
     else if (ch == 'G') {
@@ -795,11 +820,13 @@ void Game::get_input()
         debugmon = !debugmon;
     else if (ch == '\'') {
         display_scent();
-        getch();
+        get_key();
     } else if (ch == '*')
         teleport();
     else if (ch == '%')
         disp_kills();
+    else if (ch == 'P')
+        disp_profile();
     // </DEBUG>
     else if (ch == ':' || ch == 'm')
         draw_overmap();
@@ -853,43 +880,26 @@ int& Game::scent(int x, int y)
         nulscent = 0;
         return nulscent; // Out-of-bounds - null scent
     }
-    return grscent[x][y];
+    return grscent.at(x, y);
 }
 
 void Game::update_scent()
 {
-    signed int newscent[SEEX * 3][SEEY * 3];
-    int x, y, i, j, squares_used;
+    const ProfileScope profile {Phase::scent};
     if (!u.has_active_bionic(bio_scent_mask))
         scent(u.posx, u.posy) = u.scent;
     else
         scent(u.posx, u.posy) = 0;
-    for (x = 0; x < SEEX * 3; x++) {
-        for (y = 0; y < SEEY * 3; y++) {
-            newscent[x][y] = 0;
-            squares_used = 0;
-            for (i = -1; i <= 1; i++) {
-                for (j = -1; j <= 1; j++) {
-                    if ((m.move_cost(x, y) != 0 || m.has_flag(bashable, x, y))
-                        && scent(x, y) <= scent(x + i, y + j)) {
-                        newscent[x][y] += scent(x + i, y + j);
-                        squares_used++;
-                    }
-                }
-            }
-            newscent[x][y] /= (squares_used + 1);
-            if (m.field_at(x, y).type == fd_slime && newscent[x][y] < 10 * m.field_at(x, y).density)
-                newscent[x][y] = 10 * m.field_at(x, y).density;
-            if (newscent[x][y] > 10000) {
-                debugmsg("Wacky scent at %d, %d (%d)", x, y, newscent[x][y]);
-                newscent[x][y] = 0; // Scent should never be higher
-            }
+    // Scent gets into anything passable or bashable; slime keeps a square smelly.
+    for (int y = 0; y < SEEY * 3; y++) {
+        for (int x = 0; x < SEEX * 3; x++) {
+            const field& fd = std::as_const(m).field_at(x, y);
+            grscent.set_square(x, y, m.move_cost(x, y) != 0 || m.has_flag(bashable, x, y),
+                               fd.type == fd_slime ? 10 * fd.density : ScentMap::no_floor);
         }
     }
-    for (x = 0; x < SEEX * 3; x++) {
-        for (y = 0; y < SEEY * 3; y++)
-            scent(x, y) = newscent[x][y];
-    }
+    if (const int reset = grscent.diffuse(); reset > 0)
+        debugmsg("Wacky scent on %d squares", reset); // Scent should never be higher
     if (!u.has_active_bionic(bio_scent_mask))
         scent(u.posx, u.posy) = u.scent;
     else
@@ -940,10 +950,10 @@ void Game::load(std::string name)
     last_target = tmptar;
     temp = tmptemp;
 
-    // Next, the scent map.
-    for (auto& row : grscent) {
-        for (int& element : row) {
-            fin >> element;
+    // Next, the scent map, one column after another.
+    for (int x = 0; x < SEEX * 3; x++) {
+        for (int y = 0; y < SEEY * 3; y++) {
+            fin >> grscent.at(x, y);
         }
     }
 
@@ -953,6 +963,7 @@ void Game::load(std::string name)
     // ... and the data on each one.
     std::string data;
     z.clear();
+    mon_grid.invalidate();
     Monster montmp;
     char junk;
     if (fin.peek() == '\n')
@@ -1007,10 +1018,10 @@ void Game::save()
          << nextinv << " " << nextspawn << " " << int(temp) << " " << levx << " " << levy << " "
          << levz << " " << cur_om.posx << " " << cur_om.posy << " " << std::endl;
 
-    // Next, the scent map.
-    for (const auto& row : grscent) {
-        for (const int element : row) {
-            fout << element << ' ';
+    // Next, the scent map, one column after another.
+    for (int x = 0; x < SEEX * 3; x++) {
+        for (int y = 0; y < SEEY * 3; y++) {
+            fout << grscent.at(x, y) << ' ';
         }
     }
 
@@ -1034,6 +1045,9 @@ void Game::save()
     // aaaand the overmap, and the local map.
     cur_om.save();
     m.save(&cur_om, turn, levx, levy);
+    overmap_cache().flush();
+    overmap_records().flush();
+    submap_records().flush();
 }
 
 void Game::advance_nextinv()
@@ -1110,7 +1124,7 @@ void Game::groupdebug()
         }
     }
 
-    getch();
+    get_key();
 }
 
 void Game::draw_overmap()
@@ -1122,7 +1136,10 @@ void Game::draw_overmap()
     int cursx = (levx + 1) / 2, cursy = (levy + 1) / 2;
     int origx = cursx, origy = cursy;
     char ch {};
-    overmap hori, vert, diag;
+    // Neighbouring overmaps come from the cache, so redrawing near an edge doesn't reread them.
+    auto hori {std::make_shared<overmap>()};
+    auto vert {hori};
+    auto diag {hori};
     do {
         int omx, omy;
         bool seen;
@@ -1130,23 +1147,23 @@ void Game::draw_overmap()
         nc_color ter_color;
         long ter_sym;
         if (cursx < 40) {
-            hori = overmap(this, cur_om.posx - 1, cur_om.posy, 0);
+            hori = overmap_cache().get(this, cur_om.posx - 1, cur_om.posy, 0);
             if (cursy < 12)
-                diag = overmap(this, cur_om.posx - 1, cur_om.posy - 1, 0);
+                diag = overmap_cache().get(this, cur_om.posx - 1, cur_om.posy - 1, 0);
             if (cursy > OMAPY - 13)
-                diag = overmap(this, cur_om.posx - 1, cur_om.posy + 1, 0);
+                diag = overmap_cache().get(this, cur_om.posx - 1, cur_om.posy + 1, 0);
         }
         if (cursx > OMAPX - 41) {
-            hori = overmap(this, cur_om.posx + 1, cur_om.posy, 0);
+            hori = overmap_cache().get(this, cur_om.posx + 1, cur_om.posy, 0);
             if (cursy < 12)
-                diag = overmap(this, cur_om.posx + 1, cur_om.posy - 1, 0);
+                diag = overmap_cache().get(this, cur_om.posx + 1, cur_om.posy - 1, 0);
             if (cursy > OMAPY - 13)
-                diag = overmap(this, cur_om.posx + 1, cur_om.posy + 1, 0);
+                diag = overmap_cache().get(this, cur_om.posx + 1, cur_om.posy + 1, 0);
         }
         if (cursy < 12)
-            vert = overmap(this, cur_om.posx, cur_om.posy - 1, 0);
+            vert = overmap_cache().get(this, cur_om.posx, cur_om.posy - 1, 0);
         if (cursy > OMAPY - 13)
-            vert = overmap(this, cur_om.posx, cur_om.posy + 1, 0);
+            vert = overmap_cache().get(this, cur_om.posx, cur_om.posy + 1, 0);
         for (int i = -40; i < 40; i++) {
             for (int j = -12; j <= (ch == 'j' ? 13 : 12); j++) {
                 omx = cursx + i;
@@ -1172,53 +1189,53 @@ void Game::draw_overmap()
                     omx += OMAPX;
                     if (omy < 0 || omy >= OMAPY) {
                         omy += (omy < 0 ? OMAPY : 0 - OMAPY);
-                        cur_ter = diag.ter(omx, omy);
-                        seen = diag.seen(omx, omy);
+                        cur_ter = diag->ter(omx, omy);
+                        seen = diag->seen(omx, omy);
 
-                        if ((note_here = diag.has_note(omx, omy))) {
-                            note = diag.note(omx, omy);
+                        if ((note_here = diag->has_note(omx, omy))) {
+                            note = diag->note(omx, omy);
                         }
                     } else {
-                        cur_ter = hori.ter(omx, omy);
-                        seen = hori.seen(omx, omy);
+                        cur_ter = hori->ter(omx, omy);
+                        seen = hori->seen(omx, omy);
 
-                        if ((note_here = hori.has_note(omx, omy))) {
-                            note = hori.note(omx, omy);
+                        if ((note_here = hori->has_note(omx, omy))) {
+                            note = hori->note(omx, omy);
                         }
                     }
                 } else if (omx >= OMAPX) {
                     omx -= OMAPX;
                     if (omy < 0 || omy >= OMAPY) {
                         omy += (omy < 0 ? OMAPY : 0 - OMAPY);
-                        cur_ter = diag.ter(omx, omy);
-                        seen = diag.seen(omx, omy);
+                        cur_ter = diag->ter(omx, omy);
+                        seen = diag->seen(omx, omy);
 
-                        if ((note_here = diag.has_note(omx, omy))) {
-                            note = diag.note(omx, omy);
+                        if ((note_here = diag->has_note(omx, omy))) {
+                            note = diag->note(omx, omy);
                         }
                     } else {
-                        cur_ter = hori.ter(omx, omy);
-                        seen = hori.seen(omx, omy);
+                        cur_ter = hori->ter(omx, omy);
+                        seen = hori->seen(omx, omy);
 
-                        if ((note_here = hori.has_note(omx, omy))) {
-                            note = hori.note(omx, omy);
+                        if ((note_here = hori->has_note(omx, omy))) {
+                            note = hori->note(omx, omy);
                         }
                     }
                 } else if (omy < 0) {
                     omy += OMAPY;
-                    cur_ter = vert.ter(omx, omy);
-                    seen = vert.seen(omx, omy);
+                    cur_ter = vert->ter(omx, omy);
+                    seen = vert->seen(omx, omy);
 
-                    if ((note_here = vert.has_note(omx, omy))) {
-                        note = vert.note(omx, omy);
+                    if ((note_here = vert->has_note(omx, omy))) {
+                        note = vert->note(omx, omy);
                     }
                 } else if (omy >= OMAPY) {
                     omy -= OMAPY;
-                    cur_ter = vert.ter(omx, omy);
-                    seen = vert.seen(omx, omy);
+                    cur_ter = vert->ter(omx, omy);
+                    seen = vert->seen(omx, omy);
 
-                    if ((note_here = vert.has_note(omx, omy))) {
-                        note = vert.note(omx, omy);
+                    if ((note_here = vert->has_note(omx, omy))) {
+                        note = vert->note(omx, omy);
                     }
                 } else
                     debugmsg("No data loaded! omx: %d omy: %d", omx, omy);
@@ -1307,6 +1324,7 @@ void Game::draw_overmap()
             cursy = origy;
         } else if (ch == '\n') {
             z.clear();
+            mon_grid.invalidate();
             m.save(&cur_om, turn, levx, levy);
             levx = cursx * 2;
             levy = cursy * 2;
@@ -1372,7 +1390,7 @@ void Game::disp_kills()
     if (types.size() == 0) {
         mvwprintz(w, 2, 2, c_white, "You haven't killed any monsters yet!");
         wrefresh(w);
-        getch();
+        get_key();
         werase(w);
         wrefresh(w);
         delwin(w);
@@ -1406,7 +1424,29 @@ void Game::disp_kills()
     }
 
     wrefresh(w);
-    getch();
+    get_key();
+    werase(w);
+    wrefresh(w);
+    delwin(w);
+    refresh_all();
+}
+
+void Game::disp_profile()
+{
+    WINDOW* w = newwin(25, 80, 0, 0);
+    mvwprintz(w, 0, 33, c_red, "TURN PROFILE:");
+    mvwprintz(w, 2, 0, c_white, "%s", Profiler::table_header().c_str());
+
+    for (int i = 0; i < static_cast<int>(Phase::count); i++) {
+        const auto phase {static_cast<Phase>(i)};
+        mvwprintz(w, 3 + i, 0, profiler().totals(phase).calls == 0 ? c_dkgray : c_ltgray, "%s",
+                  profiler().table_row(phase).c_str());
+    }
+
+    mvwprintz(w, 24, 0, c_dkgray, "p50 and p99 are of the last %u to %u calls of each.",
+              profiler().window(), profiler().window() * 2);
+    wrefresh(w);
+    get_key();
     werase(w);
     wrefresh(w);
     delwin(w);
@@ -1441,7 +1481,7 @@ void Game::disp_NPCs()
                   closest[i]->mapy);
 
     wrefresh(w);
-    getch();
+    get_key();
     werase(w);
     wrefresh(w);
     delwin(w);
@@ -1598,7 +1638,7 @@ void Game::tutorial_message(tut_lesson lesson)
 void Game::draw()
 {
     // Draw map
-    werase(w_terrain);
+    fov_stale = true; // Once per frame keeps up with doors, smoke and the like
     draw_ter();
     mon_info();
     // Draw Status
@@ -1631,7 +1671,10 @@ void Game::draw()
 void Game::draw_ter()
 {
     int t = 0;
-    m.draw(this, w_terrain);
+    update_fov();
+    // The whole frame goes to the back buffer, and only the squares that changed to the screen
+    werase(w_terrain_back);
+    m.draw(this, w_terrain_back);
 
     // Draw monsters
     int distx, disty;
@@ -1641,11 +1684,11 @@ void Game::draw_ter()
         distx = std::abs(monster.posx - u.posx);
 
         if (distx <= SEEX && disty <= SEEY && u_see(&monster, t)) {
-            monster.draw(w_terrain, u.posx, u.posy, /*inv=*/false);
+            monster.draw(w_terrain_back, u.posx, u.posy, /*inv=*/false);
         } else if (monster.has_flag(m_flags::MF_WARM) && distx <= SEEX && disty <= SEEY
                    && (u.has_active_bionic(bionic_id::bio_infrared)
                        || u.has_trait(pl_flag::PF_INFRARED))) {
-            mvwputch(w_terrain, SEEY + monster.posy - u.posy, SEEX + monster.posx - u.posx,
+            mvwputch(w_terrain_back, SEEY + monster.posy - u.posy, SEEX + monster.posx - u.posx,
                      nc_color::c_red, '?');
         }
     }
@@ -1656,13 +1699,13 @@ void Game::draw_ter()
         distx = std::abs(npc.posx - u.posx);
 
         if (distx <= SEEX && disty <= SEEY && u_see(npc.posx, npc.posy, t)) {
-            npc.draw(w_terrain, u.posx, u.posy, /*inv=*/false);
+            npc.draw(w_terrain_back, u.posx, u.posy, /*inv=*/false);
         }
     }
 
+    wpresent(w_terrain_back, w_terrain);
     if (u.has_disease(DI_VISUALS))
         hallucinate();
-    wrefresh(w_terrain);
     if (in_tutorial && light_level() == 1) {
         if (u.has_amount(itm_flashlight, 1))
             tutorial_message(LESSON_DARK);
@@ -1673,8 +1716,10 @@ void Game::draw_ter()
 
 void Game::refresh_all()
 {
+    panels_stale = true;
     draw();
     draw_minimap();
+    panels_stale = false;
     wrefresh(w_HP);
     wrefresh(w_moninfo);
     wrefresh(w_messages);
@@ -1683,6 +1728,20 @@ void Game::refresh_all()
 
 void Game::draw_HP()
 {
+    // Unchanged since last time: just put back anything drawn over it
+    std::array<int, num_hp_parts * 2 + 3> shown;
+    for (int i = 0; i < num_hp_parts; i++) {
+        shown[i * 2] = u.hp_cur[i];
+        shown[i * 2 + 1] = u.hp_max[i];
+    }
+    shown[num_hp_parts * 2] = u.power_level;
+    shown[num_hp_parts * 2 + 1] = u.max_power_level;
+    shown[num_hp_parts * 2 + 2] = u.has_trait(PF_HPIGNORANT);
+    if (shown == hp_shown && !panels_stale) {
+        wpresent(w_HP, w_HP);
+        return;
+    }
+    hp_shown = shown;
     int curhp;
     nc_color col;
     for (int i = 0; i < num_hp_parts; i++) {
@@ -1738,6 +1797,15 @@ void Game::draw_HP()
 
 void Game::draw_minimap()
 {
+    int cursx = (levx + 1) / 2;
+    int cursy = (levy + 1) / 2;
+    // What's around only gets seen by moving, so the same square shows the same minimap
+    const std::array<int, 5> shown {cur_om.posx, cur_om.posy, cur_om.posz, cursx, cursy};
+    if (shown == minimap_shown && !panels_stale) {
+        wpresent(w_minimap, w_minimap);
+        return;
+    }
+    minimap_shown = shown;
     // Draw the box
     werase(w_minimap);
     mvwputch(w_minimap, 0, 0, c_white, LINE_OXXO);
@@ -1751,23 +1819,23 @@ void Game::draw_minimap()
         mvwputch(w_minimap, 6, i, c_white, LINE_OXOX);
     }
 
-    int cursx = (levx + 1) / 2;
-    int cursy = (levy + 1) / 2;
     int omx, omy;
     auto cur_ter {oter_id::ot_null};
     nc_color ter_color;
     long ter_sym;
     bool seen = true;
-    overmap hori;
-    overmap vert;
+    // Neighbouring overmaps are shared through the cache and only read here; seeing into them
+    // from the minimap doesn't mark anything.
+    std::shared_ptr<overmap> hori;
+    std::shared_ptr<overmap> vert;
     if (cursx < 2)
-        hori = overmap(this, cur_om.posx - 1, cur_om.posy, 0);
+        hori = overmap_cache().get(this, cur_om.posx - 1, cur_om.posy, 0);
     if (cursx > OMAPX - 3)
-        hori = overmap(this, cur_om.posx + 1, cur_om.posy, 0);
+        hori = overmap_cache().get(this, cur_om.posx + 1, cur_om.posy, 0);
     if (cursy < 2)
-        vert = overmap(this, cur_om.posx, cur_om.posy - 1, 0);
+        vert = overmap_cache().get(this, cur_om.posx, cur_om.posy - 1, 0);
     if (cursy > OMAPY - 3)
-        vert = overmap(this, cur_om.posx, cur_om.posy + 1, 0);
+        vert = overmap_cache().get(this, cur_om.posx, cur_om.posy + 1, 0);
     for (int i = -1; i <= 1; i++) {
         for (int j = -1; j <= 1; j++) {
             omx = cursx + i;
@@ -1779,20 +1847,16 @@ void Game::draw_minimap()
                 cur_ter = ot_null;
             } else if (omx < 0) {
                 omx += OMAPX;
-                cur_ter = hori.ter(omx, omy);
-                hori.seen(omx, omy) = true;
+                cur_ter = hori->ter(omx, omy);
             } else if (omx >= OMAPX) {
                 omx -= OMAPX;
-                cur_ter = hori.ter(omx, omy);
-                hori.seen(omx, omy) = true;
+                cur_ter = hori->ter(omx, omy);
             } else if (omy < 0) {
                 omy += OMAPY;
-                cur_ter = vert.ter(omx, omy);
-                vert.seen(omx, omy) = true;
+                cur_ter = vert->ter(omx, omy);
             } else if (omy >= OMAPY) {
                 omy -= OMAPY;
-                cur_ter = vert.ter(omx, omy);
-                vert.seen(omx, omy) = true;
+                cur_ter = vert->ter(omx, omy);
             } else {
                 debugmsg("No data loaded! omx: %d omy: %d", omx, omy);
             }
@@ -1826,16 +1890,16 @@ void Game::draw_minimap()
                     cur_ter = ot_null;
                 } else if (barx < 0) {
                     barx += OMAPX;
-                    cur_ter = hori.ter(barx, bary);
+                    cur_ter = hori->ter(barx, bary);
                 } else if (barx >= OMAPX) {
                     barx -= OMAPX;
-                    cur_ter = hori.ter(barx, bary);
+                    cur_ter = hori->ter(barx, bary);
                 } else if (bary < 0) {
                     bary += OMAPY;
-                    cur_ter = vert.ter(barx, bary);
+                    cur_ter = vert->ter(barx, bary);
                 } else if (bary >= OMAPY) {
                     bary -= OMAPY;
-                    cur_ter = vert.ter(barx, bary);
+                    cur_ter = vert->ter(barx, bary);
                 }
                 if (oterlist[cur_ter].see_cost <= 2 || seen) {
                     if (omx >= 0 && omx < OMAPX && omy >= 0 && omy < OMAPY) {
@@ -1845,20 +1909,16 @@ void Game::draw_minimap()
                         cur_ter = ot_null;
                     } else if (omx < 0) {
                         omx += OMAPX;
-                        cur_ter = hori.ter(omx, omy);
-                        hori.seen(omx, omy) = true;
+                        cur_ter = hori->ter(omx, omy);
                     } else if (omx >= OMAPX) {
                         omx -= OMAPX;
-                        cur_ter = hori.ter(omx, omy);
-                        hori.seen(omx, omy) = true;
+                        cur_ter = hori->ter(omx, omy);
                     } else if (omy < 0) {
                         omy += OMAPY;
-                        cur_ter = vert.ter(omx, omy);
-                        vert.seen(omx, omy) = true;
+                        cur_ter = vert->ter(omx, omy);
                     } else if (omy >= OMAPY) {
                         omy -= OMAPY;
-                        cur_ter = vert.ter(omx, omy);
-                        vert.seen(omx, omy) = true;
+                        cur_ter = vert->ter(omx, omy);
                     }
                     ter_color = oterlist[cur_ter].color;
                     ter_sym = oterlist[cur_ter].sym;
@@ -1872,9 +1932,12 @@ void Game::draw_minimap()
 
 void Game::hallucinate()
 {
+    // One roll a square, drawn together
+    std::array<int, (SEEX * 2 + 2) * (SEEY * 2 + 2)> rolls;
+    rng_fill(0, 9, rolls);
     for (int i = 0; i <= SEEX * 2 + 1; i++) {
         for (int j = 0; j <= SEEY * 2 + 1; j++) {
-            if (one_in(10)) {
+            if (rolls[i * (SEEY * 2 + 2) + j] == 0) {
                 char ter_sym = terlist[m.ter(i + rng(-2, 2), j + rng(-2, 2))].sym;
                 nc_color ter_col = terlist[m.ter(i + rng(-2, 2), j + rng(-2, 2))].color;
                 mvwputch(w_terrain, j, i, ter_col, ter_sym);
@@ -1919,7 +1982,11 @@ bool Game::u_see(int x, int y, int& t)
 {
     // if (debugmon)
     // debugmsg("u_see range %d (light level %d)", u.sight_range(light_level()), light_level());
-    return m.sees(u.posx, u.posy, x, y, u.sight_range(light_level()), t);
+    if (!u_fov.inside(x, y))
+        return m.sees(u.posx, u.posy, x, y, u.sight_range(light_level()), t);
+    update_fov();
+    t = 0;
+    return u_fov.visible(x, y);
 }
 
 bool Game::u_see(Monster* mon, int& t)
@@ -1927,8 +1994,48 @@ bool Game::u_see(Monster* mon, int& t)
     if (mon->has_flag(MF_DIGS) && !u.has_active_bionic(bio_ground_sonar)
         && rl_dist(u.posx, u.posy, mon->posx, mon->posy) > 1)
         return false; // Can't see digging monsters until we're right next to them
-    int range = u.sight_range(light_level());
-    return m.sees(u.posx, u.posy, mon->posx, mon->posy, range, t);
+    return u_see(mon->posx, mon->posy, t);
+}
+
+void Game::update_fov()
+{
+    const int range = u.sight_range(light_level());
+    if (!fov_stale && u_fov.originx() == u.posx && u_fov.originy() == u.posy
+        && u_fov.range() == range)
+        return;
+    u_fov.compute(u.posx, u.posy, range, [this](int x, int y) { return m.trans(x, y); });
+    fov_stale = false;
+}
+
+void Game::update_flow()
+{
+    u_flow.compute({Point(u.posx, u.posy)}, [this](int x, int y) { return m.move_cost(x, y); });
+}
+
+void Game::hear_noises()
+{
+    if (noises.empty())
+        return;
+    // Walls, doors and the like muffle sound rather than stop it
+    noises.resolve([this](int x, int y) { return m.move_cost(x, y) == 0 ? 3 : 1; });
+
+    for (auto& monster : z) {
+        if (!monster.has_flag(m_flags::MF_HEARS))
+            continue;
+        const auto heard = noises.heard(monster.posx, monster.posy);
+        if (!heard)
+            continue;
+        const int dist = heard->distance;
+
+        if (monster.has_flag(m_flags::MF_GOODHEARING) && dist / 2 <= heard->volume) {
+            monster.wander_to(heard->source.x, heard->source.y, heard->volume - dist / 2);
+        } else if (dist <= heard->volume && dist >= 2) {
+            // Adjacent sounds are likely cause by us.
+            monster.wander_to(heard->source.x, heard->source.y, heard->volume - dist);
+        }
+    }
+
+    noises.clear();
 }
 
 bool Game::pl_sees(player* p, Monster* mon, int& t)
@@ -2020,7 +2127,6 @@ bool vector_has(std::vector<int> vec, int test)
 
 void Game::mon_info()
 {
-    werase(w_moninfo);
     int buff;
     int newseen = 0;
     // 0 1 2
@@ -2110,6 +2216,22 @@ void Game::mon_info()
             run_mode = 2; // Stop movement!
     }
     mostseen = newseen;
+    // The same types in the same directions make the same list, but NPCs can change under it
+    std::vector<int> shown;
+    bool npcs_shown = false;
+    for (int i = 0; i < 9; i++) {
+        shown.push_back(-1 - i);
+        for (const int type : unique_types[i]) {
+            shown.push_back(type);
+            npcs_shown |= type < 0;
+        }
+    }
+    if (shown == moninfo_shown && !npcs_shown && !panels_stale) {
+        wpresent(w_moninfo, w_moninfo);
+        return;
+    }
+    moninfo_shown = std::move(shown);
+    werase(w_moninfo);
     int line = 0;
     nc_color tmpcol;
     for (int i = 0; i < 9; i++) {
@@ -2178,12 +2300,23 @@ void Game::mon_info()
 
 void Game::monmove()
 {
+    const ProfileScope profile {Phase::monsters};
+    const RngScope scope {RngStream::ai};
+    hear_noises();
+    // One field for the whole horde, rather than a path apiece
+    if (!z.empty())
+        update_flow();
+    // Monsters killed or lost along the way are only flagged, so everyone keeps their index
+    holding_dead = true;
     for (std::size_t i {0}; i < z.size(); ++i) {
         if (i > z.size()) {
             debugmsg("Moving out of bounds monster! i %d, z.size() %d", i, z.size());
         }
 
-        while (!z[i].can_move_to(m, z[i].posx, z[i].posy) && i < z.size()) {
+        if (z[i].dead) // Killed by someone who moved earlier
+            continue;
+
+        while (!z[i].dead && !z[i].can_move_to(m, z[i].posx, z[i].posy)) {
             // If we can't move to our current position, assign us to a new one
             bool okay = false;
             int xdir = rng(1, 2) * 2 - 3, ydir = rng(1, 2) * 2 - 3; // -1 or 1
@@ -2192,30 +2325,28 @@ void Game::monmove()
             for (int x = startx; x != endx && !okay; x += xdir) {
                 for (int y = starty; y != endy && !okay; y += ydir) {
                     if (z[i].can_move_to(m, x, y)) {
+                        const int oldx {z[i].posx};
+                        const int oldy {z[i].posy};
                         z[i].posx = x;
                         z[i].posy = y;
+                        mon_grid.moved(z[i], oldx, oldy);
                         okay = true;
                     }
                 }
             }
             if (!okay)
-                z.erase(z.begin() + i); // Delete us if no replacement found
+                remove_mon(i); // Delete us if no replacement found
         }
 
-        bool dead = false;
-        while (z[i].moves > 0 && !dead) {
+        while (z[i].moves > 0 && !z[i].dead) {
             z[i].plan(this); // Formulate a path to follow
             z[i].move(this); // Move one square, possibly hit u
             m.mon_in_field(z[i].posx, z[i].posy, &z[i]);
 
-            if (z[i].hurt(0)) { // Maybe we died...
+            if (z[i].hurt(0)) // Maybe we died...
                 kill_mon(i);
-                dead = true;
-            }
         }
-        if (dead)
-            i--;
-        else {
+        if (!z[i].dead) {
             if (in_tutorial && u.pain > 0)
                 tutorial_message(LESSON_PAIN);
             if (u.has_active_bionic(bio_alarm) && u.power_level >= 1 && abs(z[i].posx - u.posx) <= 5
@@ -2240,18 +2371,20 @@ void Game::monmove()
                     cur_om.zg.push_back(
                         mongroup(mt_to_mc((mon_id)(z[i].type->id)), levx, levy, 1, 1));
                 }
-                z.erase(z.begin() + i);
-                i--;
+                remove_mon(i);
             } else
                 z[i].moves += z[i].speed;
         }
     }
+    holding_dead = false;
+    erase_dead();
 
     // Now, do active NPCs.
     for (std::size_t i {0}; i < active_npc.size(); ++i) {
         if (active_npc[i].hp_cur[hp_head] <= 0 || active_npc[i].hp_cur[hp_torso] <= 0) {
             active_npc[i].die(this);
             active_npc.erase(active_npc.begin() + static_cast<std::ptrdiff_t>(i));
+            npc_grid.invalidate();
             --i;
         } else {
             active_npc[i].reset();
@@ -2266,6 +2399,7 @@ void Game::monmove()
 
 void Game::om_npcs_move()
 {
+    const ProfileScope profile {Phase::npcs};
     /*
      for (int i = 0; i < cur_om.npcs.size(); i++) {
       cur_om.npcs[i].perform_mission(this);
@@ -2282,6 +2416,7 @@ void Game::om_npcs_move()
 
 void Game::check_warmth()
 {
+    const ProfileScope profile {Phase::warmth};
     // HEAD
     int warmth = u.warmth(bp_head) + int((temp - 65) / 10);
     if (warmth <= -6) {
@@ -2379,22 +2514,10 @@ void Game::check_warmth()
 
 void Game::sound(int x, int y, int vol, std::string description)
 {
-    // First, alert all monsters (that can hear) to the sound
+    // First, queue it for the monsters (that can hear); they hear everything at once
+    noises.add(x, y, vol);
     double dist;
 
-    for (auto& monster : z) {
-        if (monster.has_flag(m_flags::MF_HEARS)) {
-            dist = trig_dist(x, y, monster.posx, monster.posy);
-
-            if (monster.has_flag(m_flags::MF_GOODHEARING) && static_cast<int>(dist) / 2 <= vol) {
-                monster.wander_to(x, y, vol - (static_cast<int>(dist) / 2));
-            } else if (dist <= vol && dist >= 2) {
-                // Adjacent sounds are likely cause by us.
-                monster.wander_to(x, y, static_cast<int>(vol - dist));
-            }
-        }
-    }
-
     // Loud sounds make the next spawn sooner!
     if (vol >= 20 && nextspawn > vol + 20) {
         int max = (vol - 20);
@@ -2437,6 +2560,7 @@ void Game::sound(int x, int y, int vol, std::string description)
 
 void Game::explosion(int x, int y, int power, int shrapnel, bool fire)
 {
+    const RngScope scope {RngStream::combat};
     timespec ts; // Timespec for the animation of the explosion
     ts.tv_sec = 0;
     ts.tv_nsec = EXPLOSION_SPEED;
@@ -2477,7 +2601,7 @@ void Game::explosion(int x, int y, int power, int shrapnel, bool fire)
             }
         }
     }
-    for (int i = 1; i <= radius; i++) {
+    for (int i = 1; i <= radius && !headless; i++) { // Nobody to see the blast in a headless game
         mvwputch(w_terrain, y - i + SEEY - u.posy, x - i + SEEX - u.posx, c_red, '/');
         mvwputch(w_terrain, y - i + SEEY - u.posy, x + i + SEEX - u.posx, c_red, '\\');
         mvwputch(w_terrain, y + i + SEEY - u.posy, x - i + SEEX - u.posx, c_red, '\\');
@@ -2510,7 +2634,7 @@ void Game::explosion(int x, int y, int power, int shrapnel, bool fire)
         for (std::size_t j {0}; j < traj.size(); ++j) {
             if (i > 0)
                 m.drawsq(w_terrain, u, traj[i - 1].x, traj[i - 1].y, false, true);
-            if (u_see(traj[i].x, traj[i].y, ijunk)) {
+            if (!headless && u_see(traj[i].x, traj[i].y, ijunk)) {
                 mvwputch(w_terrain, traj[i].y + SEEY - u.posy, traj[i].x + SEEX - u.posx, c_red,
                          '`');
                 wrefresh(w_terrain);
@@ -2534,6 +2658,7 @@ void Game::explosion(int x, int y, int power, int shrapnel, bool fire)
                     || active_npc[npcdex].hp_cur[hp_torso] <= 0) {
                     active_npc[npcdex].die(this);
                     active_npc.erase(active_npc.begin() + npcdex);
+                    npc_grid.invalidate();
                 }
             } else {
                 m.shoot(this, tx, ty, dam, j == traj.size() - 1);
@@ -2599,7 +2724,7 @@ void Game::use_computer(int x, int y)
             for (int i = 0; i < SEEX * 3; i++) {
                 for (int j = 0; j < SEEY * 3; j++) {
                     if (m.ter(i, j) == t_reinforced_glass_h || m.ter(i, j) == t_reinforced_glass_v)
-                        m.ter(i, j) = t_floor;
+                        m.set_ter(i, j, t_floor);
                 }
             }
             break;
@@ -2725,7 +2850,7 @@ void Game::use_computer(int x, int y)
                 full_screen_popup(log.c_str());
             } else if (one_in(4)) {
                 add_msg("ERROR - OS CORRUPTED!");
-                m.ter(x, y) = t_computer_broken;
+                m.set_ter(x, y, t_computer_broken);
             } else
                 add_msg("Access denied.");
             break;
@@ -2743,17 +2868,17 @@ void Game::use_computer(int x, int y)
                     miny = 0;
                 if (maxy >= OMAPY)
                     maxy = OMAPY - 1;
-                overmap tmp(this, cur_om.posx, cur_om.posy, 0);
+                const auto tmp {overmap_cache().get(this, cur_om.posx, cur_om.posy, 0)};
                 for (int i = minx; i <= maxx; i++) {
                     for (int j = miny; j <= maxy; j++)
-                        tmp.seen(i, j) = true;
+                        tmp->seen(i, j) = true;
                 }
-                tmp.save(cur_om.posx, cur_om.posy, 0);
+                overmap_cache().mark_dirty(cur_om.posx, cur_om.posy, 0);
                 add_msg("Surface map data downloaded.");
             } else {
                 add_msg("Surface map data corrupted.");
                 if (one_in(4)) {
-                    m.ter(x, y) = t_computer_broken;
+                    m.set_ter(x, y, t_computer_broken);
                     add_msg("The computer breaks down!");
                 }
             }
@@ -2857,7 +2982,7 @@ void Game::emp_blast(int x, int y)
     int rn;
     if (m.has_flag(computer, x, y)) {
         add_msg("The %s is rendered non-functional!", m.tername(x, y).c_str());
-        m.ter(x, y) = t_computer_broken;
+        m.set_ter(x, y, t_computer_broken);
         return;
     }
 
@@ -2867,14 +2992,14 @@ void Game::emp_blast(int x, int y)
         rn = rng(1, 100);
         if (rn > 92 || rn < 50) {
             add_msg("The card reader is rendered non-functional.");
-            m.ter(x, y) = t_card_reader_broken;
+            m.set_ter(x, y, t_card_reader_broken);
         }
         if (rn > 90) {
             add_msg("The nearby doors slide open!");
             for (int i = -5; i <= 5; i++) {
                 for (int j = -5; j <= 5; j++) {
                     if (m.ter(x + i, y + j) == t_door_metal_locked)
-                        m.ter(x + i, y + j) = t_floor;
+                        m.set_ter(x + i, y + j, t_floor);
                 }
             }
         }
@@ -2912,27 +3037,9 @@ void Game::emp_blast(int x, int y)
     // TODO: Drain NPC energy reserves
 }
 
-int Game::npc_at(int x, int y)
-{
-    for (std::size_t i {0}; i < active_npc.size(); ++i) {
-        if (active_npc[i].posx == x && active_npc[i].posy == y) {
-            return static_cast<int>(i);
-        }
-    }
-
-    return -1;
-}
-
-int Game::mon_at(int x, int y)
-{
-    for (std::size_t i {0}; i < z.size(); ++i) {
-        if (z[i].posx == x && z[i].posy == y) {
-            return static_cast<int>(i);
-        }
-    }
+int Game::npc_at(int x, int y) { return npc_grid.at(x, y); }
 
-    return -1;
-}
+int Game::mon_at(int x, int y) { return mon_grid.at(x, y); }
 
 void Game::kill_mon(int index)
 {
@@ -2943,15 +3050,12 @@ void Game::kill_mon(int index)
 
     if (z[index].dead)
         return;
-    z[index].dead = true;
     kills[z[index].type->id]++; // Increment our kill counter
 
-    for (auto& npc : active_npc) {
-        if (npc.target == &z[index]) {
-            npc.target = nullptr;
-        }
-    }
-
+    // Dying can kill others in turn, so hold on to the bodies until it's over
+    const bool held {holding_dead};
+    holding_dead = true;
+    remove_mon(index);
     z[index].die(this);
     // If they left a corpse, give a tutorial message on butchering
     if (in_tutorial && !(tutorials_seen[LESSON_BUTCHER])) {
@@ -2962,11 +3066,35 @@ void Game::kill_mon(int index)
             }
         }
     }
-    z.erase(z.begin() + index);
-    if (last_target == index)
-        last_target = -1;
-    else if (last_target > index)
-        last_target--;
+    holding_dead = held;
+    erase_dead();
+}
+
+void Game::remove_mon(int index)
+{
+    if (z[index].dead)
+        return;
+    z[index].dead = true;
+    mon_grid.removed(z[index]);
+    dead_mons.push_back(index);
+    erase_dead();
+}
+
+void Game::erase_dead()
+{
+    if (holding_dead)
+        return;
+    // Highest first, so the monster moved into each gap is always one still alive
+    std::sort(dead_mons.begin(), dead_mons.end(), std::greater<> {});
+    for (const int index : dead_mons) {
+        z.erase(index);
+        mon_grid.swapped_out(index);
+        if (last_target == index)
+            last_target = -1;
+        else if (last_target == static_cast<int>(z.size()))
+            last_target = index;
+    }
+    dead_mons.clear();
 }
 
 void Game::open()
@@ -3147,7 +3275,7 @@ void Game::examine()
             for (int i = -5; i <= 5; i++) {
                 for (int j = -5; j <= 5; j++) {
                     if (m.ter(examx + i, examy + j) == t_door_metal_locked)
-                        m.ter(examx + i, examy + j) = t_floor;
+                        m.set_ter(examx + i, examy + j, t_floor);
                 }
             }
             add_msg("You insert your ID card.");
@@ -3180,7 +3308,7 @@ void Game::examine()
                         u.charge_power(0 - rng(0, u.power_level));
                     }
                 }
-                m.ter(examx, examy) = t_card_reader_broken;
+                m.set_ter(examx, examy, t_card_reader_broken);
             } else if (success < 6)
                 add_msg("Nothing happens.");
             else {
@@ -3189,7 +3317,7 @@ void Game::examine()
                 for (int i = -5; i <= 5; i++) {
                     for (int j = -5; j <= 5; j++) {
                         if (m.ter(examx + i, examy + j) == t_door_metal_locked)
-                            m.ter(examx + i, examy + j) = t_floor;
+                            m.set_ter(examx + i, examy + j, t_floor);
                     }
                 }
             }
@@ -3628,7 +3756,7 @@ void Game::pickup(int posx, int posy, int min)
             wprintz(w_pickup, c_white, "/%d", u.volume_capacity() - 2);
         }
         wrefresh(w_pickup);
-        ch = getch();
+        ch = get_key();
     } while (ch != ' ' && ch != '\n' && ch != KEY_ESCAPE);
     if (ch == KEY_ESCAPE) {
         werase(w_pickup);
@@ -3929,7 +4057,7 @@ char Game::inv(std::string title)
         }
 
         wrefresh(w_inv);
-        ch = getch();
+        ch = get_key();
     } while (ch == '<' || ch == '>');
     werase(w_inv);
     delwin(w_inv);
@@ -4003,6 +4131,7 @@ void Game::plthrow()
 
 void Game::throw_item(player& p, int tarx, int tary, Item& thrown, std::vector<Point>& trajectory)
 {
+    const RngScope scope {RngStream::combat};
     int deviation = 0;
     int trange = 1.5 * trig_dist(p.posx, p.posy, tarx, tary);
     if (p.sklevel[sk_throw] < 8)
@@ -4091,7 +4220,7 @@ void Game::throw_item(player& p, int tarx, int tary, Item& thrown, std::vector<P
                 m.add_item(tx, ty, thrown);
 
             if (index < trajectory.size() - 1) {
-                goodhit = static_cast<double>(rand() / RAND_MAX) / 2;
+                goodhit = rng_float(0, .5);
             }
 
             if (goodhit < .1 && !z[mon_at(tx, ty)].has_flag(MF_NOHEAD)) {
@@ -4216,6 +4345,7 @@ void Game::plfire(bool burst)
 
 void Game::fire(player& p, int tarx, int tary, std::vector<Point>& trajectory, bool burst)
 {
+    const RngScope scope {RngStream::combat};
     // If we aren't wielding a loaded gun, we can't shoot!
     Item ammotmp = Item(p.weapon.curammo, 0);
     ammotmp.charges = 1;
@@ -4412,7 +4542,7 @@ missed_by %f deviation %f trange %d charges %d myx %d myy %d monx %d mony %d",
                 m.drawsq(w_terrain, u, trajectory[i - 1].x, trajectory[i - 1].y, false, true);
             // Drawing the bullet uses player u, and not player p, because it's drawn
             // relative to YOUR position, which may not be the gunman's position.
-            if (u_see(trajectory[i].x, trajectory[i].y, junk)) {
+            if (!headless && u_see(trajectory[i].x, trajectory[i].y, junk)) {
                 mvwputch(w_terrain, trajectory[i].y + SEEY - u.posy,
                          trajectory[i].x + SEEX - u.posx, c_red, '`');
                 wrefresh(w_terrain);
@@ -4441,7 +4571,7 @@ missed_by %f deviation %f trange %d charges %d myx %d myy %d monx %d mony %d",
                 double goodhit = missed_by;
                 bool u_see_mon = u_see(&(z[mondex]), junk);
                 if (i < trajectory.size() - 1)
-                    goodhit = double(rand() / (RAND_MAX + 1.0)) / 2;
+                    goodhit = rng_float(0, .5);
                 if (z[mondex].has_flag(MF_HARDTOSHOOT) && !one_in(6)
                     && p.weapon.curammo->accuracy >= 4) { // Shot hits anyway
                     if (u_see_mon)
@@ -4504,7 +4634,7 @@ missed_by %f deviation %f trange %d charges %d myx %d myy %d monx %d mony %d",
                     h = &(active_npc[npc_at(tx, ty)]);
                 int side = rng(0, 1);
                 if (i < trajectory.size() - 1)
-                    goodhit = double(rand() / (RAND_MAX + 1.0)) / 2;
+                    goodhit = rng_float(0, .5);
                 if (goodhit < .05) {
                     hit = bp_eyes;
                     dam = rng(3 * dam, 5 * dam);
@@ -4563,6 +4693,7 @@ missed_by %f deviation %f trange %d charges %d myx %d myy %d monx %d mony %d",
                             || active_npc[npcdex].hp_cur[hp_torso] <= 0) {
                             active_npc[npcdex].die(this);
                             active_npc.erase(active_npc.begin() + npcdex);
+                            npc_grid.invalidate();
                         }
                     }
                 }
@@ -4989,7 +5120,7 @@ void Game::chat()
         int ch {0};
 
         do {
-            ch = getch();
+            ch = get_key();
         } while (ch < '1' || ch > '1' + static_cast<int>(available.size()));
 
         ch -= '1';
@@ -5100,6 +5231,7 @@ void Game::plmove(int x, int y)
                 || active_npc[npcdex].hp_cur[hp_torso] <= 0) {
                 active_npc[npcdex].die(this);
                 active_npc.erase(active_npc.begin() + npcdex);
+                npc_grid.invalidate();
             }
         }
         return;
@@ -5355,13 +5487,8 @@ void Game::vertical_move(int movez, bool force)
             } else if (mt_to_mc((mon_id)(z[i].type->id)) != mcat_null)
                 cur_om.zg.push_back(mongroup(mt_to_mc(mon_id(z[i].type->id)), levx, levy, 1, 1));
 
-            for (auto& npc : active_npc) {
-                if (npc.target == &z[i]) {
-                    npc.target = nullptr;
-                }
-            }
-
-            z.erase(z.begin() + i);
+            z.erase(i);
+            mon_grid.invalidate();
             i--;
         } else if (u_see(&(z[i]), junk))
             add_msg("The %s follows you %s.", z[i].name().c_str(), (movez == -1 ? "down" : "up"));
@@ -5369,8 +5496,9 @@ void Game::vertical_move(int movez, bool force)
 
     cur_om.save();
     m.save(&cur_om, turn, levx, levy);
-    cur_om = overmap(this, cur_om.posx, cur_om.posy, cur_om.posz + movez);
+    cur_om = *overmap_cache().get(this, cur_om.posx, cur_om.posy, cur_om.posz + movez);
     m.init(this, levx, levy);
+    noises.clear(); // Nobody down here heard any of it
     // Move the player to the corresponding up-route. (If one exists.)
     for (int i = 0; i < SEEX * 3; i++) {
         for (int j = 0; j < SEEY * 3; j++) {
@@ -5382,7 +5510,7 @@ void Game::vertical_move(int movez, bool force)
                 i = SEEX * 3;
             } else if (m.ter(i, j) == t_manhole_cover) {
                 m.add_item(i + rng(-1, 1), j + rng(-1, 1), itypes[itm_manhole_cover], 0);
-                m.ter(i, j) = t_manhole;
+                m.set_ter(i, j, t_manhole);
                 u.posx = i;
                 u.posy = j;
                 j = SEEY * 3;
@@ -5405,6 +5533,38 @@ void Game::vertical_move(int movez, bool force)
     refresh_all();
 }
 
+void Game::prefetch_map()
+{
+    // update_map shifts the map once we leave the middle nonant.  Start reading
+    // what it will need while we're still a few steps away, so that the disk
+    // work overlaps with waiting for input.
+    const int margin = 3;
+    int shiftx = 0, shifty = 0;
+    if (u.posx < SEEX + margin)
+        shiftx = -1;
+    else if (u.posx >= SEEX * 2 - margin)
+        shiftx = 1;
+    if (u.posy < SEEY + margin)
+        shifty = -1;
+    else if (u.posy >= SEEY * 2 - margin)
+        shifty = 1;
+    if (shiftx == 0 && shifty == 0)
+        return;
+    m.prefetch(this, levx, levy, shiftx, shifty);
+    // If the shift takes us onto the next overmap, read that as well.
+    int olevx = 0, olevy = 0;
+    if (levx + shiftx < 0)
+        olevx = -1;
+    else if (levx + shiftx > OMAPX * 2 - 1)
+        olevx = 1;
+    if (levy + shifty < 0)
+        olevy = -1;
+    else if (levy + shifty > OMAPY * 2 - 1)
+        olevy = 1;
+    if (olevx != 0 || olevy != 0)
+        overmap_records().prefetch({cur_om.posx + olevx, cur_om.posy + olevy, cur_om.posz});
+}
+
 void Game::update_map(int& x, int& y)
 {
     int shiftx = 0, shifty = 0;
@@ -5427,6 +5587,7 @@ void Game::update_map(int& x, int& y)
     // Before we shift/save the map, check if we need to move monsters back to
     // their spawn locations.
     m.shift(this, levx, levy, shiftx, shifty);
+    fov_stale = true;
     levx += shiftx;
     levy += shifty;
     if (levx < 0) {
@@ -5445,7 +5606,7 @@ void Game::update_map(int& x, int& y)
     }
     if (olevx != 0 || olevy != 0) {
         cur_om.save();
-        cur_om = overmap(this, cur_om.posx + olevx, cur_om.posy + olevy, cur_om.posz);
+        cur_om = *overmap_cache().get(this, cur_om.posx + olevx, cur_om.posy + olevy, cur_om.posz);
     }
 
     // Shift monsters.
@@ -5469,17 +5630,13 @@ void Game::update_map(int& x, int& y)
                                                  levy + shifty, 1, 1));
             }
 
-            for (auto& npc : active_npc) {
-                if (npc.target == &z[i]) {
-                    npc.target = nullptr;
-                }
-            }
-
-            z.erase(z.begin() + i);
+            z.erase(i);
             i--;
         }
     }
 
+    mon_grid.invalidate();
+
     // Shift NPCs.
     for (std::size_t i {0}; i < active_npc.size(); ++i) {
         active_npc[i].shift(shiftx, shifty);
@@ -5491,6 +5648,8 @@ void Game::update_map(int& x, int& y)
         }
     }
 
+    npc_grid.invalidate();
+
     // Spawn NPCs?
     if (!in_tutorial) {
         npc temp;
@@ -5527,15 +5686,8 @@ void Game::update_map(int& x, int& y)
     }
 
     // Shift scent
-    unsigned int newscent[SEEX * 3][SEEY * 3];
-    for (int i = 0; i < SEEX * 3; i++) {
-        for (int j = 0; j < SEEY * 3; j++)
-            newscent[i][j] = scent(i + (shiftx * SEEX), j + (shifty * SEEY));
-    }
-    for (int i = 0; i < SEEX * 3; i++) {
-        for (int j = 0; j < SEEY * 3; j++)
-            scent(i, j) = newscent[i][j];
-    }
+    grscent.shift(shiftx * SEEX, shifty * SEEY);
+    noises.shift(shiftx * SEEX, shifty * SEEY);
     draw_minimap();
 }
 
@@ -5930,14 +6082,14 @@ oter_id Game::ter_at(int omx, int omy, bool& mark_as_seen)
     if (sx != 0 || sy != 0) {
         omx -= sx * OMAPX;
         omy -= sy * OMAPY;
-        overmap tmp(this, cur_om.posx + sx, cur_om.posy + sy, 0);
+        const auto tmp {overmap_cache().get(this, cur_om.posx + sx, cur_om.posy + sy, 0)};
         if (mark_as_seen) {
-            tmp.seen(omx, omy) = true;
-            tmp.save(tmp.posx, tmp.posy, cur_om.posz);
+            tmp->seen(omx, omy) = true;
+            overmap_cache().mark_dirty(tmp->posx, tmp->posy, tmp->posz);
         } else {
-            mark_as_seen = tmp.seen(omx, omy);
+            mark_as_seen = tmp->seen(omx, omy);
         }
-        ret = tmp.ter(omx, omy);
+        ret = tmp->ter(omx, omy);
     } else {
         ret = cur_om.ter(omx, omy);
         if (mark_as_seen)
@@ -5994,7 +6146,7 @@ know why certain graphical terminal emulators decided to take the old standard\n
 size of 80x25 and toss it out the window, making their terminal 80x24 by\n\
 default, but that just won't work here.  Now stretch the bottom of your window\n\
 downward so you get an extra line.\n");
-        getch();
+        get_key();
         getmaxyx(stdscr, maxy, maxx);
     }
     erase();
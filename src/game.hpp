@@ -1,6 +1,7 @@
 #ifndef OOCDDA_GAME_HPP
 #define OOCDDA_GAME_HPP
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "crafting.hpp"
 #include "event.hpp"
 #include "faction.hpp"
+#include "flow_field.hpp"
 #include "itype.hpp"
 #include "map.hpp"
 #include "mapdata.hpp"
@@ -16,12 +18,17 @@
 #include "mongroup.hpp"
 #include "monster.hpp"
 #include "monster_type.hpp"
+#include "noise_map.hpp"
 #include "npc.hpp"
+#include "occupancy_grid.hpp"
 #include "omdata.hpp"
 #include "overmap.hpp"
 #include "player.hpp"
 #include "point.hpp"
+#include "scent_map.hpp"
+#include "slot_map.hpp"
 #include "tutorial.hpp"
+#include "visibility_map.hpp"
 
 namespace oocdda {
 class Item;
@@ -32,6 +39,8 @@ enum tut_type { TUT_NULL, TUT_BASIC, TUT_COMBAT, TUT_MAX };
 class Game {
 public:
     Game();
+    // A headless game starts a random character straight away and skips drawing the map
+    explicit Game(bool headless);
     ~Game();
     bool do_turn();
     void tutorial_message(tut_lesson lesson);
@@ -52,6 +61,9 @@ public:
     int npc_at(int x, int y); // Index of the npc at (x, y); -1 for none
     int mon_at(int x, int y); // Index of the monster at (x, y); -1 for none
     void kill_mon(int index); // Kill that monster; fixes any pointers etc
+    // Take z[index] out of play without killing it; like kill_mon(), it may only be flagged dead
+    //  and erased later, so indices stay put while monsters are moving
+    void remove_mon(int index);
     void plfire(bool burst);  // Player fires a gun (setup of target)...
     // ... a gun is fired, maybe by an NPC (actual damage, etc.).
     void fire(player& p, int tarx, int tary, std::vector<Point>& trajectory, bool burst);
@@ -62,8 +74,12 @@ public:
     int& scent(int x, int y);
     unsigned char light_level();
     bool sees_u(int x, int y, int& t);
+    // Both read u_fov inside the map; t is then 0, i.e. the plain line from the player
     bool u_see(int x, int y, int& t);
     bool u_see(Monster* mon, int& t);
+    void update_fov(); // Recomputes u_fov if the player moved or the map may have changed
+    void update_flow(); // Recomputes u_flow; once a turn, before the monsters move
+    void hear_noises(); // Lets monsters hear what sound() queued; likewise once a turn
     bool pl_sees(player* p, Monster* mon, int& t);
     void refresh_all();
 
@@ -83,10 +99,16 @@ public:
     Map m;
     int levx, levy, levz; // Placement inside the overmap
     player u;
-    std::vector<Monster> z;
+    SlotMap<Monster> z; // Erasing moves the last monster into the gap; see remove_mon()
     std::vector<Monster> monbuff;
     int monbuffx, monbuffy, monbuffz, monbuff_turn;
     std::vector<npc> active_npc;
+    // Fast mon_at() and npc_at(); report moves and removals from z and active_npc here
+    OccupancyGrid<Monster> mon_grid {z.dense(), SEEX * 3, SEEY * 3};
+    OccupancyGrid<npc> npc_grid {active_npc, SEEX * 3, SEEY * 3};
+    VisibilityMap u_fov {SEEX * 3, SEEY * 3}; // What the player can see; see update_fov()
+    FlowField u_flow {SEEX * 3, SEEY * 3};    // How far each square is from the player on foot
+    NoiseMap noises {SEEX * 3, SEEY * 3};     // Sounds made since the monsters last heard any
     std::vector<mon_id> moncats[num_moncats];
     std::vector<faction> factions;
     bool debugmon;
@@ -121,6 +143,7 @@ private:
     void plmove(int x, int y);
     void plswim(int x, int y);
     void update_map(int& x, int& y);       // Called by plmove, sometimes
+    void prefetch_map();                   // Reads ahead for update_map; called by do_turn
     void spawn_mon(int shift, int shifty); // Called by update_map, sometimes
     mon_id valid_monster_from(std::vector<mon_id> group);
     int valid_group(mon_id type, int x, int y);
@@ -163,6 +186,7 @@ private:
 
     // Routine loop functions, approximately in order of execution
     void monmove();
+    void erase_dead(); // Erases what remove_mon() left in z, unless holding_dead
     void om_npcs_move();
     void check_warmth();
     void update_skills();
@@ -181,6 +205,7 @@ private:
     // On-request draw functions
     void draw_overmap();
     void disp_kills();
+    void disp_profile(); // Where the time of recent turns went; see profiler.hpp
     void disp_NPCs();
 
     // If x & y are OOB, gens a new overmap returns the proper terrain; also, may
@@ -196,15 +221,25 @@ private:
     char run_mode;           // 0 - Normal run always; 1 - Running allowed, but if a new
                              //  monsters spawns, go to 2 - No movement allowed
     int mostseen;            // # of mons seen last turn; if this increases, run_mode++
+    bool holding_dead {false};  // Set while erasing from z would move monsters mid-action
+    std::vector<int> dead_mons; // Indices in z flagged dead but not yet erased
 
     bool uquit;
+    bool headless; // Nobody's watching; see headless.hpp
 
     int nextspawn;
     signed char temp;
     std::vector<std::string> messages;
     char curmes;                     // The last-seen message.  Older than 256 is deleted.
-    int grscent[SEEX * 3][SEEY * 3]; // The scent map
-    int nulscent;                    // Returned for OOB scent checks
+    ScentMap grscent {SEEX * 3, SEEY * 3}; // The scent map
+    bool fov_stale {true};                 // Set whenever terrain may have changed since u_fov
+    WINDOW* w_terrain_back;                // draw_ter() draws here, then shows what changed
+    bool panels_stale {true};              // Set when the side panels must be redrawn regardless
+    // What the side panels were last drawn from; they're only redrawn when it changes
+    std::array<int, num_hp_parts * 2 + 3> hp_shown {};
+    std::array<int, 5> minimap_shown {};
+    std::vector<int> moninfo_shown;
+    int nulscent;                          // Returned for OOB scent checks
     std::vector<recipe> recipes;
     std::vector<event> events;
     int kills[num_monsters];
@@ -0,0 +1,146 @@
+#include "headless.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <string_view>
+#include <utility>
+
+#include "game.hpp"
+#include "overmap_cache.hpp"
+#include "region_store.hpp"
+#include "submap_cache.hpp"
+
+namespace oocdda {
+namespace {
+// Moves, and waiting, weighted the same as one move.
+constexpr std::string_view wander_keys {"hjklyubn."};
+
+// Escape, space and N close or refuse whatever's up, and Y gets past questions with no safe
+// answer; 1 is the first choice of a menu(), and 0 the last in a dialogue, the way out of it.
+constexpr std::array<long, 6> dismiss_keys {KEY_ESCAPE, ' ', 'N', 'Y', '1', '0'};
+
+// One key in this many is a dismiss key.
+constexpr int dismiss_chance {4};
+
+// Writes out whatever the world caches and stores hold, then lets go of it, so the next world is
+// read from wherever the process is by then.
+void release_world()
+{
+    overmap_cache().clear();
+    submap_cache().clear();
+    overmap_records().close();
+    submap_records().close();
+}
+} // namespace
+
+BotInput::BotInput(const std::uint64_t seed, std::string script)
+    : rng_ {seed}
+    , script_ {std::move(script)}
+{
+}
+
+auto BotInput::next_key() -> long
+{
+    if (played_ < script_.size()) {
+        return static_cast<unsigned char>(script_[played_++]);
+    }
+
+    if (rng_.one_in(dismiss_chance)) {
+        return dismiss_keys[static_cast<std::size_t>(rng_.range(0, dismiss_keys.size() - 1))];
+    }
+
+    return wander_keys[static_cast<std::size_t>(rng_.range(0, wander_keys.size() - 1))];
+}
+
+NullScreen::NullScreen()
+    : out_ {std::fopen("/dev/null", "w")}
+    , in_ {std::fopen("/dev/null", "r")}
+    , screen_ {nullptr}
+{
+    if (out_ != nullptr && in_ != nullptr) {
+        screen_ = newterm("dumb", out_, in_);
+    }
+
+    if (screen_ == nullptr) {
+        if (out_ != nullptr) {
+            std::fclose(out_);
+        }
+        if (in_ != nullptr) {
+            std::fclose(in_);
+        }
+        throw std::runtime_error("Couldn't open a curses screen on /dev/null");
+    }
+
+    // Big enough for every window the game opens.
+    resizeterm(25, 80);
+    noecho();
+    cbreak();
+}
+
+NullScreen::~NullScreen()
+{
+    endwin();
+    delscreen(screen_);
+    std::fclose(out_);
+    std::fclose(in_);
+}
+
+SaveDir::SaveDir(std::filesystem::path dir, const std::filesystem::path& data)
+    : previous_ {std::filesystem::current_path()}
+    , temporary_ {dir.empty()}
+{
+    release_world();
+
+    if (temporary_) {
+        std::string name {(std::filesystem::temp_directory_path() / "oocdda_XXXXXX").string()};
+
+        if (::mkdtemp(name.data()) == nullptr) {
+            throw std::runtime_error("Couldn't make a directory to play in");
+        }
+        dir = name;
+    } else {
+        std::filesystem::create_directories(dir);
+    }
+    dir_ = std::filesystem::absolute(dir);
+
+    if (!std::filesystem::exists(std::filesystem::symlink_status(dir_ / "data"))) {
+        std::filesystem::create_directory_symlink(previous_ / data, dir_ / "data");
+    }
+    std::filesystem::current_path(dir_);
+}
+
+SaveDir::~SaveDir()
+{
+    release_world();
+
+    std::error_code ignored;
+    std::filesystem::current_path(previous_, ignored);
+
+    if (temporary_) {
+        std::filesystem::remove_all(dir_, ignored);
+    }
+}
+
+auto run_headless(Game& game, const long turns) -> HeadlessReport
+{
+    const auto start {std::chrono::steady_clock::now()};
+    HeadlessReport report {0, 0.0, false};
+
+    while (report.turns < turns) {
+        if (game.do_turn()) {
+            report.ended = true;
+            break;
+        }
+
+        ++report.turns;
+    }
+
+    const std::chrono::duration<double> taken {std::chrono::steady_clock::now() - start};
+    report.seconds = taken.count();
+    return report;
+}
+} // namespace oocdda
@@ -0,0 +1,96 @@
+#ifndef OOCDDA_HEADLESS_HPP
+#define OOCDDA_HEADLESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include <ncurses/curses.h>
+
+#include "keypress.hpp"
+#include "rng.hpp"
+
+namespace oocdda {
+class Game;
+
+/**
+ * \brief Keys for a game nobody is playing: a script, then a random walk.
+ *
+ * Once the script runs out the bot wanders about and waits, and every so often presses the keys
+ * that close popups, answer questions, pick a menu's first choice or back out, so nothing the
+ * game asks holds a run up for long. The same seed and script always give the same keys.
+ */
+class BotInput final : public InputSource {
+public:
+    explicit BotInput(std::uint64_t seed, std::string script = {});
+
+    auto next_key() -> long override;
+
+private:
+    Rng rng_;
+    std::string script_;
+    std::size_t played_ {0};
+};
+
+/**
+ * \brief A curses screen that writes to /dev/null, for as long as it lives.
+ *
+ * Stands in for initscr() when there's no terminal, or no one looking at it; whatever the game
+ * still draws costs next to nothing and goes nowhere.
+ */
+class NullScreen {
+public:
+    NullScreen();
+    NullScreen(const NullScreen&) = delete;
+    NullScreen(NullScreen&&) = delete;
+    auto operator=(const NullScreen&) -> NullScreen& = delete;
+    auto operator=(NullScreen&&) -> NullScreen& = delete;
+    ~NullScreen();
+
+private:
+    std::FILE* out_;
+    std::FILE* in_;
+    SCREEN* screen_;
+};
+
+/**
+ * \brief Plays somewhere other than the player's world, for as long as it lives.
+ *
+ * Moves the process into \p dir, or a fresh directory under the system's temporary one if that's
+ * empty, linking data back to \p data (taken from where it started). A run therefore neither
+ * loads nor overwrites the save directory a normal game uses. Moves back on the way out, and
+ * removes a directory it made up itself.
+ *
+ * The submap and overmap caches and stores are written out and emptied both ways, so a world
+ * played before, or in here, never turns up in the next one.
+ */
+class SaveDir {
+public:
+    explicit SaveDir(std::filesystem::path dir = {}, const std::filesystem::path& data = "data");
+    SaveDir(const SaveDir&) = delete;
+    SaveDir(SaveDir&&) = delete;
+    auto operator=(const SaveDir&) -> SaveDir& = delete;
+    auto operator=(SaveDir&&) -> SaveDir& = delete;
+    ~SaveDir();
+
+    [[nodiscard]] auto path() const -> const std::filesystem::path& { return dir_; }
+
+private:
+    std::filesystem::path previous_;
+    std::filesystem::path dir_;
+    bool temporary_;
+};
+
+struct HeadlessReport {
+    long turns;     ///< Turns actually run.
+    double seconds; ///< Wall-clock time they took.
+    bool ended;     ///< The game was over before all the turns asked for were run.
+};
+
+/// Runs \p turns turns of \p game, or until it's over, taking keys from the input source.
+auto run_headless(Game& game, long turns) -> HeadlessReport;
+} // namespace oocdda
+
+#endif // OOCDDA_HEADLESS_HPP
@@ -49,7 +49,7 @@ l: Survival tips\n\
 \n\
 q: Return to game");
 
-        ch = getch();
+        ch = get_key();
         switch (ch) {
         case 'a':
         case 'A':
@@ -67,7 +67,7 @@ yourself hydrated, and sleep periodically.\n\
 While Cataclysm has more challenges than many roguelikes, the near-future\n\
 setting makes some tasks easier. Firearms, medications, and a wide variety of\n\
 tools are all available to help you survive.");
-            getch();
+            get_key();
             break;
 
         case 'b':
@@ -91,7 +91,7 @@ movement key. However, fast movement in this fashion may lead to the player\n\
 getting into a dangerous situation or even killed before they have a chance\n\
 to react. Pressing '!' will toggle \"Run Mode.\" While this is on, any\n\
 movement will be ignored if new monsters enter the player's view.");
-            getch();
+            get_key();
             break;
 
         case 'c':
@@ -113,7 +113,7 @@ You may not always fall asleep right away.  Sleeping indoors, especially on a\n\
 bed, will help; or you can always use sleeping pills.  While sleeping, you'll\n\
 slowly replenish lost hit points.  You'll also be vulnerable to attack, so\n\
 try to find a safe place, or set traps for unwary intruders.");
-            getch();
+            get_key();
             break;
 
         case 'd':
@@ -130,7 +130,7 @@ reduce your stats.\n\
 Pain will also disappear with time, so if drugs aren't available and you're\n\
 in a lot of pain, it may be wise to find a safe spot and simply rest for an\n\
 extended period of time.");
-            getch();
+            get_key();
             break;
 
         case 'e':
@@ -145,7 +145,7 @@ days, and will leave you very weak, so try to do it in a safe area.\n\
 \n\
 If you are suffering from drug withdrawal, taking more of the drug will cause\n\
 the effects to cease immediately, but may deepen your dependance.");
-            getch();
+            get_key();
             break;
 
         case 'f':
@@ -170,7 +170,7 @@ stats, particularly intelligence.  If your morale drops very low, you may\n\
 even commit suicide.  Very high morale fills you with gusto and energy, and\n\
 you will find yourself moving faster.  At extremely high levels, you will\n\
 receive stat bonuses.");
-            getch();
+            get_key();
             break;
 
         case 'g':
@@ -187,7 +187,7 @@ these mutations will be negative; however, many are beneficial, and others\n\
 have both positive and negative effects.  Your mutations may change your play\n\
 style considerably.  They are extremely rare, but it is possible to find\n\
 substances that will remove mutations.");
-            getch();
+            get_key();
             break;
 
         case 'h':
@@ -211,7 +211,7 @@ installation.  Performing such a task requires high levels of surgery,\n\
 mechanics, and/or electrions, and failure may cripple you!  Bionics canisters\n\
 are difficult to find, but they may be purchased from certain NPCs for a very\n\
 high price.");
-            getch();
+            get_key();
             break;
 
         case 'i':
@@ -240,7 +240,7 @@ and beneficial elixirs.\n\
 In addition to the primary crafting skills, other skills may be necessary to\n\
 create certain items.  Traps skill, Firearms skill, and First Aid skill are\n\
 all required for certain items.");
-            getch();
+            get_key();
             break;
 
         case 'j':
@@ -271,7 +271,7 @@ your inventory, or will be dropped on the ground if there is no space.\n\
 To wear a piece of clothing, press 'W' then the proper letter.  Armor reduces\n\
 damage and helps you resist things like smoke.  To take off an item, press\n\
 'T' then the proper letter.");
-            getch();
+            get_key();
             break;
         case 'k':
         case 'K':
@@ -301,10 +301,10 @@ Unlike most roguelikes, fleeing will often be your best option, especially\n\
 when overwhelmed by a swarm of zombies.  Try to avoid getting cornered inside\n\
 a building.  Ducking down into the subways or sewers is often an excellent\n\
 escape tactic.");
-            getch();
+            get_key();
             break;
 
-            getch();
+            get_key();
             break;
         case 'l':
         case 'L':
@@ -334,7 +334,7 @@ unwanted attention. Save the guns for emergencies, and melee when you can.\n\
 Try to keep your inventory as full as possible without being overloaded.  You\n\
 never know when you might need an item, and most are good to sell, and you\n\
 can easily drop unwanted items on the floor.");
-            getch();
+            get_key();
             break;
 
         case '1':
@@ -369,7 +369,7 @@ S - Save game                                Q - Quit w/o saving");
             mvprintz(23, 0, c_red, "\
 Note that 'a' is context-sensitive, and can be used in place of 'W', 'E', or\n\
 'R', if you like.");
-            getch();
+            get_key();
             break;
         case '2':
             erase();
@@ -394,7 +394,7 @@ ITEM TYPES:\n\
  listed with their contents, e.g. \"plastic bottle of water\". Those containing\n\
  comestibles may be eaten with 'E'; this may leave you with an empty container.\n\
 Press any key to continue...");
-            getch();
+            get_key();
             clear();
             mvprintz(0, 0, c_white, "\
 ITEM TYPES:\n\
@@ -420,7 +420,7 @@ ITEM TYPES:\n\
  are several variants for any particular calibre. Ammunition has a damage\n\
  rating, an accuracy, a range, and an armor-piercing quality.\n\
 Press any key to continue...");
-            getch();
+            get_key();
             erase();
             mvprintz(0, 0, c_white, "\
 ITEM TYPES:\n\
@@ -433,7 +433,7 @@ ITEM TYPES:\n\
     This can be read for training or entertainment by pressing 'R'. Most\n\
  require a basic level of intelligence; some require some base knowledge in\n\
  the relevant subject.");
-            getch();
+            get_key();
             erase();
             break;
         case '3':
@@ -478,7 +478,7 @@ O           Parking lot - Empty lot, few items.  Mostly useless.");
             mvprintz(18, 0, c_white, "\
 ^>v< are always man-made buildings.  The pointed side indicates the front door.");
             mvprintw(22, 0, "There are many others out there... search for them!");
-            getch();
+            get_key();
             erase();
             break;
         }
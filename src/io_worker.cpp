@@ -0,0 +1,69 @@
+#include <utility>
+
+#include "io_worker.hpp"
+
+namespace oocdda {
+IoWorker::IoWorker()
+    : thread_ {[this] { run(); }}
+{
+}
+
+IoWorker::~IoWorker()
+{
+    {
+        const std::lock_guard lock {mutex_};
+        stopping_ = true;
+    }
+
+    wake_.notify_one();
+    thread_.join();
+}
+
+void IoWorker::submit(std::function<void()> job)
+{
+    {
+        const std::lock_guard lock {mutex_};
+        jobs_.push_back(std::move(job));
+    }
+
+    wake_.notify_one();
+}
+
+void IoWorker::wait_idle()
+{
+    std::unique_lock lock {mutex_};
+    idle_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+}
+
+void IoWorker::run()
+{
+    std::unique_lock lock {mutex_};
+
+    while (true) {
+        wake_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+
+        if (jobs_.empty()) {
+            // Only reached when stopping, after the queue has been drained.
+            return;
+        }
+
+        auto job {std::move(jobs_.front())};
+        jobs_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        job();
+        lock.lock();
+        busy_ = false;
+
+        if (jobs_.empty()) {
+            idle_.notify_all();
+        }
+    }
+}
+
+auto io_worker() -> IoWorker&
+{
+    static IoWorker worker;
+    return worker;
+}
+} // namespace oocdda
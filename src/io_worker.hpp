@@ -0,0 +1,50 @@
+#ifndef OOCDDA_IO_WORKER_HPP
+#define OOCDDA_IO_WORKER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace oocdda {
+/**
+ * \brief A single background thread running disk jobs in the order they were submitted.
+ *
+ * Keeping every job on one thread means the stores behind it never see two writers at once and a
+ * read queued after a write always observes it.
+ */
+class IoWorker {
+public:
+    IoWorker();
+    IoWorker(const IoWorker&) = delete;
+    IoWorker(IoWorker&&) = delete;
+    auto operator=(const IoWorker&) -> IoWorker& = delete;
+    auto operator=(IoWorker&&) -> IoWorker& = delete;
+
+    /// Runs the jobs still queued, then stops the thread.
+    ~IoWorker();
+
+    /// Queues \p job to run on the worker thread and returns immediately.
+    void submit(std::function<void()> job);
+
+    /// Blocks until every job submitted so far has finished.
+    void wait_idle();
+
+private:
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::deque<std::function<void()>> jobs_;
+    bool busy_ {false};
+    bool stopping_ {false};
+    std::thread thread_;
+};
+
+/// The worker shared by all of the game's record stores.
+[[nodiscard]] auto io_worker() -> IoWorker&;
+} // namespace oocdda
+
+#endif // OOCDDA_IO_WORKER_HPP
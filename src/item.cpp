@@ -9,6 +9,7 @@
 #include "bodypart.hpp"
 #include "game.hpp"
 #include "itype.hpp"
+#include "keypress.hpp"
 #include "monster_type.hpp"
 #include "output.hpp"
 #include "player.hpp"
@@ -151,7 +152,11 @@ std::string Item::save_info()
     return dump.str();
 }
 
-void Item::load_info(std::string data, Game* g)
+void Item::load_info(std::string data, Game* g) { load_info(data, g->itypes, g->mtypes); }
+
+void Item::load_info(std::string data,
+                     const std::vector<itype*>& itypes,
+                     const std::vector<MonsterType*>& mtypes)
 {
     std::stringstream dump;
     dump << data;
@@ -160,14 +165,14 @@ void Item::load_info(std::string data, Game* g)
     if (idtmp == itm_corpse) {
         int corp;
         dump >> corp;
-        corpse = g->mtypes[corp];
+        corpse = mtypes[corp];
     }
     getline(dump, name);
     if (name == " ''")
         name = "";
     else
         name = name.substr(2, name.size() - 3);
-    make(g->itypes[idtmp]);
+    make(itypes[idtmp]);
     invlet = char(lettmp);
     damage = damtmp;
     active = false;
@@ -177,7 +182,7 @@ void Item::load_info(std::string data, Game* g)
     if (owntmp == 1)
         owned = true;
     if (is_gun() && ammotmp > 0)
-        curammo = dynamic_cast<it_ammo*>(g->itypes[ammotmp]);
+        curammo = dynamic_cast<it_ammo*>(itypes[ammotmp]);
 }
 
 std::string Item::info(bool showtext)
@@ -833,7 +838,7 @@ Choose ammo type:         Damage     Armor Pierce     Range     Accuracy");
             wrefresh(w_ammo);
 
             do {
-                ch = getch();
+                ch = get_key();
             } while ((ch < 'a' || ch - 'a' > static_cast<int>(am.size()) - 1) && ch != ' '
                      && ch != 27);
 
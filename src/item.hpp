@@ -43,6 +43,9 @@ public:
 
     std::string save_info(); // Formatted for save files
     void load_info(std::string data, Game* g);
+    void load_info(std::string data,
+                   const std::vector<itype*>& itypes,
+                   const std::vector<MonsterType*>& mtypes);
     std::string info(bool showtext = false); // Formatted for human viewing
     char symbol();
     nc_color color();
@@ -118,7 +118,7 @@ void iuse::bandage(Game* g, Item* it, bool /*toggled*/)
     wrefresh(w);
     char ch;
     do {
-        ch = getch();
+        ch = get_key();
         if (ch == '1') {
             g->u.heal(bp_head, 0, 1 + bonus * 0.8);
         } else if (ch == '2') {
@@ -220,7 +220,7 @@ void iuse::firstaid(Game* g, Item* it, bool /*toggled*/)
     wrefresh(w);
     char ch;
     do {
-        ch = getch();
+        ch = get_key();
         if (ch == '1') {
             g->u.heal(bp_head, 0, 10 + bonus * 0.8);
         } else if (ch == '2') {
@@ -741,18 +741,18 @@ void iuse::hammer(Game* g, Item* /*item*/, bool /*toggled*/)
         wrefresh(w);
         char ch;
         do {
-            ch = getch();
+            ch = get_key();
         } while (ch != 'y' && ch != 'Y' && ch != 'n' && ch != 'N');
         if (ch == 'y' || ch == 'Y') {
             g->u.moves -= 100;
             g->u.use_up(itm_nail, nails);
             g->u.use_up(itm_2x4, boards);
-            g->m.ter(dirx, diry) = newter;
+            g->m.set_ter(dirx, diry, newter);
         }
     } else {
         mvwprintz(w, 5, 1, c_red, "Cannot perform action.");
         wrefresh(w);
-        getch();
+        get_key();
     }
     delwin(w);
 }
@@ -814,7 +814,7 @@ void iuse::two_way_radio(Game* g, Item* it, bool /*toggled*/)
     mvwprintz(w, 3, 1, c_white, "3: General S.O.S.");
     mvwprintz(w, 4, 1, c_white, "0: Cancel");
     wrefresh(w);
-    char ch = getch();
+    char ch = get_key();
     if (ch == '1') {
         g->u.moves -= 300;
         faction* fac = g->list_factions("Call for help...");
@@ -940,7 +940,7 @@ void iuse::crowbar(Game* g, Item* /*item*/, bool /*toggled*/)
         if (dice(4, 6) < dice(4, g->u.str_cur)) {
             g->add_msg("You pry the door open.");
             g->u.moves -= (150 - (g->u.str_cur * 5));
-            g->m.ter(dirx, diry) = t_door_o;
+            g->m.set_ter(dirx, diry, t_door_o);
         } else {
             g->add_msg("You pry, but cannot open the door.");
             g->u.moves -= 100;
@@ -949,7 +949,7 @@ void iuse::crowbar(Game* g, Item* /*item*/, bool /*toggled*/)
         if (dice(8, 8) < dice(8, g->u.str_cur)) {
             g->add_msg("You lift the manhole cover.");
             g->u.moves -= (500 - (g->u.str_cur * 5));
-            g->m.ter(dirx, diry) = t_manhole;
+            g->m.set_ter(dirx, diry, t_manhole);
             g->m.add_item(g->u.posx, g->u.posy, g->itypes[itm_manhole_cover], 0);
         } else {
             g->add_msg("You pry, but cannot lift the manhole cover.");
@@ -964,7 +964,7 @@ void iuse::makemound(Game* g, Item* /*item*/, bool /*toggled*/)
     if (g->m.has_flag(diggable, g->u.posx, g->u.posy)) {
         g->add_msg("You churn up the earth here.");
         g->u.moves = -300;
-        g->m.ter(g->u.posx, g->u.posy) = t_dirtmound;
+        g->m.set_ter(g->u.posx, g->u.posy, t_dirtmound);
     } else {
         g->add_msg("You can't churn up this ground.");
     }
@@ -982,7 +982,7 @@ void iuse::dig(Game* g, Item* /*item*/, bool /*toggled*/)
     }
     if (g->m.has_flag(diggable, g->u.posx + dirx, g->u.posy + diry)) {
         g->add_msg("You dig a pit.");
-        g->m.ter(g->u.posx + dirx, g->u.posy + diry) = t_pit;
+        g->m.set_ter(g->u.posx + dirx, g->u.posy + diry, t_pit);
     } else
         g->add_msg("You can't dig through %d!",
                    g->m.tername(g->u.posx + dirx, g->u.posy + diry).c_str());
@@ -1153,7 +1153,7 @@ void iuse::geiger(Game* g, Item* it, bool /*toggled*/)
     wrefresh(w);
     char ch;
     do {
-        ch = getch();
+        ch = get_key();
         if (ch == '1')
             g->add_msg("Your radiation level: %d", g->u.radiation);
         else if (ch == '2')
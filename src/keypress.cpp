@@ -3,9 +3,23 @@
 #include <ncurses/curses.h>
 
 namespace oocdda {
+namespace {
+InputSource* input_source {nullptr};
+} // namespace
+
+void set_input_source(InputSource* source)
+{
+    input_source = source;
+}
+
+long get_key()
+{
+    return input_source != nullptr ? input_source->next_key() : getch();
+}
+
 long input()
 {
-    long ch = getch();
+    long ch = get_key();
     switch (ch) {
     case '7':
         return 'y';
@@ -2,6 +2,24 @@
 #define OOCDDA_KEYPRESS_HPP
 
 namespace oocdda {
+/// Where keys come from instead of the keyboard, e.g. a script or a bot in headless runs.
+class InputSource {
+public:
+    InputSource() = default;
+    InputSource(const InputSource&) = delete;
+    InputSource(InputSource&&) = delete;
+    auto operator=(const InputSource&) -> InputSource& = delete;
+    auto operator=(InputSource&&) -> InputSource& = delete;
+    virtual ~InputSource() = default;
+
+    /// The next key; asked for wherever the game would otherwise wait on the keyboard.
+    virtual auto next_key() -> long = 0;
+};
+
+// Take keys from source rather than the keyboard; NULL goes back to the keyboard
+void set_input_source(InputSource* source);
+// The next key as is, from the input source if there is one, else from getch()
+long get_key();
 // Simple text input--translates numpad to vikeys
 long input();
 // If ch is vikey, x & y are set to corresponding direction; ch=='y'->x=-1,y=-1
@@ -52,19 +52,6 @@ std::vector<Point> line_to(int x1, int y1, int x2, int y2, int t)
     return ret;
 }
 
-int trig_dist(int x1, int y1, int x2, int y2)
-{
-    return int(sqrt(pow(x1 - x2, 2) + pow(y1 - y2, 2)));
-}
-
-int rl_dist(int x1, int y1, int x2, int y2)
-{
-    int dx = abs(x1 - x2), dy = abs(y1 - y2);
-    if (dx > dy)
-        return dx;
-    return dy;
-}
-
 std::string direction_from(int x1, int y1, int x2, int y2)
 {
     int dx = x2 - x1;
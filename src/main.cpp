@@ -4,38 +4,142 @@
  * Who knows
  */
 
-#include <cstdlib>
-#include <ctime>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
 
 #include <ncurses/curses.h>
 
 #include "game.hpp"
+#include "headless.hpp"
+#include "keypress.hpp"
+#include "profiler.hpp"
+#include "rng.hpp"
 
 // FUNCTIONS
 void do_colors();
 // void load_items();
 
-auto main() -> int
+namespace {
+struct Options {
+    long headless_turns {0}; // 0 to play normally
+    std::uint64_t seed {std::random_device {}()};
+    std::string script;
+    std::string profile;  // Where to write the turn profile on exit, if anywhere
+    std::string save_dir; // Where a headless run keeps its world; a throwaway one if empty
+};
+
+template<typename T>
+bool parse_number(std::string_view text, T& value)
+{
+    const auto [end, error] {std::from_chars(text.data(), text.data() + text.size(), value)};
+    return error == std::errc {} && end == text.data() + text.size();
+}
+
+bool parse_options(int argc, char* argv[], Options& options)
 {
-    srand(time(NULL));
-
-    initscr();
-    noecho();
-    cbreak();
-    keypad(stdscr, true);
-    do_colors();
-    curs_set(0);
-
-    rand();
-    oocdda::Game g;
-
-    while (!g.do_turn())
-        ;
-    erase();
-    endwin();
+    for (int i {1}; i < argc; ++i) {
+        const std::string_view arg {argv[i]};
+
+        if (i + 1 == argc)
+            return false; // Every option takes a value
+        const std::string_view value {argv[++i]};
+
+        if (arg == "--headless") {
+            if (!parse_number(value, options.headless_turns) || options.headless_turns <= 0)
+                return false;
+        } else if (arg == "--seed") {
+            if (!parse_number(value, options.seed))
+                return false;
+        } else if (arg == "--script")
+            options.script = value;
+        else if (arg == "--profile")
+            options.profile = value;
+        else if (arg == "--save-dir")
+            options.save_dir = value;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Runs the game with no one at the keyboard and reports how fast it went
+int play_headless(const Options& options)
+{
+    oocdda::HeadlessReport report {};
+    {
+        const oocdda::SaveDir dir {options.save_dir};
+        const oocdda::NullScreen screen;
+        oocdda::BotInput bot {options.seed, options.script};
+        oocdda::set_input_source(&bot);
+        oocdda::Game g {true};
+        report = oocdda::run_headless(g, options.headless_turns);
+        oocdda::set_input_source(nullptr);
+    }
+
+    std::printf("Ran %ld turns in %.3f s (%.0f turns/s), seed %llu%s\n", report.turns,
+                report.seconds, report.seconds > 0 ? report.turns / report.seconds : 0.0,
+                static_cast<unsigned long long>(options.seed),
+                report.ended ? ", stopped early: the game ended" : "");
     return 0;
 }
 
+void write_profile(const std::string& path)
+{
+    std::ofstream out {path};
+    oocdda::profiler().write(out);
+
+    if (!out)
+        std::fprintf(stderr, "Couldn't write the turn profile to %s\n", path.c_str());
+}
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    Options options;
+
+    if (!parse_options(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "Usage: %s [--headless TURNS [--save-dir DIR]] [--seed N] [--script KEYS]"
+                     " [--profile FILE]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    oocdda::seed_rng(options.seed);
+
+    int status {0};
+
+    if (options.headless_turns > 0)
+        status = play_headless(options);
+    else {
+        initscr();
+        noecho();
+        cbreak();
+        keypad(stdscr, true);
+        do_colors();
+        curs_set(0);
+
+        {
+            oocdda::Game g;
+
+            while (!g.do_turn())
+                ;
+        }
+        erase();
+        endwin();
+    }
+
+    if (!options.profile.empty())
+        write_profile(options.profile);
+    return status;
+}
+
 #define HILIGHT COLOR_BLUE
 void do_colors()
 {
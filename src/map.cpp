@@ -1,9 +1,10 @@
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
-#include <cstdio>
 #include <cstdlib>
-#include <fstream>
+#include <memory>
+#include <utility>
 
 #include "map.hpp"
 
@@ -16,6 +17,7 @@
 #include "game.hpp"
 #include "itype.hpp"
 #include "iuse.hpp"
+#include "keypress.hpp"
 #include "line.hpp"
 #include "mapdata.hpp"
 #include "monster.hpp"
@@ -23,51 +25,143 @@
 #include "overmap.hpp"
 #include "player.hpp"
 #include "pldata.hpp"
+#include "profiler.hpp"
+#include "region_store.hpp"
 #include "rng.hpp"
 #include "skill.hpp"
+#include "submap_cache.hpp"
+#include "submap_io.hpp"
 
 namespace oocdda {
 // " ...|-+%|-"
 // Null Dirt Grass floor Wall-V Wall-H O-door B-door C-door-V C-door-H
 bool inbounds(int x, int y);
-void cast_to_nonant(int& x, int& y, int& n);
 #define SGN(a) (((a) < 0) ? -1 : 1)
 
+static_assert(num_t_flags <= 16, "Terrain flags are cached in 16 bits");
+
+// Index of (x, y) in the cached terrain planes.
+static std::size_t square_index(int x, int y)
+{
+    return static_cast<std::size_t>(y * SEEX * 3 + x);
+}
+
+// The square at index n of the cached terrain planes.
+static Point square_point(std::size_t n)
+{
+    return Point(int(n % (SEEX * 3)), int(n / (SEEX * 3)));
+}
+
+// Where the nonant at gridx, gridy of a map positioned at worldx, worldy on om is stored.
+static RecordKey submap_key(const overmap& om, int worldx, int worldy, int gridx, int gridy)
+{
+    return {om.posx * OMAPX * 2 + worldx + gridx, om.posy * OMAPY * 2 + worldy + gridy, om.posz};
+}
+
+// Moves every square of a window plane sx submaps left and sy submaps up, the way Map::shift moves
+// the submaps.  Squares nothing moves into keep what they had (or its moved-from husk).
+template<typename T, std::size_t N>
+static void shift_tiles(std::array<T, N>& tiles, int sx, int sy)
+{
+    const int w = SEEX * 3, h = SEEY * 3, dx = sx * SEEX, dy = sy * SEEY;
+    // Rows are walked in the direction they move, so none is overwritten before it has moved.
+    for (int k = 0; k < h; k++) {
+        const int y = dy >= 0 ? k : h - 1 - k;
+        if (y + dy < 0 || y + dy >= h)
+            continue;
+        const auto src = tiles.begin() + (y + dy) * w;
+        const auto dst = tiles.begin() + y * w;
+        if (dx >= 0)
+            std::move(src + dx, src + w, dst);
+        else
+            std::move_backward(src, src + w + dx, dst + w);
+    }
+}
+
 Map::Map()
 {
-    nulter = t_null;
     nultrap = tr_null;
+    invalidate_squares();
 }
 
 Map::Map(std::vector<itype*>* itptr,
          std::vector<itype_id> (*miptr)[num_itloc],
          std::vector<trap*>* trptr)
 {
-    nulter = t_null;
     nultrap = tr_null;
     itypes = itptr;
     mapitems = miptr;
     traps = trptr;
-    for (int i = 0; i < SEEX * 3; i++) {
-        for (int j = 0; j < SEEY * 3; j++) {
-            tr_at(i, j) = tr_null;
-            radiation(i, j) = 0;
-        }
-    }
+    invalidate_squares();
 }
 
-ter_id& Map::ter(int x, int y)
+ter_id Map::ter(int x, int y) const
 {
     // 0 1 2
     // 3 4 5
     // 6 7 8
-    if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3) {
-        nulter = t_null;
-        return nulter; // Out-of-bounds - null terrain
+    if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
+        return t_null; // Out-of-bounds - null terrain
+    return ter_tiles[square_index(x, y)];
+}
+
+void Map::set_ter(int x, int y, ter_id new_terrain)
+{
+    if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
+        return;
+    const std::size_t n = square_index(x, y);
+    ter_tiles[n] = new_terrain;
+    cost_plane[n] = stale_square;
+}
+
+void Map::cache_square(std::size_t n)
+{
+    const ter_t& terrain = terlist[ter_tiles[n]];
+    const field& fd = fld_tiles[n];
+    cost_plane[n] = terrain.movecost;
+    flag_plane[n] = static_cast<std::uint16_t>(terrain.flags);
+    trans_plane[n] = (terrain.flags & flag_to_bit_position(transparent))
+        && (fd.type == fd_null || fieldlist[fd.type].transparent[fd.density - 1]);
+}
+
+std::size_t Map::cached_square(int x, int y)
+{
+    const std::size_t n = square_index(x, y);
+    if (cost_plane[n] == stale_square)
+        cache_square(n);
+    return n;
+}
+
+void Map::invalidate_squares() { cost_plane.fill(stale_square); }
+
+void Map::invalidate_square(int x, int y) { cost_plane[square_index(x, y)] = stale_square; }
+
+void Map::list_field(std::size_t n)
+{
+    if (field_listed[n])
+        return;
+    field_listed[n] = true;
+    field_squares.insert(n);
+}
+
+void Map::relist_fields()
+{
+    field_squares.clear();
+    field_listed.fill(false);
+    for (std::size_t n = 0; n < fld_tiles.size(); n++) {
+        if (fld_tiles[n].type != fd_null)
+            list_field(n);
     }
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    return grid[nonant].ter[x][y];
+}
+
+void Map::prune_fields()
+{
+    std::erase_if(field_squares, [this](std::size_t n) {
+        if (fld_tiles[n].type != fd_null)
+            return false;
+        field_listed[n] = false;
+        return true;
+    });
 }
 
 std::string Map::tername(int x, int y) { return terlist[ter(x, y)].name; }
@@ -92,7 +186,7 @@ int Map::move_cost(int x, int y)
 {
     if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
         return 2;
-    return terlist[ter(x, y)].movecost;
+    return cost_plane[cached_square(x, y)];
 }
 
 bool Map::trans(int x, int y)
@@ -102,16 +196,14 @@ bool Map::trans(int x, int y)
     // this check in the ray loop.
     if ((x >= SEEX * 3) || (x < 0) || (y >= SEEY * 3) || (y < 0))
         return true;
-    return terlist[ter(x, y)].flags & flag_to_bit_position(transparent)
-        && (field_at(x, y).type == 0
-            || fieldlist[field_at(x, y).type].transparent[field_at(x, y).density - 1]);
+    return trans_plane[cached_square(x, y)];
 }
 
 bool Map::has_flag(t_flag flag, int x, int y)
 {
     if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
         return (flag == diggable ? true : false); // For the sake of worms, etc.
-    return terlist[ter(x, y)].flags & flag_to_bit_position(flag);
+    return flag_plane[cached_square(x, y)] & flag_to_bit_position(flag);
 }
 
 bool Map::is_destructable(int x, int y)
@@ -145,7 +237,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_door_locked:
         if (str >= rng(0, 40)) {
             sound += "smash!";
-            ter(x, y) = t_door_b;
+            set_ter(x, y, t_door_b);
             return true;
         } else {
             sound += "whump!";
@@ -155,7 +247,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_door_b:
         if (str >= rng(0, 30)) {
             sound += "crash!";
-            ter(x, y) = t_door_frame;
+            set_ter(x, y, t_door_frame);
             return true;
         } else {
             sound += "wham!";
@@ -165,7 +257,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_window:
         if (str >= rng(0, 6)) {
             sound += "glass breaking!";
-            ter(x, y) = t_window_frame;
+            set_ter(x, y, t_window_frame);
             return true;
         } else {
             sound += "whack!";
@@ -175,7 +267,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_door_boarded:
         if (str >= dice(3, 50)) {
             sound += "crash!";
-            ter(x, y) = t_door_frame;
+            set_ter(x, y, t_door_frame);
             return true;
         } else {
             sound += "wham!";
@@ -185,7 +277,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_window_boarded:
         if (str >= dice(3, 30)) {
             sound += "crash!";
-            ter(x, y) = t_window_frame;
+            set_ter(x, y, t_window_frame);
             return true;
         } else {
             sound += "wham!";
@@ -195,7 +287,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_toilet:
         if (str >= dice(8, 10)) {
             sound += "porcelain breaking!";
-            ter(x, y) = t_rubble;
+            set_ter(x, y, t_rubble);
         } else {
             sound += "whunk!";
             return true;
@@ -205,7 +297,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_wall_glass_v:
         if (str >= rng(0, 20)) {
             sound += "glass breaking!";
-            ter(x, y) = t_floor;
+            set_ter(x, y, t_floor);
             return true;
         } else {
             sound += "whack!";
@@ -216,7 +308,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_reinforced_glass_v:
         if (str >= rng(60, 100)) {
             sound += "glass breaking!";
-            ter(x, y) = t_floor;
+            set_ter(x, y, t_floor);
             return true;
         } else {
             sound += "whack!";
@@ -226,7 +318,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_tree_young:
         if (str >= rng(0, 50)) {
             sound += "crunch!";
-            ter(x, y) = t_underbrush;
+            set_ter(x, y, t_underbrush);
             return true;
         } else {
             sound += "whack!";
@@ -236,7 +328,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_underbrush:
         if (str >= rng(0, 30) && !one_in(4)) {
             sound += "crunch.";
-            ter(x, y) = t_dirt;
+            set_ter(x, y, t_dirt);
             return true;
         } else {
             sound += "brush.";
@@ -246,7 +338,7 @@ bool Map::bash(int x, int y, int str, std::string& sound)
     case t_vat:
         if (str >= dice(2, 20)) {
             sound += "ker-rash!";
-            ter(x, y) = t_floor;
+            set_ter(x, y, t_floor);
             return true;
         } else {
             sound += "plunk.";
@@ -280,14 +372,14 @@ void Map::destroy(Game* g, int x, int y, bool makesound)
                         add_item(i, j, g->itypes[itm_steel_chunk], 0);
                 }
             }
-        ter(x, y) = t_rubble;
+        set_ter(x, y, t_rubble);
         break;
 
     case ter_id::t_door_c:
     case ter_id::t_door_b:
     case ter_id::t_door_locked:
     case ter_id::t_door_boarded: {
-        ter(x, y) = t_door_frame;
+        set_ter(x, y, t_door_frame);
         for (int i = x - 2; i <= x + 2; i++) {
             for (int j = y - 2; j <= y + 2; j++) {
                 if (move_cost(i, j) > 0 && one_in(6))
@@ -306,10 +398,10 @@ void Map::destroy(Game* g, int x, int y, bool makesound)
                     add_item(i, j, g->itypes[itm_2x4], 0);
             }
         }
-        ter(x, y) = t_rubble;
+        set_ter(x, y, t_rubble);
         break;
     default:
-        ter(x, y) = t_rubble;
+        set_ter(x, y, t_rubble);
     }
     if (makesound)
         g->sound(x, y, 40, "SMASH!!");
@@ -322,36 +414,36 @@ void Map::shoot(Game* g, int x, int y, int& dam, bool hit_items)
     case t_door_locked:
         dam -= rng(15, 30);
         if (dam > 0)
-            ter(x, y) = t_door_b;
+            set_ter(x, y, t_door_b);
         return;
     case t_door_b:
         if (one_in(8)) { // 1 in 8 chance of hitting the door
             dam -= rng(10, 30);
             if (dam > 0)
-                ter(x, y) = t_door_frame;
+                set_ter(x, y, t_door_frame);
         } else
             dam -= rng(0, 1);
         return;
     case t_door_boarded:
         dam -= rng(15, 35);
         if (dam > 0)
-            ter(x, y) = t_door_b;
+            set_ter(x, y, t_door_b);
         return;
     case t_window:
         dam -= rng(0, 5);
         if (dam > 0)
-            ter(x, y) = t_window_frame;
+            set_ter(x, y, t_window_frame);
         return;
     case t_window_boarded:
         dam -= rng(10, 30);
         if (dam > 0)
-            ter(x, y) = t_window_frame;
+            set_ter(x, y, t_window_frame);
         return;
     case t_wall_glass_h:
     case t_wall_glass_v:
         dam -= rng(0, 8);
         if (dam > 0)
-            ter(x, y) = t_floor;
+            set_ter(x, y, t_floor);
         return;
     case t_gas_pump:
         if (one_in(3) || hit_items) {
@@ -362,7 +454,7 @@ void Map::shoot(Game* g, int x, int y, int& dam, bool hit_items)
                             add_item(i, j, g->itypes[itm_gasoline], 0);
                     }
                 }
-                ter(x, y) = t_gas_pump_smashed;
+                set_ter(x, y, t_gas_pump_smashed);
             }
             dam -= 60;
         }
@@ -370,7 +462,7 @@ void Map::shoot(Game* g, int x, int y, int& dam, bool hit_items)
     case t_vat:
         if (dam >= 20) {
             g->sound(x, y, 15, "ke-rash!");
-            ter(x, y) = t_floor;
+            set_ter(x, y, t_floor);
         }
         break;
     default:
@@ -426,26 +518,26 @@ void Map::shoot(Game* g, int x, int y, int& dam, bool hit_items)
 bool Map::open_door(int x, int y, bool inside)
 {
     if (ter(x, y) == t_door_c) {
-        ter(x, y) = t_door_o;
+        set_ter(x, y, t_door_o);
         return true;
     } else if (ter(x, y) == t_door_metal_c) {
-        ter(x, y) = t_door_metal_o;
+        set_ter(x, y, t_door_metal_o);
         return true;
     } else if (inside && ter(x, y) == t_door_locked) {
-        ter(x, y) = t_door_o;
+        set_ter(x, y, t_door_o);
         return true;
     }/* else if (inside && ter(x, y) == t_door_metal_locked)
-  ter(x, y) = t_door_metal_o; */	// Locked metal doors are REALLY locked!
+  set_ter(x, y, t_door_metal_o); */	// Locked metal doors are REALLY locked!
     return false;
 }
 
 bool Map::close_door(int x, int y)
 {
     if (ter(x, y) == t_door_o) {
-        ter(x, y) = t_door_c;
+        set_ter(x, y, t_door_c);
         return true;
     } else if (ter(x, y) == t_door_metal_o) {
-        ter(x, y) = t_door_metal_c;
+        set_ter(x, y, t_door_metal_c);
         return true;
     }
     return false;
@@ -457,9 +549,7 @@ int& Map::radiation(int x, int y)
         nulrad = 0;
         return nulrad;
     }
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    return grid[nonant].rad[x][y];
+    return rad_tiles[square_index(x, y)];
 }
 
 std::vector<Item>& Map::i_at(int x, int y)
@@ -468,9 +558,7 @@ std::vector<Item>& Map::i_at(int x, int y)
         nulitems.clear();
         return nulitems;
     }
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    return grid[nonant].itm[x][y];
+    return itm_tiles[square_index(x, y)];
 }
 
 Item Map::water_from(int x, int y)
@@ -508,9 +596,31 @@ void Map::i_rem(int x, int y, int index)
     }
 
     i_at(x, y).erase(i_at(x, y).begin() + index);
+    if (x >= 0 && y >= 0 && x < SEEX * 3 && y < SEEY * 3 && !has_active_item(square_index(x, y)))
+        active_item_squares.erase(square_index(x, y));
+}
+
+void Map::i_clear(int x, int y)
+{
+    i_at(x, y).clear();
+    if (x >= 0 && y >= 0 && x < SEEX * 3 && y < SEEY * 3)
+        active_item_squares.erase(square_index(x, y));
 }
 
-void Map::i_clear(int x, int y) { i_at(x, y).clear(); }
+bool Map::has_active_item(std::size_t n) const
+{
+    return std::any_of(itm_tiles[n].begin(), itm_tiles[n].end(),
+                       [](const Item& it) { return it.active; });
+}
+
+void Map::relist_active_items()
+{
+    active_item_squares.clear();
+    for (std::size_t n = 0; n < itm_tiles.size(); n++) {
+        if (has_active_item(n))
+            active_item_squares.insert(n);
+    }
+}
 
 Point Map::find_item(Item* it)
 {
@@ -564,34 +674,45 @@ void Map::add_item(int x, int y, Item new_item)
     }
     if (x < 0 || y < 0 || x >= SEEX * 3 || y >= SEEX * 3)
         return;
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    grid[nonant].itm[x][y].push_back(new_item);
+    itm_tiles[square_index(x, y)].push_back(new_item);
+    if (new_item.active)
+        active_item_squares.insert(square_index(x, y));
+}
+
+std::vector<Point> Map::listed_active_items() const
+{
+    std::vector<Point> ret;
+    for (std::size_t n : active_item_squares)
+        ret.push_back(square_point(n));
+    return ret;
 }
 
 void Map::process_active_items(Game* g)
 {
+    const ProfileScope profile {Phase::active_items};
     it_tool* tmp;
     iuse use;
-    for (int i = 0; i < SEEX * 3; i++) {
-        for (int j = 0; j < SEEY * 3; j++) {
-            for (std::size_t n {0}; n < i_at(i, j).size(); ++n) {
-                if (i_at(i, j)[n].active) {
-                    tmp = dynamic_cast<it_tool*>(i_at(i, j)[n].type);
-                    (use.*tmp->use)(g, &i_at(i, j)[n], true);
-                    i_at(i, j)[n].charges -= tmp->charges_per_sec;
-                    if (i_at(i, j)[n].charges <= 0) {
-                        (use.*tmp->use)(g, &i_at(i, j)[n], false);
-                        if (tmp->revert_to == itm_null) {
-                            i_at(i, j).erase(i_at(i, j).begin() + n);
-                            n--;
-                        } else
-                            i_at(i, j)[n].type = g->itypes[tmp->revert_to];
-                    }
+    // A copy, since an item going off can clear or fill squares as we go
+    const std::vector<std::size_t> squares(active_item_squares.begin(), active_item_squares.end());
+    for (std::size_t sq : squares) {
+        const int i = int(sq % (SEEX * 3)), j = int(sq / (SEEX * 3));
+        for (std::size_t n {0}; n < i_at(i, j).size(); ++n) {
+            if (i_at(i, j)[n].active) {
+                tmp = dynamic_cast<it_tool*>(i_at(i, j)[n].type);
+                (use.*tmp->use)(g, &i_at(i, j)[n], true);
+                i_at(i, j)[n].charges -= tmp->charges_per_sec;
+                if (i_at(i, j)[n].charges <= 0) {
+                    (use.*tmp->use)(g, &i_at(i, j)[n], false);
+                    if (tmp->revert_to == itm_null) {
+                        i_at(i, j).erase(i_at(i, j).begin() + n);
+                        n--;
+                    } else
+                        i_at(i, j)[n].type = g->itypes[tmp->revert_to];
                 }
             }
         }
     }
+    std::erase_if(active_item_squares, [this](std::size_t n) { return !has_active_item(n); });
 }
 
 trap_id& Map::tr_at(int x, int y)
@@ -600,28 +721,14 @@ trap_id& Map::tr_at(int x, int y)
         nultrap = tr_null;
         return nultrap; // Out-of-bounds, return our null trap
     }
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    if (x < 0 || x >= SEEX || y < 0 || y >= SEEY) {
-        debugmsg("tr_at contained bad x:y %d:%d", x, y);
-        nultrap = tr_null;
-        return nultrap; // Out-of-bounds, return our null trap
-    }
-
-    return grid[nonant].trp[x][y];
+    return trp_tiles[square_index(x, y)];
 }
 
 void Map::add_trap(int x, int y, trap_id t)
 {
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    grid[nonant].trp[x][y] = t;
-    /*
-     debugmsg("trap_id %d; traps.size() %d", t, traps->size());
-     if (t == tr_portal)
-      debugmsg("add_trap x:%d y:%d, -> nonant %d %d:%d = %d (%s)", oldx, oldy,
-               nonant, x, y, t, (*traps)[t]->name.c_str());
-    */
+    if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
+        return;
+    trp_tiles[square_index(x, y)] = t;
 }
 
 void Map::disarm_trap(Game* g, int x, int y)
@@ -659,9 +766,26 @@ field& Map::field_at(int x, int y)
         nulfield = field();
         return nulfield;
     }
-    int nonant;
-    cast_to_nonant(x, y, nonant);
-    return grid[nonant].fld[x][y];
+    const std::size_t n = square_index(x, y);
+    cost_plane[n] = stale_square; // The caller may change it...
+    list_field(n);                // ...even put a field there
+    return fld_tiles[n];
+}
+
+const field& Map::field_at(int x, int y) const
+{
+    static const field none;
+    if (x < 0 || x >= SEEX * 3 || y < 0 || y >= SEEY * 3)
+        return none;
+    return fld_tiles[square_index(x, y)];
+}
+
+std::vector<Point> Map::listed_fields() const
+{
+    std::vector<Point> ret;
+    for (std::size_t n : field_squares)
+        ret.push_back(square_point(n));
+    return ret;
 }
 
 bool Map::add_field(Game* g, int x, int y, field_id t, unsigned char density)
@@ -683,31 +807,30 @@ bool Map::add_field(Game* g, int x, int y, field_id t, unsigned char density)
 void Map::debug()
 {
     mvprintw(0, 0, "MAP DEBUG");
-    getch();
+    get_key();
     for (int i = 0; i <= SEEX * 2; i++) {
         for (int j = 0; j <= SEEY * 2; j++) {
             if (i_at(i, j).size() > 0) {
                 mvprintw(1, 0, "%d, %d: %zu items", i, j, i_at(i, j).size());
                 mvprintw(2, 0, "%c, %d", i_at(i, j)[0].symbol(), i_at(i, j)[0].color());
-                getch();
+                get_key();
             }
         }
     }
-    getch();
+    get_key();
 }
 
 void Map::draw(Game* g, WINDOW* w)
 {
-    int t = 0;
     int light = g->u.sight_range(g->light_level());
-    for (int realx = g->u.posx - SEEX; realx <= g->u.posx + SEEX; realx++) {
-        for (int realy = g->u.posy - SEEY; realy <= g->u.posy + SEEY; realy++) {
+    for (int realy = g->u.posy - SEEY; realy <= g->u.posy + SEEY; realy++) {
+        for (int realx = g->u.posx - SEEX; realx <= g->u.posx + SEEX; realx++) {
             if (rl_dist(g->u.posx, g->u.posy, realx, realy) > light) {
                 if (g->u.has_disease(DI_BOOMERED))
                     mvwputch(w, realx + SEEX - g->u.posx, realy + SEEY - g->u.posy, c_magenta, '#');
                 else
                     mvwputch(w, realx + SEEX - g->u.posx, realy + SEEY - g->u.posy, c_dkgray, '#');
-            } else if (sees(g->u.posx, g->u.posy, realx, realy, light, t))
+            } else if (g->u_fov.visible(realx, realy))
                 drawsq(w, g->u, realx, realy, false, true);
         }
     }
@@ -757,13 +880,14 @@ void Map::drawsq(WINDOW* w, player& u, int x, int y, bool invert, bool show_item
             sym = (*traps)[tr_at(x, y)]->sym;
     }
     // If there's a field here, draw that instead (unless its symbol is %)
-    if (field_at(x, y).type != fd_null) {
-        tercol = fieldlist[field_at(x, y).type].color[field_at(x, y).density - 1];
-        if (fieldlist[field_at(x, y).type].sym != '%')
-            sym = fieldlist[field_at(x, y).type].sym;
+    const field& fd = std::as_const(*this).field_at(x, y); // Drawing mustn't list the square
+    if (fd.type != fd_null) {
+        tercol = fieldlist[fd.type].color[fd.density - 1];
+        if (fieldlist[fd.type].sym != '%')
+            sym = fieldlist[fd.type].sym;
     }
     // If there's items here, draw those instead
-    if (show_items && i_at(x, y).size() > 0 && field_at(x, y).is_null()) {
+    if (show_items && i_at(x, y).size() > 0 && fd.is_null()) {
         if ((terlist[ter(x, y)].flags & flag_to_bit_position(container)))
             hi = true;
         else {
@@ -846,12 +970,25 @@ bool Map::sees(int Fx, int Fy, int Tx, int Ty, int range, int& tc)
     }
 }
 
-/*
-std::vector<point> map::route(int Fx, int Fy, int Tx, int Ty)
+bool Map::route(int Fx, int Fy, int Tx, int Ty, std::vector<Point>& path, bool opens_doors,
+                bool bashes, int budget)
 {
- point origin(Fx, Fy);
+    // Opening a door takes a turn; bashing through something takes several, if it works at all.
+    const int door_cost = 4, bash_cost = 12;
+    return pathfinder.find(Point(Fx, Fy), Point(Tx, Ty),
+                           [&](int x, int y) {
+                               const int cost = move_cost(x, y);
+                               if (cost > 0)
+                                   return cost;
+                               const ter_id t = ter_tiles[square_index(x, y)];
+                               if (opens_doors && (t == t_door_c || t == t_door_metal_c))
+                                   return door_cost;
+                               if (bashes && has_flag(bashable, x, y))
+                                   return bash_cost;
+                               return 0;
+                           },
+                           budget, path);
 }
-*/
 
 void Map::save(overmap* om, unsigned int turn, int x, int y)
 {
@@ -859,6 +996,8 @@ void Map::save(overmap* om, unsigned int turn, int x, int y)
         for (int gridy = 0; gridy < 3; gridy++)
             saven(om, turn, x, y, gridx, gridy);
     }
+    // Submaps we walked away from are only written back lazily; saving is the time to do it.
+    submap_cache().flush();
 }
 
 void Map::init(Game* g, int x, int y)
@@ -883,22 +1022,69 @@ void Map::load(Game* g, int wx, int wy)
 
 void Map::shift(Game* g, int wx, int wy, int sx, int sy)
 {
+    const ProfileScope profile {Phase::map_shift};
     // Shift the map sx submaps to the right and sy submaps down.
     // sx and sy should never be bigger than +/-1.
     // wx and wy are out position in the world, for saving/loading purposes.
     // 0 1 2
     // 3 4 5
     // 6 7 8
+    // Submaps that fall off the edge go to the cache, which writes them back when it needs the room
+    // or when the game is saved.
     for (int gridx = 0; gridx < 3; gridx++) {
-        for (int gridy = 0; gridy < 3; gridy++)
-            saven(&(g->cur_om), g->turn, wx, wy, gridx, gridy);
+        for (int gridy = 0; gridy < 3; gridy++) {
+            const int newx = gridx - sx, newy = gridy - sy;
+            if (newx < 0 || newx > 2 || newy < 0 || newy > 2)
+                submap_cache().put(submap_key(g->cur_om, wx, wy, gridx, gridy),
+                                   take_nonant(gridx + gridy * 3), g->turn);
+        }
+    }
+    // The ones that stay just move over in place...
+    shift_tiles(ter_tiles, sx, sy);
+    shift_tiles(itm_tiles, sx, sy);
+    shift_tiles(trp_tiles, sx, sy);
+    shift_tiles(fld_tiles, sx, sy);
+    shift_tiles(rad_tiles, sx, sy);
+    std::array<std::vector<spawn_point>, 9> shifted;
+    for (int gridx = 0; gridx < 3; gridx++) {
+        for (int gridy = 0; gridy < 3; gridy++) {
+            const int oldx = gridx + sx, oldy = gridy + sy;
+            if (oldx >= 0 && oldx <= 2 && oldy >= 0 && oldy <= 2)
+                shifted[gridx + gridy * 3] = std::move(spawns[oldx + oldy * 3]);
+        }
     }
+    spawns = std::move(shifted);
+    // ...and only the slots left behind are loaded.
     for (int gridx = 0; gridx < 3; gridx++) {
         for (int gridy = 0; gridy < 3; gridy++) {
+            const int oldx = gridx + sx, oldy = gridy + sy;
+            if (oldx >= 0 && oldx <= 2 && oldy >= 0 && oldy <= 2)
+                continue;
+            clear_nonant(gridx + gridy * 3);
             if (!loadn(g, wx + sx, wy + sy, gridx, gridy))
                 loadn(g, wx + sx, wy + sy, gridx, gridy);
         }
     }
+    // Only now, since the slots left behind held what moved out of them until they were loaded.
+    relist_fields();
+    relist_active_items();
+    invalidate_squares();
+}
+
+void Map::prefetch(Game* g, int wx, int wy, int sx, int sy)
+{
+    // Asks the store to start reading every submap a shift by sx, sy would load, plus those of the
+    // straight shifts when it's a diagonal one; only the submaps outside the current window that
+    // the cache doesn't already hold need reading.
+    for (int worldx = wx + std::min(sx, 0); worldx <= wx + 2 + std::max(sx, 0); worldx++) {
+        for (int worldy = wy + std::min(sy, 0); worldy <= wy + 2 + std::max(sy, 0); worldy++) {
+            if (worldx >= wx && worldx <= wx + 2 && worldy >= wy && worldy <= wy + 2)
+                continue;
+            const RecordKey key {submap_key(g->cur_om, worldx, worldy, 0, 0)};
+            if (!submap_cache().contains(key))
+                submap_records().prefetch(key);
+        }
+    }
 }
 
 // saven saves a single nonant.  worldx and worldy are used for the file
@@ -909,82 +1095,88 @@ void Map::shift(Game* g, int wx, int wy, int sx, int sy)
 // 0,2 1,2 2,2
 void Map::saven(overmap* om, unsigned int turn, int worldx, int worldy, int gridx, int gridy)
 {
+    const ProfileScope profile {Phase::submap_save};
     int n = gridx + gridy * 3;
-    // Open appropriate file.
-    char buff[32];
-    sprintf(buff, "save/m.%d.%d.%d", om->posx * OMAPX * 2 + worldx + gridx,
-            om->posy * OMAPY * 2 + worldy + gridy, om->posz);
-    std::ofstream fout;
-    fout.open(buff);
-
-    // Dump the turn this was last visited on.
-    fout << turn << std::endl;
-
-    // Dump the terrain. Add 33 to ter to get a human-readable number or symbol.
-    for (int j = 0; j < SEEY; j++) {
-        for (const auto& terrain : grid[n].ter) {
-            fout << static_cast<char>(static_cast<int>(terrain[j]) + 42);
-        }
+    const RecordKey key {submap_key(*om, worldx, worldy, gridx, gridy)};
+    const auto sm {std::make_unique<submap>()};
+    export_nonant(n, *sm, true);
+    const auto data {encode_submap(*sm, turn)};
+    submap_records().store(key, {data.data(), data.size()});
+}
 
-        fout << std::endl;
-    }
+// stashn hands a single freshly generated nonant to the submap cache, which
+// saves it along with everything else it holds.  The arguments are as for saven.
+void Map::stashn(const overmap& om, unsigned int turn, int worldx, int worldy, int gridx, int gridy)
+{
+    int n = gridx + gridy * 3;
+    submap_cache().put(submap_key(om, worldx, worldy, gridx, gridy), take_nonant(n), turn);
+}
 
-    // Dump the radiation.
+void Map::clear_nonant(int n)
+{
+    const int x0 = (n % 3) * SEEX, y0 = (n / 3) * SEEY;
     for (int j = 0; j < SEEY; j++) {
-        for (const auto& radiation : grid[n].rad) {
-            fout << radiation[j] << ' ';
-        }
+        const std::size_t row = square_index(x0, y0 + j);
+        std::fill_n(ter_tiles.begin() + row, SEEX, t_null);
+        for (int i = 0; i < SEEX; i++)
+            itm_tiles[row + i].clear();
+        std::fill_n(trp_tiles.begin() + row, SEEX, tr_null);
+        std::fill_n(fld_tiles.begin() + row, SEEX, field());
+        std::fill_n(rad_tiles.begin() + row, SEEX, 0);
     }
+    spawns[n].clear();
+    invalidate_squares();
+}
 
-    fout << std::endl;
-
-    // Items section; designate it with an I.  Then check itm[][] for each square
-    //   in the grid and print the coords and the item's details.
-    // Also, this wastes space since we print the coords for each item, when we
-    //   could be printing a list of items for each coord (except the empty ones)
-    Item tmp;
-    for (int j = 0; j < SEEY; j++) {
-        for (int i = 0; i < SEEX; i++) {
-            for (const auto& item : grid[n].itm[i][j]) {
-                tmp = item;
-                fout << "I " << i << " " << j << std::endl;
-                fout << tmp.save_info() << std::endl;
-
-                for (auto& content : tmp.contents) {
-                    fout << "C " << '\n' << content.save_info() << '\n';
-                }
-            }
-        }
-    }
-    // Output the traps
+void Map::import_nonant(int n, submap& sm)
+{
+    const int x0 = (n % 3) * SEEX, y0 = (n / 3) * SEEY;
     for (int j = 0; j < SEEY; j++) {
+        const std::size_t row = square_index(x0, y0 + j);
         for (int i = 0; i < SEEX; i++) {
-            if (grid[n].trp[i][j] != tr_null)
-                fout << "T " << i << " " << j << " " << grid[n].trp[i][j] << std::endl;
+            ter_tiles[row + i] = sm.ter[i][j];
+            itm_tiles[row + i] = std::move(sm.itm[i][j]);
+            trp_tiles[row + i] = sm.trp[i][j];
+            fld_tiles[row + i] = sm.fld[i][j];
+            rad_tiles[row + i] = sm.rad[i][j];
+            if (sm.fld[i][j].type != fd_null)
+                list_field(row + i);
+            if (has_active_item(row + i))
+                active_item_squares.insert(row + i);
         }
     }
+    spawns[n] = std::move(sm.spawns);
+    invalidate_squares();
+}
 
-    // Output the fields
-    field tmpf;
+void Map::export_nonant(int n, submap& sm, bool keep)
+{
+    const int x0 = (n % 3) * SEEX, y0 = (n / 3) * SEEY;
     for (int j = 0; j < SEEY; j++) {
+        const std::size_t row = square_index(x0, y0 + j);
         for (int i = 0; i < SEEX; i++) {
-            tmpf = grid[n].fld[i][j];
-            if (tmpf.type != fd_null)
-                fout << "F " << i << " " << j << " " << int(tmpf.type) << " " << int(tmpf.density)
-                     << " " << tmpf.age << std::endl;
+            sm.ter[i][j] = ter_tiles[row + i];
+            if (keep)
+                sm.itm[i][j] = itm_tiles[row + i];
+            else
+                sm.itm[i][j] = std::move(itm_tiles[row + i]);
+            sm.trp[i][j] = trp_tiles[row + i];
+            sm.fld[i][j] = fld_tiles[row + i];
+            sm.rad[i][j] = rad_tiles[row + i];
         }
     }
-    // Output the spawn points
-    spawn_point tmpsp;
-
-    for (const auto spawn : grid[n].spawns) {
-        tmpsp = spawn;
-        fout << "S " << static_cast<int>(tmpsp.type) << ' ' << tmpsp.count << ' ' << tmpsp.posx
-             << ' ' << tmpsp.posy << '\n';
-    }
+    if (keep)
+        sm.spawns = spawns[n];
+    else
+        sm.spawns = std::move(spawns[n]);
+}
 
-    // Close the file; that's all we need.
-    fout.close();
+std::unique_ptr<submap> Map::take_nonant(int n)
+{
+    auto sm = std::make_unique<submap>();
+    export_nonant(n, *sm, false);
+    clear_nonant(n);
+    return sm;
 }
 
 // worldx & worldy specify where in the world this is;
@@ -994,89 +1186,25 @@ void Map::saven(overmap* om, unsigned int turn, int worldx, int worldy, int grid
 // 0,2  1,2  2,2
 bool Map::loadn(Game* g, int worldx, int worldy, int gridx, int gridy)
 {
-    char fname[32];
-    char line[SEEX];
-    char ch;
+    const ProfileScope profile {Phase::submap_load};
     int gridn = gridx + gridy * 3;
-    int itx, ity, t, d, a, old_turn;
-    bool fields_here = false;
-    Item it_tmp;
-    std::ifstream mapin;
-    std::string databuff;
-
-    sprintf(fname, "save/m.%d.%d.%d", g->cur_om.posx * OMAPX * 2 + worldx + gridx,
-            g->cur_om.posy * OMAPY * 2 + worldy + gridy, g->cur_om.posz);
-    mapin.open(fname);
-    if (mapin.is_open()) {
-        // Load turn number
-        mapin >> old_turn;
-        // Turns since last visited.
-        const int turn_diff {
-            (static_cast<int>(g->turn) > old_turn ? static_cast<int>(g->turn) - old_turn : 0)};
-        mapin.getline(line, 1);
-        // Load terrain
-        for (int j = 0; j < SEEY; j++) {
-            mapin.getline(line, SEEX + 1);
-            for (int i = 0; i < SEEX; i++) {
-                grid[gridn].ter[i][j] = ter_id(line[i] - 42);
-                grid[gridn].itm[i][j].clear();
-                grid[gridn].trp[i][j] = tr_null;
-                grid[gridn].fld[i][j] = field();
-            }
-        }
-
-        // Load irradiation.
-        for (int j = 0; j < SEEY; j++) {
-            for (auto& radiation : grid[gridn].rad) {
-                int radtmp {0};
-                mapin >> radtmp;
-                radtmp -= turn_diff / 100; // Radiation slowly decays.
-
-                if (radtmp < 0) {
-                    radtmp = 0;
-                }
-
-                radiation[j] = radtmp;
-            }
-        }
-
-        // Load items and traps and fields and spawn points
-        while (!mapin.eof()) {
-            t = 0;
-            mapin >> ch;
-            if (!mapin.eof() && ch == 'I') {
-                mapin >> itx >> ity;
-                getline(mapin, databuff); // Clear out the endline
-                getline(mapin, databuff);
-                it_tmp.load_info(databuff, g);
-                grid[gridn].itm[itx][ity].push_back(it_tmp);
-            } else if (!mapin.eof() && ch == 'C') {
-                getline(mapin, databuff); // Clear out the endline
-                getline(mapin, databuff);
-                int index = grid[gridn].itm[itx][ity].size() - 1;
-                it_tmp.load_info(databuff, g);
-                grid[gridn].itm[itx][ity][index].put_in(it_tmp);
-            } else if (!mapin.eof() && ch == 'T') {
-                mapin >> itx >> ity >> t;
-                grid[gridn].trp[itx][ity] = trap_id(t);
-            } else if (!mapin.eof() && ch == 'F') {
-                fields_here = true;
-                mapin >> itx >> ity >> t >> d >> a;
-                grid[gridn].fld[itx][ity] = field(field_id(t), d, a);
-            } else if (!mapin.eof() && ch == 'S') {
-                mapin >> t >> a >> itx >> ity;
-                spawn_point tmp(mon_id(t), a, itx, ity);
-                grid[gridn].spawns.push_back(tmp);
-            }
-        }
-        mapin.close();
-        if (fields_here && turn_diff >= 8) {
-            for (int i = 0; i < int(turn_diff / 8); i++) {
-                if (!process_fields(g))
-                    i = int(turn_diff / 8) + 1;
-            }
-        }
-    } else {
+    unsigned int old_turn {0};
+    const RecordKey key {submap_key(g->cur_om, worldx, worldy, gridx, gridy)};
+
+    bool loaded {false};
+    if (auto cached {submap_cache().take(key)}) {
+        import_nonant(gridn, *cached->data);
+        old_turn = cached->turn;
+        loaded = true;
+    } else if (const auto data {submap_records().load(key)}) {
+        const auto sm {std::make_unique<submap>()};
+        loaded = decode_submap(*data, g->itypes, g->mtypes, *sm, old_turn);
+        if (loaded)
+            import_nonant(gridn, *sm);
+        else
+            debugmsg("Corrupt submap %d:%d:%d; regenerating it.", key.x, key.y, key.z);
+    }
+    if (!loaded) {
         // No data on this area.
         Map tmp_map(itypes, mapitems, traps);
         // overx, overy is where in the overmap we need to pull data from
@@ -1091,9 +1219,30 @@ bool Map::loadn(Game* g, int worldx, int worldy, int gridx, int gridy)
         if (worldx + gridx < 0)
             newmapx = worldx + gridx;
         tmp_map.generate(g, &(g->cur_om), newmapx, newmapy, g->turn);
-        mapin.close();
-        return false;
+        // The new submaps are waiting in the cache; ours is fresh, so there's nothing to catch
+        // up on.
+        auto generated {submap_cache().take(key)};
+        if (!generated)
+            return false;
+        import_nonant(gridn, *generated->data);
+        return true;
+    }
+    // Turns since last visited.
+    const int turn_diff {(static_cast<int>(g->turn) > static_cast<int>(old_turn)
+                              ? static_cast<int>(g->turn) - static_cast<int>(old_turn)
+                              : 0)};
+    bool fields_here = false;
+    for (int j = 0; j < SEEY; j++) {
+        const std::size_t row = square_index(gridx * SEEX, gridy * SEEY + j);
+        for (int i = 0; i < SEEX; i++) {
+            // Radiation slowly decays.
+            rad_tiles[row + i] = std::max(rad_tiles[row + i] - turn_diff / 100, 0);
+            if (fld_tiles[row + i].type != fd_null)
+                fields_here = true;
+        }
     }
+    if (fields_here && turn_diff >= 8)
+        advance_fields(g, turn_diff / 8);
     return true;
 }
 
@@ -1103,7 +1252,7 @@ void Map::spawn_monsters(Game* g)
         for (int gy = 0; gy < 3; gy++) {
             int n = gx + gy * 3;
 
-            for (const auto& spawn : grid[n].spawns) {
+            for (const auto& spawn : spawns[n]) {
                 for (int j {0}; j < spawn.count; ++j) {
                     int tries = 0;
                     int mx = spawn.posx, my = spawn.posy;
@@ -1128,7 +1277,7 @@ void Map::spawn_monsters(Game* g)
                 }
             }
 
-            grid[n].spawns.clear();
+            spawns[n].clear();
         }
     }
 }
@@ -1139,26 +1288,4 @@ bool inbounds(int x, int y)
         return false;
     return true;
 }
-
-void cast_to_nonant(int& x, int& y, int& n)
-{
-    n = int(x / SEEX) + int(y / SEEY) * 3;
-    if (n < 0) {
-        n = 0;
-    } else if (n > 8) {
-        n = 8;
-    }
-    x -= SEEX * int(x / SEEX);
-    y -= SEEY * int(y / SEEY);
-    if (x < 0) {
-        x = 0;
-    } else if (x >= SEEX) {
-        x = SEEX - 1;
-    }
-    if (y < 0) {
-        y = 0;
-    } else if (y >= SEEY) {
-        y = SEEY - 1;
-    }
-}
 } // namespace oocdda
@@ -1,6 +1,11 @@
 #ifndef OOCDDA_MAP_HPP
 #define OOCDDA_MAP_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -12,6 +17,7 @@
 #include "mapitems.hpp"
 #include "monster_type.hpp"
 #include "omdata.hpp"
+#include "path_finder.hpp"
 #include "point.hpp"
 #include "trap.hpp"
 
@@ -41,6 +47,7 @@ public:
     void save(overmap* om, unsigned int turn, int x, int y);
     void load(Game* g, int wx, int wy);
     void shift(Game* g, int wx, int wy, int x, int y);
+    void prefetch(Game* g, int wx, int wy, int x, int y); // Read ahead for shift(g, wx, wy, x, y)
     void spawn_monsters(Game* g);
 
     // Movement and LOS
@@ -50,14 +57,19 @@ public:
     // tc indicates the Bresenham line used to connect the two points, and may
     //  subsequently be used to form a path between them
     bool sees(int Fx, int Fy, int Tx, int Ty, int range, int& tc);
-    // std::vector<point> route(int Fx, int Fy, int Tx, int Ty); // Best route
+    // Cheapest way from (Fx, Fy) to (Tx, Ty), put in path without the starting square.  Closed
+    //  doors are counted in if opens_doors, and anything bashable if bashes.  Gives up, leaving
+    //  path empty and returning false, after looking at budget squares.
+    bool route(int Fx, int Fy, int Tx, int Ty, std::vector<Point>& path, bool opens_doors,
+               bool bashes, int budget = 400);
 
     // Terrain
-    ter_id& ter(int x, int y);          // Terrain at coord (x, y); {x|y}=(0, SEE{X|Y}*3]
+    ter_id ter(int x, int y) const;     // Terrain at coord (x, y); {x|y}=(0, SEE{X|Y}*3]
     std::string tername(int x, int y);  // Name of terrain at (x, y)
     std::string features(int x, int y); // Words relevant to terrain (sharp, etc)
     bool has_flag(t_flag flag, int x, int y);
     bool is_destructable(int x, int y);
+    void set_ter(int x, int y, ter_id new_terrain); // Out-of-bounds squares are left alone
 
     bool close_door(int x, int y);
     bool open_door(int x, int y, bool inside);
@@ -77,6 +89,7 @@ public:
     void add_item(int x, int y, itype* type, int birthday);
     void add_item(int x, int y, Item new_item);
     void process_active_items(Game* g);
+    std::vector<Point> listed_active_items() const; // Squares process_active_items will visit
 
     // Traps
     trap_id& tr_at(int x, int y);
@@ -85,10 +98,13 @@ public:
 
     // Fields
     field& field_at(int x, int y);
+    const field& field_at(int x, int y) const; // Just a look; leaves the cached planes alone
     bool add_field(Game* g, int x, int y, field_id t, unsigned char density);
     bool process_fields(Game* g);
+    void advance_fields(Game* g, int turns); // process_fields for that many turns, as one batch
     void step_in_field(int x, int y, Game* g);
     void mon_in_field(int x, int y, Monster* z);
+    std::vector<Point> listed_fields() const; // Squares process_fields will visit
     // mapgen.h functions
     void place_items(
         items_location loc, int chance, int x1, int y1, int x2, int y2, bool ongrass, int turn);
@@ -97,6 +113,7 @@ public:
 
 private:
     void saven(overmap* om, unsigned int turn, int x, int y, int gridx, int gridy);
+    void stashn(const overmap& om, unsigned int turn, int x, int y, int gridx, int gridy);
     bool loadn(Game* g, int x, int y, int gridx, int gridy);
     void draw_map(oter_id terrain_type,
                   oter_id t_north,
@@ -107,14 +124,56 @@ private:
                   int turn);
     void rotate(int turns); // Rotates the current map 90*turns degress clockwise
                             // Useful for houses, shops, etc
-
-    submap grid[9];
+    // Moving whole submaps in and out of the window; n is the nonant, as for grid in saven
+    void clear_nonant(int n);
+    void import_nonant(int n, submap& sm);            // Moves the contents of sm into nonant n
+    void export_nonant(int n, submap& sm, bool keep); // Copies (keep) or moves nonant n into sm
+    std::unique_ptr<submap> take_nonant(int n);       // Moves nonant n out, leaving it empty
+    bool process_field(Game* g, int x, int y); // process_fields for one square; false if empty
+    void list_field(std::size_t n);             // Square n has, or may be about to get, a field
+    void relist_fields();                       // Lists every square that has a field
+    void prune_fields();                        // Forgets the squares whose field has gone
+    bool has_active_item(std::size_t n) const;  // Something on square n is switched on
+    void relist_active_items();                 // Lists every square with something switched on
+    // Fills in the cached planes for square n from its terrain and field
+    void cache_square(std::size_t n);
+    std::size_t cached_square(int x, int y); // Index of in-bounds (x, y), cached if it wasn't
+    void invalidate_squares();               // Whole submaps were swapped or rewritten
+    void invalidate_square(int x, int y);    // (x, y) was changed through a held reference
+
+    // The 3x3 window of submaps as one plane per submap member, one row of squares after another,
+    // so (x, y) is at y * SEEX * 3 + x and sweeping the map walks memory in order.
+    std::array<ter_id, SEEX * 3 * SEEY * 3> ter_tiles {};
+    std::array<std::vector<Item>, SEEX * 3 * SEEY * 3> itm_tiles;
+    std::array<trap_id, SEEX * 3 * SEEY * 3> trp_tiles {};
+    std::array<field, SEEX * 3 * SEEY * 3> fld_tiles;
+    std::array<int, SEEX * 3 * SEEY * 3> rad_tiles {};
+    std::array<std::vector<spawn_point>, 9> spawns; // Per nonant, relative to it
     std::vector<Item> nulitems; // Returned when &i_at() is asked for an OOB value
-    ter_id nulter;              // Returned when &ter() is asked for an OOB value
     trap_id nultrap;            // Returned when &tr_at() is asked for an OOB value
     field nulfield;             // Returned when &field_at() is asked for an OOB value
     int nulrad;                 // OOB &radiation()
 
+    // What move_cost(), trans() and has_flag() need, one row of squares after another. set_ter()
+    // marks its square stale (stale_square in cost_plane), as does field_at() since it hands out a
+    // reference, and the square is worked out again on the next query.
+    static constexpr unsigned char stale_square {255};
+    std::array<unsigned char, SEEX * 3 * SEEY * 3> cost_plane;
+    std::array<bool, SEEX * 3 * SEEY * 3> trans_plane;
+    std::array<std::uint16_t, SEEX * 3 * SEEY * 3> flag_plane;
+
+    // The squares process_fields visits, in map order: those with a field, plus any handed out by
+    // field_at() since the last pass, since the caller may have put one there.
+    std::set<std::size_t> field_squares;
+    std::array<bool, SEEX * 3 * SEEY * 3> field_listed {};
+
+    // The squares process_active_items visits, in map order: those holding a lit flare, a burning
+    // torch or anything else switched on. Items are only ever switched on in someone's hands, so
+    // add_item is the way in; squares are dropped once nothing on them is active any more.
+    std::set<std::size_t> active_item_squares;
+
+    PathFinder pathfinder {SEEX * 3, SEEY * 3, 2}; // Nothing passable costs less than 2
+
     std::vector<itype*>* itypes;
     std::vector<trap*>* traps;
     std::vector<itype_id> (*mapitems)[num_itloc];
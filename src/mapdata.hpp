@@ -377,7 +377,7 @@ struct field {
         age = a;
     }
 
-    bool is_null()
+    bool is_null() const
     {
         if (type == fd_null || type == fd_blood || type == fd_bile || type == fd_slime)
             return true;
@@ -12,7 +12,9 @@
 #include "omdata.hpp"
 #include "output.hpp"
 #include "overmap.hpp"
+#include "overmap_cache.hpp"
 #include "point.hpp"
+#include "profiler.hpp"
 #include "rng.hpp"
 #include "trap.hpp"
 
@@ -53,6 +55,8 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn);
 
 void Map::generate(Game* g, overmap* om, int x, int y, int turn)
 {
+    const ProfileScope profile {Phase::mapgen};
+    const RngScope scope {RngStream::mapgen};
     oter_id terrain_type, t_north, t_east, t_south, t_west, t_above;
     int overx = x / 2;
     int overy = y / 2;
@@ -74,71 +78,71 @@ void Map::generate(Game* g, overmap* om, int x, int y, int turn)
             overy = (OMAPY * 2 + y) / 2;
             sy = -1;
         }
-        overmap tmp(g, om->posx + sx, om->posy + sy, om->posz);
-        terrain_type = tmp.ter(overx, overy);
+        const auto tmp {overmap_cache().get(g, om->posx + sx, om->posy + sy, om->posz)};
+        terrain_type = tmp->ter(overx, overy);
         if (om->posz < 0 || om->posz == 9) { // 9 is for tutorial overmap
-            overmap tmp2 = overmap(g, om->posx, om->posy, om->posz + 1);
-            t_above = tmp2.ter(overx, overy);
+            const auto tmp2 {overmap_cache().get(g, om->posx, om->posy, om->posz + 1)};
+            t_above = tmp2->ter(overx, overy);
         } else
             t_above = ot_null;
         if (overy - 1 >= 0)
-            t_north = tmp.ter(overx, overy - 1);
+            t_north = tmp->ter(overx, overy - 1);
         else
             t_north = om->ter(overx, OMAPY - 1);
         if (overx + 1 < OMAPX)
-            t_east = tmp.ter(overx + 1, overy - 1);
+            t_east = tmp->ter(overx + 1, overy - 1);
         else
             t_east = om->ter(0, overy);
         if (overy + 1 < OMAPY)
-            t_south = tmp.ter(overx, overy + 1);
+            t_south = tmp->ter(overx, overy + 1);
         else
             t_south = om->ter(overx, 0);
         if (overx - 1 >= 0)
-            t_west = tmp.ter(overx - 1, overy);
+            t_west = tmp->ter(overx - 1, overy);
         else
             t_west = om->ter(OMAPX - 1, overy);
         draw_map(terrain_type, t_north, t_east, t_south, t_west, t_above, turn);
         for (int i = 0; i < 2; i++) {
             for (int j = 0; j < 2; j++)
-                saven(&tmp, turn, overx * 2, overy * 2, i, j);
+                stashn(*tmp, turn, overx * 2, overy * 2, i, j);
         }
     } else {
         if (om->posz < 0 || om->posz == 9) { // 9 is for tutorials
-            overmap tmp = overmap(g, om->posx, om->posy, om->posz + 1);
-            t_above = tmp.ter(overx, overy);
+            const auto tmp {overmap_cache().get(g, om->posx, om->posy, om->posz + 1)};
+            t_above = tmp->ter(overx, overy);
         } else
             t_above = ot_null;
         terrain_type = om->ter(overx, overy);
         if (overy - 1 >= 0)
             t_north = om->ter(overx, overy - 1);
         else {
-            overmap tmp(g, om->posx, om->posy - 1, 0);
-            t_north = tmp.ter(overx, OMAPY - 1);
+            const auto tmp {overmap_cache().get(g, om->posx, om->posy - 1, 0)};
+            t_north = tmp->ter(overx, OMAPY - 1);
         }
         if (overx + 1 < OMAPX)
             t_east = om->ter(overx + 1, overy);
         else {
-            overmap tmp(g, om->posx + 1, om->posy, 0);
-            t_east = tmp.ter(0, overy);
+            const auto tmp {overmap_cache().get(g, om->posx + 1, om->posy, 0)};
+            t_east = tmp->ter(0, overy);
         }
         if (overy + 1 < OMAPY)
             t_south = om->ter(overx, overy + 1);
         else {
-            overmap tmp(g, om->posx, om->posy + 1, 0);
-            t_south = tmp.ter(overx, 0);
+            const auto tmp {overmap_cache().get(g, om->posx, om->posy + 1, 0)};
+            t_south = tmp->ter(overx, 0);
         }
         if (overx - 1 >= 0)
             t_west = om->ter(overx - 1, overy);
         else {
-            overmap tmp(g, om->posx - 1, om->posy, 0);
-            t_west = tmp.ter(OMAPX - 1, overy);
+            const auto tmp {overmap_cache().get(g, om->posx - 1, om->posy, 0)};
+            t_west = tmp->ter(OMAPX - 1, overy);
         }
         draw_map(terrain_type, t_north, t_east, t_south, t_west, t_above, turn);
 
-        // And finally save.
+        // And finally hand the new submaps over to be cached and saved.
         for (int i = 0; i < 2; i++) {
             for (int j = 0; j < 2; j++)
-                saven(om, turn, x, y, i, j);
+                stashn(*om, turn, x, y, i, j);
         }
     }
 }
@@ -169,7 +173,7 @@ void Map::draw_map(oter_id terrain_type,
     case ot_null:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
-                ter(i, j) = t_null;
+                set_ter(i, j, t_null);
                 radiation(i, j) = 0;
             }
         }
@@ -178,7 +182,7 @@ void Map::draw_map(oter_id terrain_type,
     case ot_field:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = grass_or_dirt();
+                set_ter(i, j, grass_or_dirt());
         }
         place_items(mi_field, 60, 0, 0, SEEX * 2 - 1, SEEY * 2 - 2, true, turn);
         break;
@@ -249,13 +253,13 @@ void Map::draw_map(oter_id terrain_type,
                 rn = rng(0, forest_chance);
 
                 if ((forest_chance > 0 && rn > 13) || one_in(100 - forest_chance)) {
-                    ter(i, j) = ter_id::t_tree;
+                    set_ter(i, j, ter_id::t_tree);
                 } else if ((forest_chance > 0 && rn > 10) || one_in(100 - forest_chance)) {
-                    ter(i, j) = ter_id::t_tree_young;
+                    set_ter(i, j, ter_id::t_tree_young);
                 } else if ((forest_chance > 0 && rn > 9) || one_in(100 - forest_chance)) {
-                    ter(i, j) = ter_id::t_underbrush;
+                    set_ter(i, j, ter_id::t_underbrush);
                 } else {
-                    ter(i, j) = ter_id::t_dirt;
+                    set_ter(i, j, ter_id::t_dirt);
                 }
             }
         }
@@ -299,9 +303,9 @@ void Map::draw_map(oter_id terrain_type,
             for (int i = 0; i < 20; i++) {
                 if (x >= 0 && x < SEEX * 2 && y >= 0 && y < SEEY * 2) {
                     if (ter(x, y) == t_water_sh)
-                        ter(x, y) = t_water_dp;
+                        set_ter(x, y, t_water_dp);
                     else if (ter(x, y) == t_dirt || ter(x, y) == t_underbrush)
-                        ter(x, y) = t_water_sh;
+                        set_ter(x, y, t_water_sh);
                 } else
                     i = 20;
                 x += rng(-2, 2);
@@ -313,22 +317,22 @@ void Map::draw_map(oter_id terrain_type,
                 for (int j = 0; j < n_fac; j++) {
                     int wx = rng(0, SEEX * 2 - 1), wy = rng(0, SEEY - 1);
                     if (ter(wx, wy) == t_dirt || ter(wx, wy) == t_underbrush)
-                        ter(wx, wy) = t_water_sh;
+                        set_ter(wx, wy, t_water_sh);
                 }
                 for (int j = 0; j < e_fac; j++) {
                     int wx = rng(SEEX, SEEX * 2 - 1), wy = rng(0, SEEY * 2 - 1);
                     if (ter(wx, wy) == t_dirt || ter(wx, wy) == t_underbrush)
-                        ter(wx, wy) = t_water_sh;
+                        set_ter(wx, wy, t_water_sh);
                 }
                 for (int j = 0; j < s_fac; j++) {
                     int wx = rng(0, SEEX * 2 - 1), wy = rng(SEEY, SEEY * 2 - 1);
                     if (ter(wx, wy) == t_dirt || ter(wx, wy) == t_underbrush)
-                        ter(wx, wy) = t_water_sh;
+                        set_ter(wx, wy, t_water_sh);
                 }
                 for (int j = 0; j < w_fac; j++) {
                     int wx = rng(0, SEEX - 1), wy = rng(0, SEEY * 2 - 1);
                     if (ter(wx, wy) == t_dirt || ter(wx, wy) == t_underbrush)
-                        ter(wx, wy) = t_water_sh;
+                        set_ter(wx, wy, t_water_sh);
                 }
             }
             rn = rng(0, 2) * rng(0, 1) * (rng(0, 1) + rng(0, 1)); // Good chance of 0
@@ -337,7 +341,7 @@ void Map::draw_map(oter_id terrain_type,
                 y = rng(0, SEEY * 2 - 1);
                 add_trap(x, y, tr_sinkhole);
                 if (ter(x, y) != t_water_sh)
-                    ter(x, y) = t_dirt;
+                    set_ter(x, y, t_dirt);
             }
         }
         break;
@@ -349,13 +353,13 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 rn = rng(0, 14);
                 if (rn > 13) {
-                    ter(i, j) = t_tree;
+                    set_ter(i, j, t_tree);
                 } else if (rn > 11) {
-                    ter(i, j) = t_tree_young;
+                    set_ter(i, j, t_tree_young);
                 } else if (rn > 10) {
-                    ter(i, j) = t_underbrush;
+                    set_ter(i, j, t_underbrush);
                 } else {
-                    ter(i, j) = t_dirt;
+                    set_ter(i, j, t_dirt);
                 }
             }
         }
@@ -364,127 +368,127 @@ void Map::draw_map(oter_id terrain_type,
             for (int i = (j == 5 || j == 17 ? 3 : 6); i < SEEX * 2; i += 6) {
                 if (!one_in(8)) {
                     // Caps are always there
-                    ter(i, j - 5) = t_wax;
-                    ter(i, j + 5) = t_wax;
+                    set_ter(i, j - 5, t_wax);
+                    set_ter(i, j + 5, t_wax);
                     for (int k = -2; k <= 2; k++) {
                         for (int l = -1; l <= 1; l++) {
-                            ter(i + k, j + l) = t_floor_wax;
+                            set_ter(i + k, j + l, t_floor_wax);
                         }
                     }
-                    ter(i, j - 3) = t_floor_wax;
-                    ter(i, j + 3) = t_floor_wax;
-                    ter(i - 1, j - 2) = t_floor_wax;
-                    ter(i, j - 2) = t_floor_wax;
-                    ter(i + 1, j - 2) = t_floor_wax;
-                    ter(i - 1, j + 2) = t_floor_wax;
-                    ter(i, j + 2) = t_floor_wax;
-                    ter(i + 1, j + 2) = t_floor_wax;
+                    set_ter(i, j - 3, t_floor_wax);
+                    set_ter(i, j + 3, t_floor_wax);
+                    set_ter(i - 1, j - 2, t_floor_wax);
+                    set_ter(i, j - 2, t_floor_wax);
+                    set_ter(i + 1, j - 2, t_floor_wax);
+                    set_ter(i - 1, j + 2, t_floor_wax);
+                    set_ter(i, j + 2, t_floor_wax);
+                    set_ter(i + 1, j + 2, t_floor_wax);
 
                     // Up to two of these get skipped; an entrance to the cell
                     int skip1 = rng(0, 23);
                     int skip2 = rng(0, 23);
                     if (skip1 != 0 && skip2 != 0)
-                        ter(i - 1, j - 4) = t_wax;
+                        set_ter(i - 1, j - 4, t_wax);
                     else
-                        ter(i - 1, j - 4) = t_floor_wax;
+                        set_ter(i - 1, j - 4, t_floor_wax);
                     if (skip1 != 1 && skip2 != 1)
-                        ter(i, j - 4) = t_wax;
+                        set_ter(i, j - 4, t_wax);
                     else
-                        ter(i, j - 4) = t_floor_wax;
+                        set_ter(i, j - 4, t_floor_wax);
                     if (skip1 != 2 && skip2 != 2)
-                        ter(i + 1, j - 4) = t_wax;
+                        set_ter(i + 1, j - 4, t_wax);
                     else
-                        ter(i + 1, j - 4) = t_floor_wax;
+                        set_ter(i + 1, j - 4, t_floor_wax);
 
                     if (skip1 != 3 && skip2 != 3)
-                        ter(i - 2, j - 3) = t_wax;
+                        set_ter(i - 2, j - 3, t_wax);
                     else
-                        ter(i - 2, j - 3) = t_floor_wax;
+                        set_ter(i - 2, j - 3, t_floor_wax);
                     if (skip1 != 4 && skip2 != 4)
-                        ter(i - 1, j - 3) = t_wax;
+                        set_ter(i - 1, j - 3, t_wax);
                     else
-                        ter(i - 1, j - 3) = t_floor_wax;
+                        set_ter(i - 1, j - 3, t_floor_wax);
                     if (skip1 != 5 && skip2 != 5)
-                        ter(i + 1, j - 3) = t_wax;
+                        set_ter(i + 1, j - 3, t_wax);
                     else
-                        ter(i + 1, j - 3) = t_floor_wax;
+                        set_ter(i + 1, j - 3, t_floor_wax);
                     if (skip1 != 6 && skip2 != 6)
-                        ter(i + 2, j - 3) = t_wax;
+                        set_ter(i + 2, j - 3, t_wax);
                     else
-                        ter(i + 2, j - 3) = t_floor_wax;
+                        set_ter(i + 2, j - 3, t_floor_wax);
 
                     if (skip1 != 7 && skip2 != 7)
-                        ter(i - 3, j - 2) = t_wax;
+                        set_ter(i - 3, j - 2, t_wax);
                     else
-                        ter(i - 3, j - 2) = t_floor_wax;
+                        set_ter(i - 3, j - 2, t_floor_wax);
                     if (skip1 != 8 && skip2 != 8)
-                        ter(i - 2, j - 2) = t_wax;
+                        set_ter(i - 2, j - 2, t_wax);
                     else
-                        ter(i - 2, j - 2) = t_floor_wax;
+                        set_ter(i - 2, j - 2, t_floor_wax);
                     if (skip1 != 9 && skip2 != 9)
-                        ter(i + 2, j - 2) = t_wax;
+                        set_ter(i + 2, j - 2, t_wax);
                     else
-                        ter(i + 2, j - 2) = t_floor_wax;
+                        set_ter(i + 2, j - 2, t_floor_wax);
                     if (skip1 != 10 && skip2 != 10)
-                        ter(i + 3, j - 2) = t_wax;
+                        set_ter(i + 3, j - 2, t_wax);
                     else
-                        ter(i + 3, j - 2) = t_floor_wax;
+                        set_ter(i + 3, j - 2, t_floor_wax);
 
                     if (skip1 != 11 && skip2 != 11)
-                        ter(i - 3, j - 1) = t_wax;
+                        set_ter(i - 3, j - 1, t_wax);
                     else
-                        ter(i - 3, j - 1) = t_floor_wax;
+                        set_ter(i - 3, j - 1, t_floor_wax);
                     if (skip1 != 12 && skip2 != 12)
-                        ter(i - 3, j) = t_wax;
+                        set_ter(i - 3, j, t_wax);
                     else
-                        ter(i - 3, j) = t_floor_wax;
+                        set_ter(i - 3, j, t_floor_wax);
                     if (skip1 != 13 && skip2 != 13)
-                        ter(i - 3, j - 1) = t_wax;
+                        set_ter(i - 3, j - 1, t_wax);
                     else
-                        ter(i - 3, j - 1) = t_floor_wax;
+                        set_ter(i - 3, j - 1, t_floor_wax);
 
                     if (skip1 != 14 && skip2 != 14)
-                        ter(i - 3, j + 1) = t_wax;
+                        set_ter(i - 3, j + 1, t_wax);
                     else
-                        ter(i - 3, j + 1) = t_floor_wax;
+                        set_ter(i - 3, j + 1, t_floor_wax);
                     if (skip1 != 15 && skip2 != 15)
-                        ter(i - 3, j) = t_wax;
+                        set_ter(i - 3, j, t_wax);
                     else
-                        ter(i - 3, j) = t_floor_wax;
+                        set_ter(i - 3, j, t_floor_wax);
                     if (skip1 != 16 && skip2 != 16)
-                        ter(i - 3, j + 1) = t_wax;
+                        set_ter(i - 3, j + 1, t_wax);
                     else
-                        ter(i - 3, j + 1) = t_floor_wax;
+                        set_ter(i - 3, j + 1, t_floor_wax);
 
                     if (skip1 != 17 && skip2 != 17)
-                        ter(i - 2, j + 3) = t_wax;
+                        set_ter(i - 2, j + 3, t_wax);
                     else
-                        ter(i - 2, j + 3) = t_floor_wax;
+                        set_ter(i - 2, j + 3, t_floor_wax);
                     if (skip1 != 18 && skip2 != 18)
-                        ter(i - 1, j + 3) = t_wax;
+                        set_ter(i - 1, j + 3, t_wax);
                     else
-                        ter(i - 1, j + 3) = t_floor_wax;
+                        set_ter(i - 1, j + 3, t_floor_wax);
                     if (skip1 != 19 && skip2 != 19)
-                        ter(i + 1, j + 3) = t_wax;
+                        set_ter(i + 1, j + 3, t_wax);
                     else
-                        ter(i + 1, j + 3) = t_floor_wax;
+                        set_ter(i + 1, j + 3, t_floor_wax);
                     if (skip1 != 20 && skip2 != 20)
-                        ter(i + 2, j + 3) = t_wax;
+                        set_ter(i + 2, j + 3, t_wax);
                     else
-                        ter(i + 2, j + 3) = t_floor_wax;
+                        set_ter(i + 2, j + 3, t_floor_wax);
 
                     if (skip1 != 21 && skip2 != 21)
-                        ter(i - 1, j + 4) = t_wax;
+                        set_ter(i - 1, j + 4, t_wax);
                     else
-                        ter(i - 1, j + 4) = t_floor_wax;
+                        set_ter(i - 1, j + 4, t_floor_wax);
                     if (skip1 != 22 && skip2 != 22)
-                        ter(i, j + 4) = t_wax;
+                        set_ter(i, j + 4, t_wax);
                     else
-                        ter(i, j + 4) = t_floor_wax;
+                        set_ter(i, j + 4, t_floor_wax);
                     if (skip1 != 23 && skip2 != 23)
-                        ter(i + 1, j + 4) = t_wax;
+                        set_ter(i + 1, j + 4, t_wax);
                     else
-                        ter(i + 1, j + 4) = t_floor_wax;
+                        set_ter(i + 1, j + 4, t_floor_wax);
 
                     if (terrain_type == ot_hive)
                         place_items(mi_hive, 80, i - 2, j - 2, i + 2, j + 2, false, turn);
@@ -509,14 +513,14 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 4 || i >= SEEX * 2 - 4) {
                     if (rn == 1)
-                        ter(i, j) = t_sidewalk;
+                        set_ter(i, j, t_sidewalk);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else {
                     if ((i == SEEX - 1 || i == SEEX) && j % 4 != 0)
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
@@ -540,15 +544,15 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i >= SEEX * 2 - 4 && j < 4) || i < 4 || j >= SEEY * 2 - 4) {
                     if (rn == 1)
-                        ter(i, j) = t_sidewalk;
+                        set_ter(i, j, t_sidewalk);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else {
                     if (((i == SEEX - 1 || i == SEEX) && j % 4 != 0 && j < SEEY - 1)
                         || ((j == SEEY - 1 || j == SEEY) && i % 4 != 0 && i > SEEX))
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
@@ -576,15 +580,15 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 4 || (i >= SEEX * 2 - 4 && (j < 4 || j >= SEEY * 2 - 4))) {
                     if (rn == 1)
-                        ter(i, j) = t_sidewalk;
+                        set_ter(i, j, t_sidewalk);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else {
                     if (((i == SEEX - 1 || i == SEEX) && j % 4 != 0)
                         || ((j == SEEY - 1 || j == SEEY) && i % 4 != 0 && i > SEEX))
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
@@ -609,53 +613,53 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (rn == 2)
-                    ter(i, j) = t_sidewalk;
+                    set_ter(i, j, t_sidewalk);
                 else if ((i < 4 || i >= SEEX * 2 - 4) && (j < 4 || j >= SEEY * 2 - 4)) {
                     if (rn == 1)
-                        ter(i, j) = t_sidewalk;
+                        set_ter(i, j, t_sidewalk);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else {
                     if (((i == SEEX - 1 || i == SEEX) && j % 4 != 0)
                         || ((j == SEEY - 1 || j == SEEY) && i % 4 != 0))
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
         if (rn == 2) {        // Special embellishments for a plaza
             if (one_in(10)) { // Fountain
                 for (int i = SEEX - 2; i <= SEEX + 2; i++) {
-                    ter(i, i) = t_water_sh;
-                    ter(i, SEEX * 2 - i) = t_water_sh;
+                    set_ter(i, i, t_water_sh);
+                    set_ter(i, SEEX * 2 - i, t_water_sh);
                 }
             }
             if (one_in(10)) { // Small trees in center
-                ter(SEEX - 1, SEEY - 2) = t_tree_young;
-                ter(SEEX, SEEY - 2) = t_tree_young;
-                ter(SEEX - 1, SEEY + 2) = t_tree_young;
-                ter(SEEX, SEEY + 2) = t_tree_young;
-                ter(SEEX - 2, SEEY - 1) = t_tree_young;
-                ter(SEEX - 2, SEEY) = t_tree_young;
-                ter(SEEX + 2, SEEY - 1) = t_tree_young;
-                ter(SEEX + 2, SEEY) = t_tree_young;
+                set_ter(SEEX - 1, SEEY - 2, t_tree_young);
+                set_ter(SEEX, SEEY - 2, t_tree_young);
+                set_ter(SEEX - 1, SEEY + 2, t_tree_young);
+                set_ter(SEEX, SEEY + 2, t_tree_young);
+                set_ter(SEEX - 2, SEEY - 1, t_tree_young);
+                set_ter(SEEX - 2, SEEY, t_tree_young);
+                set_ter(SEEX + 2, SEEY - 1, t_tree_young);
+                set_ter(SEEX + 2, SEEY, t_tree_young);
             }
             if (one_in(14)) { // Rows of small trees
                 int gap = rng(2, 4);
                 int start = rng(0, 4);
                 for (int i = 2; i < SEEX * 2 - start; i += gap) {
-                    ter(i, start) = t_tree_young;
-                    ter(SEEX * 2 - i - 1, start) = t_tree_young;
-                    ter(start, i) = t_tree_young;
-                    ter(start, SEEY * 2 - i - 1) = t_tree_young;
+                    set_ter(i, start, t_tree_young);
+                    set_ter(SEEX * 2 - i - 1, start, t_tree_young);
+                    set_ter(start, i, t_tree_young);
+                    set_ter(start, SEEY * 2 - i - 1, t_tree_young);
                 }
             }
             place_items(mi_trash, 5, 0, 0, SEEX * 2 - 1, SEEX * 2 - 1, true, 0);
         } else
             place_items(mi_road, 5, 0, 0, SEEX * 2 - 1, SEEX * 2 - 1, false, turn);
         if (terrain_type == ot_road_nesw_manhole)
-            ter(rng(6, SEEX * 2 - 6), rng(6, SEEX * 2 - 6)) = t_manhole_cover;
+            set_ter(rng(6, SEEX * 2 - 6), rng(6, SEEX * 2 - 6), t_manhole_cover);
         break;
 
     case ot_bridge_ns:
@@ -663,14 +667,14 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 4 || i >= SEEX * 2 - 4)
-                    ter(i, j) = t_water_dp;
+                    set_ter(i, j, t_water_dp);
                 else if (i == 4 || i == SEEX * 2 - 5)
-                    ter(i, j) = t_railing_v;
+                    set_ter(i, j, t_railing_v);
                 else {
                     if ((i == SEEX - 1 || i == SEEX) && j % 4 != 0)
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
@@ -684,14 +688,14 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 3 || i >= SEEX * 2 - 3)
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
                 else if (i == 3 || i == SEEX * 2 - 4)
-                    ter(i, j) = t_railing_v;
+                    set_ter(i, j, t_railing_v);
                 else {
                     if ((i == SEEX - 1 || i == SEEX) && j % 4 != 0)
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 }
             }
         }
@@ -703,7 +707,7 @@ void Map::draw_map(oter_id terrain_type,
     case ot_river_center:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_water_dp;
+                set_ter(i, j, t_water_dp);
         }
         break;
 
@@ -714,9 +718,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = SEEX * 2 - 1; i >= 0; i--) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j < 4 && i >= SEEX * 2 - 4)
-                    ter(i, j) = t_water_sh;
+                    set_ter(i, j, t_water_sh);
                 else
-                    ter(i, j) = t_water_dp;
+                    set_ter(i, j, t_water_dp);
             }
         }
         if (terrain_type == ot_river_c_not_se)
@@ -734,9 +738,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j < 4)
-                    ter(i, j) = t_water_sh;
+                    set_ter(i, j, t_water_sh);
                 else
-                    ter(i, j) = t_water_dp;
+                    set_ter(i, j, t_water_dp);
             }
         }
         if (terrain_type == ot_river_east)
@@ -754,9 +758,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = SEEX * 2 - 1; i >= 0; i--) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i >= SEEX * 2 - 4 || j < 4)
-                    ter(i, j) = t_water_sh;
+                    set_ter(i, j, t_water_sh);
                 else
-                    ter(i, j) = t_water_dp;
+                    set_ter(i, j, t_water_dp);
             }
         }
         if (terrain_type == ot_river_se)
@@ -784,13 +788,13 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i > lw && i < rw && j > tw && j < bw)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
                 if (i >= lw && i <= rw && (j == tw || j == bw))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 if ((i == lw || i == rw) && j > tw && j < bw)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
             }
         }
         switch (rng(1, 3)) {
@@ -799,72 +803,72 @@ void Map::draw_map(oter_id terrain_type,
             cw = tw + rng(4, 7);
             house_room(this, room_living, mw, tw, rw, cw);
             house_room(this, room_kitchen, lw, tw, mw, cw);
-            ter(mw, rng(tw + 2, cw - 2)) = (one_in(3) ? t_door_c : t_floor);
+            set_ter(mw, rng(tw + 2, cw - 2), (one_in(3) ? t_door_c : t_floor));
             rn = rng(lw + 1, cw - 2);
-            ter(rn, tw) = t_window;
-            ter(rn + 1, tw) = t_window;
+            set_ter(rn, tw, t_window);
+            set_ter(rn + 1, tw, t_window);
             rn = rng(cw + 1, rw - 2);
-            ter(rn, tw) = t_window;
-            ter(rn + 1, tw) = t_window;
+            set_ter(rn, tw, t_window);
+            set_ter(rn + 1, tw, t_window);
             mw = rng(lw + 3, rw - 3);
             if (mw <= lw + 5) { // Bedroom on right, bathroom on left
                 rn = rng(cw + 2, rw - 2);
                 if (bw - cw >= 10 && mw - lw >= 6) {
                     house_room(this, room_bathroom, lw, bw - 5, mw, bw);
                     house_room(this, room_bedroom, lw, cw, mw, bw - 5);
-                    ter(mw - 1, cw) = t_door_c;
+                    set_ter(mw - 1, cw, t_door_c);
                 } else {
                     if (bw - cw > 4) { // Too big for a bathroom, not big enough for 2nd bedrm
                         house_room(this, room_bathroom, lw, bw - 4, mw, bw);
                         for (int i = lw + 1; i <= mw - 1; i++)
-                            ter(i, cw) = t_floor;
+                            set_ter(i, cw, t_floor);
                     } else
                         house_room(this, room_bathroom, lw, cw, mw, bw);
                 }
                 house_room(this, room_bedroom, mw, cw, rw, bw);
-                ter(mw, rng(bw - 4, bw - 1)) = t_door_c;
+                set_ter(mw, rng(bw - 4, bw - 1), t_door_c);
             } else { // Bedroom on left, bathroom on right
                 rn = rng(lw + 2, cw - 2);
                 if (bw - cw >= 10 && rw - mw >= 6) {
                     house_room(this, room_bathroom, mw, bw - 5, rw, bw);
                     house_room(this, room_bedroom, mw, cw, rw, bw - 5);
-                    ter(rw - 1, cw) = t_door_c;
+                    set_ter(rw - 1, cw, t_door_c);
                 } else {
                     if (bw - cw > 4) { // Too big for a bathroom, not big enough for 2nd bedrm
                         house_room(this, room_bathroom, mw, bw - 4, rw, bw);
                         for (int i = mw + 1; i <= rw - 1; i++)
-                            ter(i, cw) = t_floor;
+                            set_ter(i, cw, t_floor);
                     } else
                         house_room(this, room_bathroom, mw, cw, rw, bw);
                 }
                 house_room(this, room_bedroom, lw, cw, mw, bw);
-                ter(mw, rng(bw - 4, bw - 1)) = t_door_c;
+                set_ter(mw, rng(bw - 4, bw - 1), t_door_c);
             }
-            ter(rn, bw) = t_window;
-            ter(rn + 1, bw) = t_window;
+            set_ter(rn, bw, t_window);
+            set_ter(rn + 1, bw, t_window);
             if (!one_in(3)) { // Potential side windows
                 rn = rng(tw + 2, bw - 5);
-                ter(rw, rn) = t_window;
-                ter(rw, rn + 4) = t_window;
+                set_ter(rw, rn, t_window);
+                set_ter(rw, rn + 4, t_window);
             }
             if (!one_in(3)) { // Potential side windows
                 rn = rng(tw + 2, bw - 5);
-                ter(lw, rn) = t_window;
-                ter(lw, rn + 4) = t_window;
+                set_ter(lw, rn, t_window);
+                set_ter(lw, rn + 4, t_window);
             }
-            ter(rng(lw + 1, lw + 2), cw) = t_door_c;
+            set_ter(rng(lw + 1, lw + 2), cw, t_door_c);
             if (one_in(4))
-                ter(rw - 2, cw) = t_door_c;
+                set_ter(rw - 2, cw, t_door_c);
             else
-                ter(mw, rng(cw + 1, bw - 1)) = t_door_c;
+                set_ter(mw, rng(cw + 1, bw - 1), t_door_c);
             if (one_in(2)) { // Placement of the main door
-                ter(rng(lw + 2, cw - 1), tw) = (one_in(6) ? t_door_c : t_door_locked);
+                set_ter(rng(lw + 2, cw - 1), tw, (one_in(6) ? t_door_c : t_door_locked));
                 if (one_in(5))
-                    ter(rw, rng(tw + 2, cw - 2)) = (one_in(6) ? t_door_c : t_door_locked);
+                    set_ter(rw, rng(tw + 2, cw - 2), (one_in(6) ? t_door_c : t_door_locked));
             } else {
-                ter(rng(cw + 1, rw - 2), tw) = (one_in(6) ? t_door_c : t_door_locked);
+                set_ter(rng(cw + 1, rw - 2), tw, (one_in(6) ? t_door_c : t_door_locked));
                 if (one_in(5))
-                    ter(lw, rng(tw + 2, cw - 2)) = (one_in(6) ? t_door_c : t_door_locked);
+                    set_ter(lw, rng(tw + 2, cw - 2), (one_in(6) ? t_door_c : t_door_locked));
             }
             break;
 
@@ -878,56 +882,56 @@ void Map::draw_map(oter_id terrain_type,
             house_room(this, room_bathroom, mw, bw - 3, rw, bw);
             // Space between kitchen & living room:
             rn = rng(mw + 1, rw - 3);
-            ter(rn, cw) = t_floor;
-            ter(rn + 1, cw) = t_floor;
+            set_ter(rn, cw, t_floor);
+            set_ter(rn + 1, cw, t_floor);
             // Front windows
             rn = rng(2, 5);
-            ter(lw + rn, tw) = t_window;
-            ter(lw + rn + 1, tw) = t_window;
-            ter(rw - rn, tw) = t_window;
-            ter(rw - rn + 1, tw) = t_window;
+            set_ter(lw + rn, tw, t_window);
+            set_ter(lw + rn + 1, tw, t_window);
+            set_ter(rw - rn, tw, t_window);
+            set_ter(rw - rn + 1, tw, t_window);
             // Front door
-            ter(rng(lw + 4, rw - 4), tw) = (one_in(6) ? t_door_c : t_door_locked);
+            set_ter(rng(lw + 4, rw - 4), tw, (one_in(6) ? t_door_c : t_door_locked));
             if (one_in(3)) { // Kitchen windows
                 rn = rng(cw + 1, bw - 5);
-                ter(rw, rn) = t_window;
-                ter(rw, rn + 1) = t_window;
+                set_ter(rw, rn, t_window);
+                set_ter(rw, rn + 1, t_window);
             }
             if (one_in(3)) { // Bedroom windows
                 rn = rng(cw + 1, bw - 2);
-                ter(lw, rn) = t_window;
-                ter(lw, rn + 1) = t_window;
+                set_ter(lw, rn, t_window);
+                set_ter(lw, rn + 1, t_window);
             }
             // Door to bedroom
             if (one_in(4))
-                ter(rng(lw + 1, mw - 1), cw) = t_door_c;
+                set_ter(rng(lw + 1, mw - 1), cw, t_door_c);
             else
-                ter(mw, rng(cw + 3, bw - 4)) = t_door_c;
+                set_ter(mw, rng(cw + 3, bw - 4), t_door_c);
             // Door to bathrom
             if (one_in(4))
-                ter(mw, bw - 1) = t_door_c;
+                set_ter(mw, bw - 1, t_door_c);
             else
-                ter(rng(mw + 2, rw - 2), bw - 3) = t_door_c;
+                set_ter(rng(mw + 2, rw - 2), bw - 3, t_door_c);
             // Back windows
             rn = rng(lw + 1, mw - 2);
-            ter(rn, bw) = t_window;
-            ter(rn + 1, bw) = t_window;
+            set_ter(rn, bw, t_window);
+            set_ter(rn + 1, bw, t_window);
             rn = rng(mw + 1, rw - 1);
-            ter(rn, bw) = t_window;
+            set_ter(rn, bw, t_window);
             break;
 
         case 3: // Long center hallway
             mw = int((lw + rw) / 2);
             cw = bw - rng(5, 7);
             // Hallway doors and windows
-            ter(mw, tw) = (one_in(6) ? t_door_c : t_door_locked);
+            set_ter(mw, tw, (one_in(6) ? t_door_c : t_door_locked));
             if (one_in(4)) {
-                ter(mw - 1, tw) = t_window;
-                ter(mw + 1, tw) = t_window;
+                set_ter(mw - 1, tw, t_window);
+                set_ter(mw + 1, tw, t_window);
             }
             for (int i = tw + 1; i < cw; i++) { // Hallway walls
-                ter(mw - 2, i) = t_wall_v;
-                ter(mw + 2, i) = t_wall_v;
+                set_ter(mw - 2, i, t_wall_v);
+                set_ter(mw + 2, i, t_wall_v);
             }
             if (one_in(2)) { // Front rooms are kitchen or living room
                 house_room(this, room_living, lw, tw, mw - 2, cw);
@@ -938,77 +942,77 @@ void Map::draw_map(oter_id terrain_type,
             }
             // Front windows
             rn = rng(lw + 1, mw - 4);
-            ter(rn, tw) = t_window;
-            ter(rn + 1, tw) = t_window;
+            set_ter(rn, tw, t_window);
+            set_ter(rn + 1, tw, t_window);
             rn = rng(mw + 3, rw - 2);
-            ter(rn, tw) = t_window;
-            ter(rn + 1, tw) = t_window;
+            set_ter(rn, tw, t_window);
+            set_ter(rn + 1, tw, t_window);
             if (one_in(4)) { // Side windows?
                 rn = rng(tw + 1, cw - 2);
-                ter(lw, rn) = t_window;
-                ter(lw, rn + 1) = t_window;
+                set_ter(lw, rn, t_window);
+                set_ter(lw, rn + 1, t_window);
             }
             if (one_in(4)) { // Side windows?
                 rn = rng(tw + 1, cw - 2);
-                ter(rw, rn) = t_window;
-                ter(rw, rn + 1) = t_window;
+                set_ter(rw, rn, t_window);
+                set_ter(rw, rn + 1, t_window);
             }
             if (one_in(2)) { // Bottom rooms are bedroom or bathroom
                 house_room(this, room_bedroom, lw, cw, rw - 3, bw);
                 house_room(this, room_bathroom, rw - 3, cw, rw, bw);
-                ter(rng(lw + 2, mw - 3), cw) = t_door_c;
+                set_ter(rng(lw + 2, mw - 3), cw, t_door_c);
                 if (one_in(4))
-                    ter(rng(rw - 2, rw - 1), cw) = t_door_c;
+                    set_ter(rng(rw - 2, rw - 1), cw, t_door_c);
                 else
-                    ter(rw - 3, rng(cw + 2, bw - 2)) = t_door_c;
+                    set_ter(rw - 3, rng(cw + 2, bw - 2), t_door_c);
                 rn = rng(lw + 1, rw - 5);
-                ter(rn, bw) = t_window;
-                ter(rn + 1, bw) = t_window;
+                set_ter(rn, bw, t_window);
+                set_ter(rn + 1, bw, t_window);
                 if (one_in(4))
-                    ter(rng(rw - 2, rw - 1), bw) = t_window;
+                    set_ter(rng(rw - 2, rw - 1), bw, t_window);
                 else
                     ter(rw, rng(cw + 1, bw - 1));
             } else {
                 house_room(this, room_bathroom, lw, cw, lw + 3, bw);
                 house_room(this, room_bedroom, lw + 3, cw, rw, bw);
                 if (one_in(4))
-                    ter(rng(lw + 1, lw + 2), bw - 2) = t_door_c;
+                    set_ter(rng(lw + 1, lw + 2), bw - 2, t_door_c);
                 else
-                    ter(lw + 3, rng(cw + 2, bw - 2)) = t_door_c;
+                    set_ter(lw + 3, rng(cw + 2, bw - 2), t_door_c);
                 rn = rng(lw + 4, rw - 2);
-                ter(rn, bw) = t_window;
-                ter(rn + 1, bw) = t_window;
+                set_ter(rn, bw, t_window);
+                set_ter(rn + 1, bw, t_window);
                 if (one_in(4))
-                    ter(rng(lw + 1, lw + 2), bw) = t_window;
+                    set_ter(rng(lw + 1, lw + 2), bw, t_window);
                 else
                     ter(lw, rng(cw + 1, bw - 1));
             }
             // Doors off the sides of the hallway
-            ter(mw - 2, rng(tw + 3, cw - 3)) = t_door_c;
-            ter(mw + 2, rng(tw + 3, cw - 3)) = t_door_c;
-            ter(mw, cw) = t_door_c;
+            set_ter(mw - 2, rng(tw + 3, cw - 3), t_door_c);
+            set_ter(mw + 2, rng(tw + 3, cw - 3), t_door_c);
+            set_ter(mw, cw, t_door_c);
             break;
         }
         if (rng(2, 7) < tw) { // Big front yard has a chance for a fence
             for (int i = lw; i <= rw; i++)
-                ter(i, 0) = t_fence_h;
+                set_ter(i, 0, t_fence_h);
             for (int i = 1; i < tw; i++) {
-                ter(lw, i) = t_fence_v;
-                ter(rw, i) = t_fence_v;
+                set_ter(lw, i, t_fence_v);
+                set_ter(rw, i, t_fence_v);
             }
             int hole = rng(SEEX - 3, SEEX + 2);
-            ter(hole, 0) = t_dirt;
-            ter(hole + 1, 0) = t_dirt;
+            set_ter(hole, 0, t_dirt);
+            set_ter(hole + 1, 0, t_dirt);
             if (one_in(tw)) {
-                ter(hole - 1, 1) = t_tree_young;
-                ter(hole + 2, 1) = t_tree_young;
+                set_ter(hole - 1, 1, t_tree_young);
+                set_ter(hole + 2, 1, t_tree_young);
             }
         }
         if (terrain_type >= ot_house_base_north && terrain_type <= ot_house_base_west) {
             do
                 rn = rng(lw + 1, rw - 1);
             while (ter(rn, bw - 1) != t_floor);
-            ter(rn, bw - 1) = t_stairs_down;
+            set_ter(rn, bw - 1, t_stairs_down);
         }
         if (terrain_type == ot_house_east || terrain_type == ot_house_base_east)
             rotate(1);
@@ -1023,12 +1027,12 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEX * 2; j++) {
                 if ((j == 5 || j == 9 || j == 13 || j == 17 || j == 21)
                     && ((i > 1 && i < 8) || (i > 14 && i < SEEX * 2 - 2)))
-                    ter(i, j) = t_pavement_y;
+                    set_ter(i, j, t_pavement_y);
                 else if ((j < 2 && i > 7 && i < 17)
                          || (j >= 2 && j < SEEY * 2 - 2 && i > 1 && i < SEEX * 2 - 2))
-                    ter(i, j) = t_pavement;
+                    set_ter(i, j, t_pavement);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         place_items(mi_road, 8, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, false, turn);
@@ -1047,34 +1051,34 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEX * 2; j++) {
                 if ((j == 4 || j == 8) && (i == 6 || i == 10 || i == 14 || i == 18))
-                    ter(i, j) = t_gas_pump;
+                    set_ter(i, j, t_gas_pump);
                 else if ((j < 2 && i > 7 && i < 16) || (j < 12 && i > 1 && i < SEEX * 2 - 2))
-                    ter(i, j) = t_pavement;
+                    set_ter(i, j, t_pavement);
                 else if (j == 12 && (i == 7 || i == 8 || i == 15 || i == 16))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if (((j == 12 || j == SEEY * 2 - 3) && i > 3 && i < SEEX * 2 - 4)
                          || (j == 18 && (i > 8 && i < SEEX * 2 - 5)))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 4 || i == SEEX * 2 - 5) && j > 12 && j < SEEY * 2 - 3)
                          || (i == 15 && (j == 19 || j == SEEY * 2 - 4))
                          || (i == 9 && j == SEEY * 2 - 4))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((i == 17 && j == 18) || (i == 9 && j == 19))
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (i == 5 && j > 13 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_fridge;
+                    set_ter(i, j, t_fridge);
                 else if ((i == 7 || i == 9 || i == 11) && j > 13 && j < 17)
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((i == 14 && j > 12 && j < 16) || (j == 15 && i > 13 && i < 18))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (i > 4 && i < SEEX * 2 - 5 && j > 12 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(rng(10, 13), 12) = t_door_c;
-        ter(rng(16, 17), 18) = t_door_c;
+        set_ter(rng(10, 13), 12, t_door_c);
+        set_ter(rng(16, 17), 18, t_door_c);
         if (one_in(2))
             place_items(mi_snacks, 74, 7, 14, 7, 16, false, 0);
         else
@@ -1106,27 +1110,27 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 3 && ((i > 5 && i < 9) || (i > 14 && i < 18)))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if ((j == 3 && (i == 11 || i == 12)) || (i == 13 && j == 18))
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (((j == 3 || j == SEEY * 2 - 4) && i > 2 && i < SEEX * 2 - 3)
                          || (j == 17 && i > 12 && i < SEEX * 2 - 4))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 3 || i == SEEX * 2 - 4) && j > 3 && j < SEEY * 2 - 4)
                          || (i == 13 && j == 19))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (((i == 11 || i == 12 || i == 16 || i == 17) && j > 6 && j < 14)
                          || (j == 19 && i > 4 && i < 12))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((i == 4 && j > 11 && j < 15) || (j == 16 && i > 14 && i < SEEX * 2 - 4))
-                    ter(i, j) = t_fridge;
+                    set_ter(i, j, t_fridge);
                 else if ((j == 17 && i > 4 && i < 13) || (j == 9 && i > 4 && i < 9)
                          || (i == 8 && j > 3 && j < 10))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (i > 3 && i < SEEX * 2 - 4 && j > 3 && j < SEEY * 2 - 4)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         if (one_in(3))
@@ -1167,39 +1171,39 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 2 && ((i > 4 && i < 8) || (i > 15 && i < 19)))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if ((j == 2 && (i == 11 || i == 12)) || (i == 6 && j == 20))
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (((j == 2 || j == SEEY * 2 - 3) && i > 1 && i < SEEX * 2 - 2)
                          || (j == 18 && i > 2 && i < 7))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 2 || i == SEEX * 2 - 3) && j > 2 && j < SEEY * 2 - 3)
                          || (i == 6 && j == 19))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (j > 4 && j < 8) {
                     if (i == 5 || i == 9 || i == 13 || i == 17)
-                        ter(i, j) = t_counter;
+                        set_ter(i, j, t_counter);
                     else if (i == 8 || i == 12 || i == 16 || i == 20)
-                        ter(i, j) = t_rack;
+                        set_ter(i, j, t_rack);
                     else if (i > 2 && i < SEEX * 2 - 3)
-                        ter(i, j) = t_floor;
+                        set_ter(i, j, t_floor);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else if ((j == 7 && (i == 3 || i == 4))
                            || ((j == 11 || j == 14) && (i == 18 || i == 19))
                            || ((j > 9 && j < 16)
                                && (i == 6 || i == 7 || i == 10 || i == 11 || i == 14 || i == 15
                                    || i == 20)))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((j == 18 && i > 15 && i < 21) || (j == 19 && i == 16))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((i == 3 && j > 9 && j < 16)
                          || (j == 20 && ((i > 7 && i < 15) || (i > 18 && i < 21))))
-                    ter(i, j) = t_fridge;
+                    set_ter(i, j, t_fridge);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 2 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         place_items(mi_fridgesnacks, 60, 3, 10, 3, 15, false, 0);
@@ -1238,37 +1242,37 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 3 && ((i > 5 && i < 9) || (i > 14 && i < 18)))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if ((j == 3 && i > 1 && i < SEEX * 2 - 2) || (j == 15 && i > 1 && i < 14)
                          || (j == SEEY * 2 - 3 && i > 12 && i < SEEX * 2 - 2))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if ((i == 2 && j > 3 && j < 15)
                          || (i == SEEX * 2 - 3 && j > 3 && j < SEEY * 2 - 3)
                          || (i == 13 && j > 15 && j < SEEY * 2 - 3))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((i > 3 && i < 10 && j == 6) || (i == 9 && j > 3 && j < 7))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (((i == 3 || i == 6 || i == 7 || i == 10 || i == 11) && j > 8 && j < 15)
                          || (i == SEEX * 2 - 4 && j > 3 && j < SEEX * 2 - 4)
                          || (i > 14 && i < 18 && (j == 8 || j == 9 || j == 12 || j == 13))
                          || (j == SEEY * 2 - 4 && i > 13 && i < SEEX * 2 - 4)
                          || (i > 15 && i < 18 && j > 15 && j < 18) || (i == 9 && j == 7))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((i > 2 && i < SEEX * 2 - 3 && j > 3 && j < 15)
                          || (i > 13 && i < SEEX * 2 - 3 && j > 14 && j < SEEY * 2 - 3))
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else if (rn == 2 && i > 1 && i < 13 && j > 15 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_pavement;
+                    set_ter(i, j, t_pavement);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(rng(10, 13), 3) = t_door_c;
+        set_ter(rng(10, 13), 3, t_door_c);
         if (rn > 0)
-            ter(13, rng(16, 19)) = (one_in(3) ? t_door_c : t_door_locked);
+            set_ter(13, rng(16, 19), (one_in(3) ? t_door_c : t_door_locked));
         if (rn == 2) {
             if (one_in(5))
-                ter(rng(4, 10), 16) = t_gas_pump;
+                set_ter(rng(4, 10), 16, t_gas_pump);
             if (one_in(3)) { // Place a dumpster
                 int startx = rng(2, 11), starty = rng(18, 19);
                 if (startx == 11)
@@ -1276,7 +1280,7 @@ void Map::draw_map(oter_id terrain_type,
                 bool hori = (starty == 18 ? false : true);
                 for (int i = startx; i <= startx + (hori ? 3 : 2); i++) {
                     for (int j = starty; j <= starty + (hori ? 2 : 3); j++)
-                        ter(i, j) = t_dumpster;
+                        set_ter(i, j, t_dumpster);
                 }
                 if (hori)
                     place_items(mi_trash, 30, startx, starty, startx + 3, starty + 2, false, 0);
@@ -1356,48 +1360,48 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (((j == tw || j == bw) && i >= lw && i <= rw) || (j == cw && i > lw && i < rw))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if ((i == lw || i == rw) && j > tw && j < bw)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((j == cw - 1 && i > lw && i < rw - 4)
                          || (j < cw - 3 && j > tw && (i == lw + 1 || i == rw - 1)))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (j == cw - 3 && i > lw && i < rw - 4)
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (j > tw && j < bw && i > lw && i < rw)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else if (tw >= 6 && j >= tw - 6 && j < tw && i >= lw && i <= rw) {
                     if ((i - lw) % 4 == 0)
-                        ter(i, j) = t_pavement_y;
+                        set_ter(i, j, t_pavement_y);
                     else
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                 } else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         rn = rng(tw + 2, cw - 6);
         for (int i = lw + 3; i <= rw - 5; i += 4) {
             if (cw - 6 > tw + 1) {
-                ter(i, rn + 1) = t_rack;
-                ter(i, rn) = t_rack;
-                ter(i + 1, rn + 1) = t_rack;
-                ter(i + 1, rn) = t_rack;
+                set_ter(i, rn + 1, t_rack);
+                set_ter(i, rn, t_rack);
+                set_ter(i + 1, rn + 1, t_rack);
+                set_ter(i + 1, rn, t_rack);
                 place_items(mi_camping, 86, i, rn, i + 1, rn + 1, false, 0);
             } else if (cw - 5 > tw + 1) {
-                ter(i, cw - 5) = t_rack;
-                ter(i + 1, cw - 5) = t_rack;
+                set_ter(i, cw - 5, t_rack);
+                set_ter(i + 1, cw - 5, t_rack);
                 place_items(mi_camping, 80, i, cw - 5, i + 1, cw - 5, false, 0);
             }
         }
-        ter(rw - rng(2, 3), cw) = t_door_c;
+        set_ter(rw - rng(2, 3), cw, t_door_c);
         rn = rng(2, 4);
         for (int i = lw + 2; i <= lw + 2 + rn; i++)
-            ter(i, tw) = t_window;
+            set_ter(i, tw, t_window);
         for (int i = rw - 2; i >= rw - 2 - rn; i--)
-            ter(i, tw) = t_window;
-        ter(rng(lw + 3 + rn, rw - 3 - rn), tw) = t_door_c;
+            set_ter(i, tw, t_window);
+        set_ter(rng(lw + 3 + rn, rw - 3 - rn), tw, t_door_c);
         if (one_in(4))
-            ter(rng(lw + 2, rw - 2), bw) = t_door_locked;
+            set_ter(rng(lw + 2, rw - 2), bw, t_door_locked);
         place_items(mi_allsporting, 90, lw + 1, cw - 1, rw - 5, cw - 1, false, 0);
         place_items(mi_sports, 82, lw + 1, tw + 1, lw + 1, cw - 4, false, 0);
         place_items(mi_sports, 82, rw - 1, tw + 1, rw - 1, cw - 4, false, 0);
@@ -1419,38 +1423,38 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 2 && (i == 5 || i == 18))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if (((j == 2 || j == 12) && i > 2 && i < SEEX * 2 - 3)
                          || (j == 9 && i > 3 && i < 8))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 3 || i == SEEX * 2 - 4) && j > 2 && j < 12)
                          || (i == 7 && j > 9 && j < 12))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((i == 19 && j > 6 && j < 12) || (j == 11 && i > 16 && i < 19))
-                    ter(i, j) = t_fridge;
+                    set_ter(i, j, t_fridge);
                 else if (((i == 4 || i == 7 || i == 8) && j > 2 && j < 8)
                          || (j == 3 && i > 8 && i < 12) || (i > 10 && i < 13 && j > 4 && j < 7)
                          || (i > 10 && i < 16 && j > 7 && j < 10))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((i == 16 && j > 2 && j < 6) || (j == 5 && i > 16 && i < 19))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((i > 4 && i < 8 && j > 12 && j < 15)
                          || (i > 17 && i < 20 && j > 14 && j < 18))
-                    ter(i, j) = t_dumpster;
+                    set_ter(i, j, t_dumpster);
                 else if (i > 2 && i < SEEX * 2 - 3) {
                     if (j > 2 && j < 12)
-                        ter(i, j) = t_floor;
+                        set_ter(i, j, t_floor);
                     else if (j > 12 && j < SEEY * 2 - 1)
-                        ter(i, j) = t_pavement;
+                        set_ter(i, j, t_pavement);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(rng(13, 15), 2) = t_door_c;
-        ter(rng(4, 6), 9) = t_door_c;
-        ter(rng(9, 16), 12) = t_door_c;
+        set_ter(rng(13, 15), 2, t_door_c);
+        set_ter(rng(4, 6), 9, t_door_c);
+        set_ter(rng(9, 16), 12, t_door_c);
 
         place_items(mi_alcohol, 96, 4, 3, 4, 7, false, 0);
         place_items(mi_alcohol, 96, 7, 3, 11, 3, false, 0);
@@ -1478,36 +1482,36 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i == 2 || i == SEEX * 2 - 3) && j > 6 && j < SEEY * 2 - 1)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((i == 8 && j > 6 && j < 13)
                          || (j == 16 && (i == 5 || i == 8 || i == 11 || i == 14 || i == 17)))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((j == 6 && ((i > 4 && i < 8) || (i > 15 && i < 19))))
-                    ter(i, j) = t_window;
+                    set_ter(i, j, t_window);
                 else if ((j == 14 && i > 3 && i < 15))
-                    ter(i, j) = t_wall_glass_h;
+                    set_ter(i, j, t_wall_glass_h);
                 else if (j == 16 && i == SEEX * 2 - 4)
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (((j == 6 || j == SEEY * 2 - 1) && i > 1 && i < SEEX * 2 - 2)
                          || ((j == 16 || j == 14) && i > 2 && i < SEEX * 2 - 3))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 3 || i == SEEX * 2 - 4) && j > 6 && j < 14)
                          || ((j > 8 && j < 12) && (i == 12 || i == 13 || i == 16))
                          || (j == 13 && i > 15 && i < SEEX * 2 - 4))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 6 && j < SEEY * 2 - 1)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else if ((j > 0 && j < 6
                           && (i == 2 || i == 6 || i == 10 || i == 17 || i == SEEX * 2 - 3)))
-                    ter(i, j) = t_pavement_y;
+                    set_ter(i, j, t_pavement_y);
                 else if (j < 6 && i > 1 && i < SEEX * 2 - 2)
-                    ter(i, j) = t_pavement;
+                    set_ter(i, j, t_pavement);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(rng(11, 14), 6) = t_door_c;
-        ter(rng(5, 14), 14) = t_door_c;
+        set_ter(rng(11, 14), 6, t_door_c);
+        set_ter(rng(5, 14), 14, t_door_c);
         place_items(mi_pistols, 70, 12, 9, 13, 11, false, 0);
         place_items(mi_shotguns, 60, 16, 9, 16, 11, false, 0);
         place_items(mi_rifles, 80, 20, 7, 20, 12, false, 0);
@@ -1531,38 +1535,38 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 2 && (i == 11 || i == 12))
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (j == 2 && i > 3 && i < SEEX * 2 - 4)
-                    ter(i, j) = t_wall_glass_h;
+                    set_ter(i, j, t_wall_glass_h);
                 else if (((j == 2 || j == SEEY * 2 - 2) && i > 1 && i < SEEX * 2 - 2)
                          || (j == 4 && i > 12 && i < SEEX * 2 - 3) || (j == 17 && i > 2 && i < 12)
                          || (j == 20 && i > 2 && i < 11))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 2 || i == SEEX * 2 - 3) && j > 1 && j < SEEY * 2 - 1)
                          || (i == 11 && (j == 18 || j == 20 || j == 21))
                          || (j == 21 && (i == 5 || i == 8)))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((i == 16 && j > 4 && j < 9) || (j == 8 && (i == 17 || i == 18))
                          || (j == 18 && i > 2 && i < 11))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((i == 3 && j > 4 && j < 13) || (i == SEEX * 2 - 4 && j > 9 && j < 20)
                          || ((j == 10 || j == 11) && i > 6 && i < 13)
                          || ((j == 14 || j == 15) && i > 4 && i < 13)
                          || ((i == 15 || i == 16) && j > 10 && j < 18)
                          || (j == SEEY * 2 - 3 && i > 11 && i < 18))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 2 && j < SEEY * 2 - 2)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
 
         for (int i = 3; i <= 9; i += 3) {
             if (one_in(2))
-                ter(i, SEEY * 2 - 4) = t_door_c;
+                set_ter(i, SEEY * 2 - 4, t_door_c);
             else
-                ter(i + 1, SEEY * 2 - 4) = t_door_c;
+                set_ter(i + 1, SEEY * 2 - 4, t_door_c);
         }
 
         place_items(mi_shoes, 70, 7, 10, 12, 10, false, 0);
@@ -1613,44 +1617,44 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 2) {
                     if (i == 5 || i == 6 || i == 17 || i == 18)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (i == 11 || i == 12)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else if (i > 1 && i < SEEX * 2 - 2)
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else if (j == 17 && i > 1 && i < SEEX * 2 - 2)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (i == 2) {
                     if (j == 6 || j == 7 || j == 10 || j == 11 || j == 14 || j == 15)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (j > 1 && j < 17)
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else if (i == SEEX * 2 - 3) {
                     if (j == 6 || j == 7)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (j > 1 && j < 17)
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                     else
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                 } else if (((j == 4 || j == 5) && i > 2 && i < 10)
                            || ((j == 8 || j == 9 || j == 12 || j == 13 || j == 16) && i > 2
                                && i < 16)
                            || (i == 20 && j > 7 && j < 17))
-                    ter(i, j) = t_bookcase;
+                    set_ter(i, j, t_bookcase);
                 else if ((i == 14 && j < 6 && j > 2) || (j == 5 && i > 14 && i < 19))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 2 && j < 17)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         if (!one_in(3))
-            ter(18, 17) = t_door_c;
+            set_ter(18, 17, t_door_c);
         place_items(mi_magazines, 70, 3, 4, 9, 4, false, 0);
         place_items(mi_magazines, 70, 20, 8, 20, 16, false, 0);
         place_items(mi_novels, 96, 3, 5, 9, 5, false, 0);
@@ -1686,24 +1690,24 @@ void Map::draw_map(oter_id terrain_type,
                 for (int j = 0; j < SEEY * 2; j++) {
                     if (i <= 1 || i >= SEEX * 2 - 2
                         || (j > 1 && j < SEEY * 2 - 2 && (i == SEEX - 2 || i == SEEX + 1)))
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                     else if (j <= 1 || j >= SEEY * 2 - 2)
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                     else
-                        ter(i, j) = t_floor;
+                        set_ter(i, j, t_floor);
                 }
             }
-            ter(SEEX - 1, 0) = t_dirt;
-            ter(SEEX - 1, 1) = t_door_metal_locked;
-            ter(SEEX, 0) = t_dirt;
-            ter(SEEX, 1) = t_door_metal_locked;
-            ter(SEEX - 2 + rng(0, 1) * 4, 0) = t_card_reader;
-            ter(SEEX - 2, SEEY) = t_door_metal_c;
-            ter(SEEX + 1, SEEY) = t_door_metal_c;
-            ter(SEEX - 2, SEEY - 1) = t_door_metal_c;
-            ter(SEEX + 1, SEEY - 1) = t_door_metal_c;
-            ter(SEEX - 1, SEEY * 2 - 3) = t_stairs_down;
-            ter(SEEX, SEEY * 2 - 3) = t_stairs_down;
+            set_ter(SEEX - 1, 0, t_dirt);
+            set_ter(SEEX - 1, 1, t_door_metal_locked);
+            set_ter(SEEX, 0, t_dirt);
+            set_ter(SEEX, 1, t_door_metal_locked);
+            set_ter(SEEX - 2 + rng(0, 1) * 4, 0, t_card_reader);
+            set_ter(SEEX - 2, SEEY, t_door_metal_c);
+            set_ter(SEEX + 1, SEEY, t_door_metal_c);
+            set_ter(SEEX - 2, SEEY - 1, t_door_metal_c);
+            set_ter(SEEX + 1, SEEY - 1, t_door_metal_c);
+            set_ter(SEEX - 1, SEEY * 2 - 3, t_stairs_down);
+            set_ter(SEEX, SEEY * 2 - 3, t_stairs_down);
             science_room(this, 2, 2, SEEX - 3, SEEY * 2 - 3, 1);
             science_room(this, SEEX + 2, 2, SEEX * 2 - 3, SEEY * 2 - 3, 3);
 
@@ -1718,26 +1722,26 @@ void Map::draw_map(oter_id terrain_type,
         } else if (tw != 0 || rw != 0 || lw != 0 || bw != 0) { // Sewers!
             for (int i = 0; i < SEEX * 2; i++) {
                 for (int j = 0; j < SEEY * 2; j++) {
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                     if (((i < lw || i > SEEX * 2 - 1 - rw) && j > SEEY - 3 && j < SEEY + 2)
                         || ((j < tw || j > SEEY * 2 - 1 - bw) && i > SEEX - 3 && i < SEEX + 2))
-                        ter(i, j) = t_sewage;
+                        set_ter(i, j, t_sewage);
                     if ((i == 0 && t_east >= ot_lab && t_east <= ot_lab_core)
                         || i == SEEX * 2 - 1) {
                         if (ter(i, j) == t_sewage)
-                            ter(i, j) = t_bars;
+                            set_ter(i, j, t_bars);
                         else if (j == SEEY - 1 || j == SEEY)
-                            ter(i, j) = t_door_metal_c;
+                            set_ter(i, j, t_door_metal_c);
                         else
-                            ter(i, j) = t_wall_v;
+                            set_ter(i, j, t_wall_v);
                     } else if ((j == 0 && t_north >= ot_lab && t_north <= ot_lab_core)
                                || j == SEEY * 2 - 1) {
                         if (ter(i, j) == t_sewage)
-                            ter(i, j) = t_bars;
+                            set_ter(i, j, t_bars);
                         else if (i == SEEX - 1 || i == SEEX)
-                            ter(i, j) = t_door_metal_c;
+                            set_ter(i, j, t_door_metal_c);
                         else
-                            ter(i, j) = t_wall_h;
+                            set_ter(i, j, t_wall_h);
                     }
                 }
             }
@@ -1753,56 +1757,56 @@ void Map::draw_map(oter_id terrain_type,
                     for (int j = 0; j < SEEY * 2; j++) {
                         if ((i < lw || i > SEEX * 2 - 1 - rw)
                             || ((j < SEEY - 1 || j > SEEY) && (i == SEEX - 2 || i == SEEX + 1)))
-                            ter(i, j) = t_wall_v;
+                            set_ter(i, j, t_wall_v);
                         else if ((j < tw || j > SEEY * 2 - 1 - bw)
                                  || ((i < SEEX - 1 || i > SEEX)
                                      && (j == SEEY - 2 || j == SEEY + 1)))
-                            ter(i, j) = t_wall_h;
+                            set_ter(i, j, t_wall_h);
                         else
-                            ter(i, j) = t_floor;
+                            set_ter(i, j, t_floor);
                     }
                 }
                 if (t_above == ot_lab_stairs)
-                    ter(rng(SEEX - 1, SEEX), rng(SEEY - 1, SEEY)) = t_stairs_up;
+                    set_ter(rng(SEEX - 1, SEEX), rng(SEEY - 1, SEEY), t_stairs_up);
                 // Top left
                 if (one_in(2)) {
-                    ter(SEEX - 2, int(SEEY / 2)) = t_door_metal_c;
+                    set_ter(SEEX - 2, int(SEEY / 2), t_door_metal_c);
                     science_room(this, lw, tw, SEEX - 3, SEEY - 3, 1);
                 } else {
-                    ter(int(SEEX / 2), SEEY - 2) = t_door_metal_c;
+                    set_ter(int(SEEX / 2), SEEY - 2, t_door_metal_c);
                     science_room(this, lw, tw, SEEX - 3, SEEY - 3, 2);
                 }
                 // Top right
                 if (one_in(2)) {
-                    ter(SEEX + 1, int(SEEY / 2)) = t_door_metal_c;
+                    set_ter(SEEX + 1, int(SEEY / 2), t_door_metal_c);
                     science_room(this, SEEX + 2, tw, SEEX * 2 - 1 - rw, SEEY - 3, 3);
                 } else {
-                    ter(SEEX + int(SEEX / 2), SEEY - 2) = t_door_metal_c;
+                    set_ter(SEEX + int(SEEX / 2), SEEY - 2, t_door_metal_c);
                     science_room(this, SEEX + 2, tw, SEEX * 2 - 1 - rw, SEEY - 3, 2);
                 }
                 // Bottom left
                 if (one_in(2)) {
-                    ter(int(SEEX / 2), SEEY + 1) = t_door_metal_c;
+                    set_ter(int(SEEX / 2), SEEY + 1, t_door_metal_c);
                     science_room(this, lw, SEEY + 2, SEEX - 3, SEEY * 2 - 1 - bw, 0);
                 } else {
-                    ter(SEEX - 2, SEEY + int(SEEY / 2)) = t_door_metal_c;
+                    set_ter(SEEX - 2, SEEY + int(SEEY / 2), t_door_metal_c);
                     science_room(this, lw, SEEY + 2, SEEX - 3, SEEY * 2 - 1 - bw, 1);
                 }
                 // Bottom right
                 if (one_in(2)) {
-                    ter(SEEX + int(SEEX / 2), SEEY + 1) = t_door_metal_c;
+                    set_ter(SEEX + int(SEEX / 2), SEEY + 1, t_door_metal_c);
                     science_room(this, SEEX + 2, SEEY + 2, SEEX * 2 - 1 - rw, SEEY * 2 - 1 - bw, 0);
                 } else {
-                    ter(SEEX + 1, SEEY + int(SEEY / 2)) = t_door_metal_c;
+                    set_ter(SEEX + 1, SEEY + int(SEEY / 2), t_door_metal_c);
                     science_room(this, SEEX + 2, SEEY + 2, SEEX * 2 - 1 - rw, SEEY * 2 - 1 - bw, 3);
                 }
                 if (rw == 1) {
-                    ter(SEEX * 2 - 1, SEEY - 1) = t_door_metal_c;
-                    ter(SEEX * 2 - 1, SEEY) = t_door_metal_c;
+                    set_ter(SEEX * 2 - 1, SEEY - 1, t_door_metal_c);
+                    set_ter(SEEX * 2 - 1, SEEY, t_door_metal_c);
                 }
                 if (bw == 1) {
-                    ter(SEEX - 1, SEEY * 2 - 1) = t_door_metal_c;
-                    ter(SEEX, SEEY * 2 - 1) = t_door_metal_c;
+                    set_ter(SEEX - 1, SEEY * 2 - 1, t_door_metal_c);
+                    set_ter(SEEX, SEEY * 2 - 1, t_door_metal_c);
                 }
                 if (terrain_type == ot_lab_stairs) { // Stairs going down
                     std::vector<Point> stair_points;
@@ -1839,7 +1843,7 @@ void Map::draw_map(oter_id terrain_type,
                     stair_points.push_back(Point(SEEX, int(SEEY / 2) + SEEY));
                     stair_points.push_back(Point(SEEX + 2, int(SEEY / 2) + SEEY));
                     rn = rng(0, stair_points.size() - 1);
-                    ter(stair_points[rn].x, stair_points[rn].y) = t_stairs_down;
+                    set_ter(stair_points[rn].x, stair_points[rn].y, t_stairs_down);
                 }
 
                 break;
@@ -1848,31 +1852,31 @@ void Map::draw_map(oter_id terrain_type,
                 for (int i = 0; i < SEEX * 2; i++) {
                     for (int j = 0; j < SEEY * 2; j++) {
                         if (i < lw || i > SEEX * 2 - 1 - rw || i == SEEX - 4 || i == SEEX + 3)
-                            ter(i, j) = t_wall_v;
+                            set_ter(i, j, t_wall_v);
                         else if (j < lw || j > SEEY * 2 - 1 - bw || j == SEEY - 4 || j == SEEY + 3)
-                            ter(i, j) = t_wall_h;
+                            set_ter(i, j, t_wall_h);
                         else
-                            ter(i, j) = t_floor;
+                            set_ter(i, j, t_floor);
                     }
                 }
                 if (t_above == ot_lab_stairs) {
-                    ter(SEEX - 1, SEEY - 1) = t_stairs_up;
-                    ter(SEEX, SEEY - 1) = t_stairs_up;
-                    ter(SEEX - 1, SEEY) = t_stairs_up;
-                    ter(SEEX, SEEY) = t_stairs_up;
+                    set_ter(SEEX - 1, SEEY - 1, t_stairs_up);
+                    set_ter(SEEX, SEEY - 1, t_stairs_up);
+                    set_ter(SEEX - 1, SEEY, t_stairs_up);
+                    set_ter(SEEX, SEEY, t_stairs_up);
                 }
-                ter(SEEX - rng(0, 1), SEEY - 4) = t_door_metal_c;
-                ter(SEEX - rng(0, 1), SEEY + 3) = t_door_metal_c;
-                ter(SEEX - 4, SEEY + rng(0, 1)) = t_door_metal_c;
-                ter(SEEX + 3, SEEY + rng(0, 1)) = t_door_metal_c;
-                ter(SEEX - 4, int(SEEY / 2)) = t_door_metal_c;
-                ter(SEEX + 3, int(SEEY / 2)) = t_door_metal_c;
-                ter(int(SEEX / 2), SEEY - 4) = t_door_metal_c;
-                ter(int(SEEX / 2), SEEY + 3) = t_door_metal_c;
-                ter(SEEX + int(SEEX / 2), SEEY - 4) = t_door_metal_c;
-                ter(SEEX + int(SEEX / 2), SEEY + 3) = t_door_metal_c;
-                ter(SEEX - 4, SEEY + int(SEEY / 2)) = t_door_metal_c;
-                ter(SEEX + 3, SEEY + int(SEEY / 2)) = t_door_metal_c;
+                set_ter(SEEX - rng(0, 1), SEEY - 4, t_door_metal_c);
+                set_ter(SEEX - rng(0, 1), SEEY + 3, t_door_metal_c);
+                set_ter(SEEX - 4, SEEY + rng(0, 1), t_door_metal_c);
+                set_ter(SEEX + 3, SEEY + rng(0, 1), t_door_metal_c);
+                set_ter(SEEX - 4, int(SEEY / 2), t_door_metal_c);
+                set_ter(SEEX + 3, int(SEEY / 2), t_door_metal_c);
+                set_ter(int(SEEX / 2), SEEY - 4, t_door_metal_c);
+                set_ter(int(SEEX / 2), SEEY + 3, t_door_metal_c);
+                set_ter(SEEX + int(SEEX / 2), SEEY - 4, t_door_metal_c);
+                set_ter(SEEX + int(SEEX / 2), SEEY + 3, t_door_metal_c);
+                set_ter(SEEX - 4, SEEY + int(SEEY / 2), t_door_metal_c);
+                set_ter(SEEX + 3, SEEY + int(SEEY / 2), t_door_metal_c);
                 science_room(this, lw, tw, SEEX - 5, SEEY - 5, rng(1, 2));
                 science_room(this, SEEX - 3, tw, SEEX + 2, SEEY - 5, 2);
                 science_room(this, SEEX + 4, tw, SEEX * 2 - 1 - rw, SEEY - 5, rng(2, 3));
@@ -1883,26 +1887,26 @@ void Map::draw_map(oter_id terrain_type,
                 science_room(this, SEEX + 4, SEEX + 4, SEEX * 2 - 1 - rw, SEEY * 2 - 1 - bw,
                              3 * rng(0, 1));
                 if (rw == 1) {
-                    ter(SEEX * 2 - 1, SEEY - 1) = t_door_metal_c;
-                    ter(SEEX * 2 - 1, SEEY) = t_door_metal_c;
+                    set_ter(SEEX * 2 - 1, SEEY - 1, t_door_metal_c);
+                    set_ter(SEEX * 2 - 1, SEEY, t_door_metal_c);
                 }
                 if (bw == 1) {
-                    ter(SEEX - 1, SEEY * 2 - 1) = t_door_metal_c;
-                    ter(SEEX, SEEY * 2 - 1) = t_door_metal_c;
+                    set_ter(SEEX - 1, SEEY * 2 - 1, t_door_metal_c);
+                    set_ter(SEEX, SEEY * 2 - 1, t_door_metal_c);
                 }
                 if (terrain_type == ot_lab_stairs)
-                    ter(SEEX - 3 + 5 * rng(0, 1), SEEY - 3 + 5 * rng(0, 1)) = t_stairs_down;
+                    set_ter(SEEX - 3 + 5 * rng(0, 1), SEEY - 3 + 5 * rng(0, 1), t_stairs_down);
                 break;
 
             case 3: // Big room
                 for (int i = 0; i < SEEX * 2; i++) {
                     for (int j = 0; j < SEEY * 2; j++) {
                         if (i < lw || i >= SEEX * 2 - 1 - rw)
-                            ter(i, j) = t_wall_v;
+                            set_ter(i, j, t_wall_v);
                         else if (j < tw || j >= SEEY * 2 - 1 - bw)
-                            ter(i, j) = t_wall_h;
+                            set_ter(i, j, t_wall_h);
                         else
-                            ter(i, j) = t_floor;
+                            set_ter(i, j, t_floor);
                     }
                 }
                 science_room(this, lw, tw, SEEX * 2 - 1 - rw, SEEY * 2 - 1 - bw, rng(0, 3));
@@ -1912,15 +1916,15 @@ void Map::draw_map(oter_id terrain_type,
                         sx = rng(lw, SEEX * 2 - 1 - rw);
                         sy = rng(tw, SEEY * 2 - 1 - bw);
                     } while (ter(sx, sy) != t_floor);
-                    ter(sx, sy) = t_stairs_up;
+                    set_ter(sx, sy, t_stairs_up);
                 }
                 if (rw == 1) {
-                    ter(SEEX * 2 - 1, SEEY - 1) = t_door_metal_c;
-                    ter(SEEX * 2 - 1, SEEY) = t_door_metal_c;
+                    set_ter(SEEX * 2 - 1, SEEY - 1, t_door_metal_c);
+                    set_ter(SEEX * 2 - 1, SEEY, t_door_metal_c);
                 }
                 if (bw == 1) {
-                    ter(SEEX - 1, SEEY * 2 - 1) = t_door_metal_c;
-                    ter(SEEX, SEEY * 2 - 1) = t_door_metal_c;
+                    set_ter(SEEX - 1, SEEY * 2 - 1, t_door_metal_c);
+                    set_ter(SEEX, SEEY * 2 - 1, t_door_metal_c);
                 }
                 if (terrain_type == ot_lab_stairs) {
                     int sx, sy;
@@ -1928,7 +1932,7 @@ void Map::draw_map(oter_id terrain_type,
                         sx = rng(lw, SEEX * 2 - 1 - rw);
                         sy = rng(tw, SEEY * 2 - 1 - bw);
                     } while (ter(sx, sy) != t_floor);
-                    ter(sx, sy) = t_stairs_down;
+                    set_ter(sx, sy, t_stairs_down);
                 }
                 break;
             }
@@ -1954,9 +1958,9 @@ void Map::draw_map(oter_id terrain_type,
                         || (j > tw && (!one_in(3) || (i > SEEX - 6 && i < SEEX + 5)))
                         || (j < SEEY * 2 - bw && (!one_in(3) || (i > SEEX - 6 && i < SEEX + 5)))) {
                         if (one_in(5))
-                            ter(i, j) = t_rubble;
+                            set_ter(i, j, t_rubble);
                         else
-                            ter(i, j) = t_rock_floor;
+                            set_ter(i, j, t_rock_floor);
                     }
                 }
             }
@@ -1974,9 +1978,9 @@ void Map::draw_map(oter_id terrain_type,
                         if (((j <= tw || i >= rw) && i >= j && (SEEX * 2 - 1 - i) <= j)
                             || ((j >= bw || i <= lw) && i <= j && (SEEY * 2 - 1 - j) <= i)) {
                             if (one_in(5))
-                                ter(i, j) = t_rubble;
+                                set_ter(i, j, t_rubble);
                             else if (!one_in(5))
-                                ter(i, j) = t_slime;
+                                set_ter(i, j, t_slime);
                         }
                     }
                 }
@@ -1994,20 +1998,20 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < lw || i > SEEX * 2 - 1 - rw)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (j < tw || j > SEEY * 2 - 1 - bw)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
             }
         }
         if (rw == 1) {
-            ter(SEEX * 2 - 1, SEEY - 1) = t_door_metal_c;
-            ter(SEEX * 2 - 1, SEEY) = t_door_metal_c;
+            set_ter(SEEX * 2 - 1, SEEY - 1, t_door_metal_c);
+            set_ter(SEEX * 2 - 1, SEEY, t_door_metal_c);
         }
         if (bw == 1) {
-            ter(SEEX - 1, SEEY * 2 - 1) = t_door_metal_c;
-            ter(SEEX, SEEY * 2 - 1) = t_door_metal_c;
+            set_ter(SEEX - 1, SEEY * 2 - 1, t_door_metal_c);
+            set_ter(SEEX, SEEY * 2 - 1, t_door_metal_c);
         }
         switch (rng(1, 2)) {
         case 1: // Weapons testing
@@ -2036,14 +2040,14 @@ void Map::draw_map(oter_id terrain_type,
                     add_item(SEEX, SEEY, (*itypes)[itm_mininuke], 0);
                 }
             } else {
-                ter(SEEX - 2, SEEY - 1) = t_rack;
-                ter(SEEX - 1, SEEY - 1) = t_rack;
-                ter(SEEX, SEEY - 1) = t_rack;
-                ter(SEEX + 1, SEEY - 1) = t_rack;
-                ter(SEEX - 2, SEEY) = t_rack;
-                ter(SEEX - 1, SEEY) = t_rack;
-                ter(SEEX, SEEY) = t_rack;
-                ter(SEEX + 1, SEEY) = t_rack;
+                set_ter(SEEX - 2, SEEY - 1, t_rack);
+                set_ter(SEEX - 1, SEEY - 1, t_rack);
+                set_ter(SEEX, SEEY - 1, t_rack);
+                set_ter(SEEX + 1, SEEY - 1, t_rack);
+                set_ter(SEEX - 2, SEEY, t_rack);
+                set_ter(SEEX - 1, SEEY, t_rack);
+                set_ter(SEEX, SEEY, t_rack);
+                set_ter(SEEX + 1, SEEY, t_rack);
                 place_items(mi_ammo, 96, SEEX - 2, SEEY - 1, SEEX + 1, SEEY - 1, false, 0);
                 place_items(mi_allguns, 96, SEEX - 2, SEEY, SEEX + 1, SEEY, false, 0);
             }
@@ -2058,13 +2062,13 @@ void Map::draw_map(oter_id terrain_type,
                     for (int j = tw; j <= bw; j++) {
                         if (j == tw || j == bw) {
                             if ((i - lw) % 2 == 0)
-                                ter(i, j) = t_wall_h;
+                                set_ter(i, j, t_wall_h);
                             else
-                                ter(i, j) = t_reinforced_glass_h;
+                                set_ter(i, j, t_reinforced_glass_h);
                         } else if ((i - lw) % 2 == 0)
-                            ter(i, j) = t_wall_v;
+                            set_ter(i, j, t_wall_v);
                         else if (j == tw + 2)
-                            ter(i, j) = t_wall_h;
+                            set_ter(i, j, t_wall_h);
                         else { // Empty space holds monsters!
                             mon_id type = mon_id(rng(mon_flying_polyp, mon_blank));
                             add_spawn(type, 1, i, j);
@@ -2072,11 +2076,11 @@ void Map::draw_map(oter_id terrain_type,
                     }
                 }
             }
-            ter(SEEX, 8) = t_computer_nether;
-            ter(SEEX - 2, 4) = t_radio_tower;
-            ter(SEEX + 1, 4) = t_radio_tower;
-            ter(SEEX - 2, 7) = t_radio_tower;
-            ter(SEEX + 1, 7) = t_radio_tower;
+            set_ter(SEEX, 8, t_computer_nether);
+            set_ter(SEEX - 2, 4, t_radio_tower);
+            set_ter(SEEX + 1, 4, t_radio_tower);
+            set_ter(SEEX - 2, 7, t_radio_tower);
+            set_ter(SEEX + 1, 7, t_radio_tower);
             break;
         }
         break;
@@ -2088,16 +2092,16 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j < 9 || j > 12 || i < 4 || i > 19)
-                    ter(i, j) = t_pavement;
+                    set_ter(i, j, t_pavement);
                 else if (j < 12 && j > 8 && (i == 4 || i == 19))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (i > 3 && i < 20 && j == 12)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
             }
         }
-        ter(16, 10) = t_stairs_down;
+        set_ter(16, 10, t_stairs_down);
         if (terrain_type == ot_sub_station_east)
             rotate(1);
         if (terrain_type == ot_sub_station_south)
@@ -2112,26 +2116,26 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i >= lw && i < lw + 3 && j >= tw && j < tw + 3)
-                    ter(i, j) = t_bulletin;
+                    set_ter(i, j, t_bulletin);
                 else
-                    ter(i, j) = t_grass;
+                    set_ter(i, j, t_grass);
             }
         }
         if (one_in(4)) {
-            ter(lw - 1, tw - 1) = t_tree_young;
-            ter(lw - 1, tw + 3) = t_tree_young;
-            ter(lw + 3, tw - 1) = t_tree_young;
-            ter(lw + 3, tw + 3) = t_tree_young;
+            set_ter(lw - 1, tw - 1, t_tree_young);
+            set_ter(lw - 1, tw + 3, t_tree_young);
+            set_ter(lw + 3, tw - 1, t_tree_young);
+            set_ter(lw + 3, tw + 3, t_tree_young);
         }
         if (one_in(6)) {
-            ter(0, 1) = t_tree;
-            ter(1, 0) = t_tree;
-            ter(0, SEEY * 2 - 2) = t_tree;
-            ter(1, SEEY * 2 - 1) = t_tree;
-            ter(SEEX * 2 - 2, 0) = t_tree;
-            ter(SEEX * 2 - 1, 1) = t_tree;
-            ter(SEEX * 2 - 2, SEEY * 2 - 1) = t_tree;
-            ter(SEEX * 2 - 1, SEEY * 2 - 2) = t_tree;
+            set_ter(0, 1, t_tree);
+            set_ter(1, 0, t_tree);
+            set_ter(0, SEEY * 2 - 2, t_tree);
+            set_ter(1, SEEY * 2 - 1, t_tree);
+            set_ter(SEEX * 2 - 2, 0, t_tree);
+            set_ter(SEEX * 2 - 1, 1, t_tree);
+            set_ter(SEEX * 2 - 2, SEEY * 2 - 1, t_tree);
+            set_ter(SEEX * 2 - 1, SEEY * 2 - 2, t_tree);
         }
         break;
 
@@ -2141,43 +2145,43 @@ void Map::draw_map(oter_id terrain_type,
                 if ((i > 2 && i < SEEX * 2 - 3 && (j == 2 || j == SEEY * 2 - 3))
                     || (((i > 3 && i < 11) || (i > 12 && i < 20))
                         && (j == 6 || j == 10 || j == 14)))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j > 2 && j < SEEY * 2 - 3 && (i == 3 || i == SEEX * 2 - 4)) {
                     if (j == 4 || j == 8 || j == 12 || j == 17 || j == 18)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                 } else if (j > 2 && j < 14 && (i == 10 || i == 13)) {
                     if (j == 4 || j == 8 || j == 12)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                 } else if (i > 2 && i < SEEX * 2 - 3 && j > 1 && j < SEEY * 2 - 2)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = t_grass;
+                    set_ter(i, j, t_grass);
             }
         }
-        ter(11, SEEY * 2 - 3) = t_door_c;
-        ter(12, SEEY * 2 - 3) = t_door_c;
-        ter(5, SEEY * 2 - 3) = t_window;
-        ter(6, SEEY * 2 - 3) = t_window;
-        ter(17, SEEY * 2 - 3) = t_window;
-        ter(18, SEEY * 2 - 3) = t_window;
+        set_ter(11, SEEY * 2 - 3, t_door_c);
+        set_ter(12, SEEY * 2 - 3, t_door_c);
+        set_ter(5, SEEY * 2 - 3, t_window);
+        set_ter(6, SEEY * 2 - 3, t_window);
+        set_ter(17, SEEY * 2 - 3, t_window);
+        set_ter(18, SEEY * 2 - 3, t_window);
         // Rear entrance, windows, or just a wall?
         switch (rng(0, 3)) {
         case 1:
         case 2:
-            ter(11, 2) = t_window;
-            ter(12, 2) = t_window;
+            set_ter(11, 2, t_window);
+            set_ter(12, 2, t_window);
             break;
         case 3:
-            ter(11, 2) = t_door_c;
-            ter(12, 2) = t_door_c;
+            set_ter(11, 2, t_door_c);
+            set_ter(12, 2, t_door_c);
             break;
         }
         // Where is the fridge?
-        ter(4 + 15 * rng(0, 1), 15 + 5 * rng(0, 1)) = t_fridge;
+        set_ter(4 + 15 * rng(0, 1), 15 + 5 * rng(0, 1), t_fridge);
         // Now, set up the interior of each room, picking a random layout
         for (int j = 4; j <= 11; j++) {
             for (int i = 4; i <= 19; i += 15) {
@@ -2186,29 +2190,29 @@ void Map::draw_map(oter_id terrain_type,
                     e = -1; // Right-side rooms are mirrored; no beds against the door!
                 switch (rng(1, 10)) {
                 case 1:
-                    ter(i, j) = t_bed;
-                    ter(i, j + 1) = t_bed;
-                    ter(i, j + 2) = t_dresser;
+                    set_ter(i, j, t_bed);
+                    set_ter(i, j + 1, t_bed);
+                    set_ter(i, j + 2, t_dresser);
                     break;
                 case 2:
-                    ter(i, j) = t_dresser;
-                    ter(i, j + 1) = t_bed;
-                    ter(i, j + 2) = t_bed;
+                    set_ter(i, j, t_dresser);
+                    set_ter(i, j + 1, t_bed);
+                    set_ter(i, j + 2, t_bed);
                     break;
                 case 3:
-                    ter(i, j) = t_bed;
-                    ter(i + e, j) = t_bed;
-                    ter(i + e * 2, j) = t_dresser;
+                    set_ter(i, j, t_bed);
+                    set_ter(i + e, j, t_bed);
+                    set_ter(i + e * 2, j, t_dresser);
                     break;
                 case 4:
-                    ter(i, j) = t_bed;
-                    ter(i, j + 1) = t_bed;
-                    ter(i + e, j) = t_bed;
+                    set_ter(i, j, t_bed);
+                    set_ter(i, j + 1, t_bed);
+                    set_ter(i + e, j, t_bed);
                     break;
                 case 5:
-                    ter(i, j) = t_bed;
-                    ter(i + e, j) = t_bed;
-                    ter(i, j + 2) = t_dresser;
+                    set_ter(i, j, t_bed);
+                    set_ter(i + e, j, t_bed);
+                    set_ter(i, j + 2, t_dresser);
                     break;
                 }
             }
@@ -2237,9 +2241,9 @@ void Map::draw_map(oter_id terrain_type,
                      && ((i > 2 && i < 10) || (i > 13 && i < SEEX * 2 - 3)))
                     || ((i == 3 || i == SEEX * 2 - 4)
                         && ((j > 2 && j < 10) || (j > 13 && j < SEEY * 2 - 3))))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else
-                    ter(i, j) = t_dirt;
+                    set_ter(i, j, t_dirt);
             }
         }
 
@@ -2264,37 +2268,37 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 5 && i > 2 && i < SEEX * 2 - 3)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j == 13 && i > 2 && i < SEEX * 2 - 3) {
                     if (i == 6 || i == 7 || i == 16 || i == 17)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (i == 11)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if (j == 9 && i > 3 && i < SEEX * 2 - 4) {
                     if (i == 11)
-                        ter(i, j) = t_counter;
+                        set_ter(i, j, t_counter);
                     else if (i == 12)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if ((i == 3 || i == SEEX * 2 - 4) && j > 5 && j < 13)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (j == 6 && i > 3 && i < SEEX * 2 - 4)
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (j > 6 && j < 13 && i > 2 && i < SEEX * 2 - 3)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         place_items(mi_weapons, 90, 4, 6, SEEX * 2 - 5, 6, false, 0);
         make_all_items_owned();
         if (one_in(2))
-            ter(SEEX * 2 - 5, 9) = t_door_c;
+            set_ter(SEEX * 2 - 5, 9, t_door_c);
         else
-            ter(4, 9) = t_door_c;
+            set_ter(4, 9, t_door_c);
         rotate(rng(0, 4));
         break;
 
@@ -2303,32 +2307,32 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((j == 1 && i > 15 && i < SEEX * 2 - 4) || (j == 8 && i > 3 && i < 16)
                     || (j == 16 && i > 3 && i < SEEX * 2 - 4))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j == 13 && i > 4 && i < 16) {
                     if (i == 5)
-                        ter(i, j) = t_door_locked;
+                        set_ter(i, j, t_door_locked);
                     else if (i == 10)
-                        ter(i, j) = t_counter;
+                        set_ter(i, j, t_counter);
                     else if (i == 11)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if ((i == 4 && j > 8 && j < 16) || (i == SEEX * 2 - 5 && j > 1 && j < 16)
                            || (i == 16 && j > 1 && j < 14))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((j == 9 && i > 4 && i < 16) || (i == 15 && j > 9 && j < 13))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (j == 13 && (i == 17 || i == 18))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((j > 8 && j < 16 && i > 4 && i < 16)
                          || (j > 1 && j < 16 && i > 16 && i < 19))
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(15, 16) = t_door_c;
-        ter(16, 14) = t_wall_glass_v;
+        set_ter(15, 16, t_door_c);
+        set_ter(16, 14, t_wall_glass_v);
         place_items(mi_allguns, 88, 5, 9, 14, 9, false, 0);
         place_items(mi_ammo, 92, 15, 9, 15, 12, false, 0);
         place_items(mi_gunxtras, 80, 15, 9, 15, 12, false, 0);
@@ -2341,30 +2345,30 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (((j == 6 || j == 17) && i > 4 && i < SEEX * 2 - 5)
                     || (j == 9 && i > 4 && i < 11))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 5 || i == SEEX * 2 - 6) && j > 6 && j < 17) || (i == 10 && j == 8))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((j == 10 || j == 12 || j == 14)
                          && (i == 6 || i == 7 || i == 16 || i == 17))
-                    ter(i, j) = t_bed;
+                    set_ter(i, j, t_bed);
                 else if (j == 7 && i > 13 && i < SEEX * 2 - 6)
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((j == 8 && i > 5 && i < 10) || (i == 6 && j == 7))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (i > 5 && i < SEEX * 2 - 6 && j > 6 && j < 17)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         if (one_in(5))
-            ter(10, 7) = t_door_c;
+            set_ter(10, 7, t_door_c);
         else
-            ter(10, 7) = t_door_locked;
+            set_ter(10, 7, t_door_locked);
         w_fac = rng(6, 11);
-        ter(w_fac, 17) = t_window;
-        ter(w_fac + 1, 17) = t_window;
-        ter(rng(13, 16), 17) = t_door_c;
+        set_ter(w_fac, 17, t_window);
+        set_ter(w_fac + 1, 17, t_window);
+        set_ter(rng(13, 16), 17, t_door_c);
         place_items(mi_harddrugs, 80, 6, 7, 6, 8, false, 0);
         place_items(mi_softdrugs, 86, 7, 8, 9, 8, false, 0);
         place_items(mi_dissection, 60, 14, 7, 17, 7, false, 0);
@@ -2376,27 +2380,27 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i == 5 || i == SEEX * 2 - 6) && j > 7 && j < 19)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((j == 7 || j == 13) && i > 4 && i < SEEX * 2 - 5)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j == 19 && i > 4 && i < SEEX * 2 - 5) {
                     if ((i > 5 && i < 9) || (i > 14 && i < 18))
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if (j == 16 && i > 4 && i < SEEX * 2 - 5)
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (i < 18 && ((j == 8 && i > 5) || (j == 10 && i > 7) || (j == 12 && i > 9)))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (j > 7 && j < 19 && i > 5 && i < SEEX * 2 - 6)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(rng(10, 13), 19) = t_door_c;
-        ter(rng(6, 9), 13) = t_door_c;
-        ter(8 + dice(3, 3), 16) = t_floor;
+        set_ter(rng(10, 13), 19, t_door_c);
+        set_ter(rng(6, 9), 13, t_door_c);
+        set_ter(8 + dice(3, 3), 16, t_floor);
         place_items(mi_shoes, 75, 12, 14, 17, 14, false, 0);
         place_items(mi_allclothes, 90, 6, 8, 17, 8, false, 0);
         place_items(mi_allclothes, 90, 8, 10, 17, 10, false, 0);
@@ -2409,27 +2413,27 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 4 && i > 1 && i < SEEX * 2 - 2)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j == 17 && i > 1 && i < SEEX * 2 - 2) {
                     if ((i > 4 && i < 9) || (i > 14 && i < 19))
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (i == 11 || i == 12)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if ((i == 2 || i == SEEX * 2 - 3) && j > 4 && j < 17)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if ((j == 13 && i > 3 && i < 10) || (i == 9 && j > 13 && j < 17))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (j == 5 && i > 11 && i < SEEX * 2 - 3)
-                    ter(i, j) = t_fridge;
+                    set_ter(i, j, t_fridge);
                 else if (((i == 4 || i == 5 || i == 8 || i == 9) && j > 5 && j < 11)
                          || ((i == 13 || i == 14 || i == 17 || i == 18) && j > 7 && j < 15))
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 4 && j < 17)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         place_items(mi_fridge, 92, 12, 5, 20, 5, false, turn);
@@ -2451,30 +2455,30 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((j == SEEY - 3 && (i > 3 && i < 8)) || (i > 15 && i < 20)) {
-                    ter(i, j) = ter_id::t_window;
+                    set_ter(i, j, ter_id::t_window);
                 } else if (j == SEEY - 3 && i > 9 && i < 14)
-                    ter(i, j) = t_door_c;
+                    set_ter(i, j, t_door_c);
                 else if (((j == 2 || j == SEEY * 2 - 3) && i > 1 && i < SEEX * 2 - 2)
                          || (j == tw && i > 2 && i < SEEX * 2 - 3))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (((i == 2 || i == SEEY * 2 - 3) && j > 2 && j < SEEY * 2 - 3)
                          || (i == 13 && j > 2 && j < 6) || ((i == 7 || i == 12) && j > 8 && j < 17))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (((i == 3 || i == 6 || i == 8 || i == 11 || i == 13) && j > 8 && j < 17)
                          || (j == 7 && i > 4 && i < 14)) {
-                    ter(i, j) = ter_id::t_slot_machine;
+                    set_ter(i, j, ter_id::t_slot_machine);
                 } else if (((j == 9 || j == 11 || j == 13 || j == 15) && i < SEEX * 2 - 3
                             && i > SEEX * 2 - 6)
                            || (i == SEEX * 2 - 5 && (j == 8 || j == 14)))
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 2 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
-        ter(14, rng(3, 5)) = t_door_c;
-        ter(rng(15, 20), 6) = t_door_locked;
+        set_ter(14, rng(3, 5), t_door_c);
+        set_ter(rng(15, 20), 6, t_door_locked);
         // TODO: What's in the back rooms?  Some goodies, presumably.  Maybe a MOB BOSS.
 
         break;
@@ -2484,29 +2488,29 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (((j == 2 || j == SEEY * 2 - 3) && i > 1 && i < SEEX * 2 - 2)
                     || (j == 17 && i > 2 && i < SEEX * 2 - 3))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if ((i == 2 || i == SEEX * 2 - 3) && j > 2 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (j > 2 && j < 17 && (j % 3 == 1 || j % 3 == 2) && i > 2 && i < SEEX * 2 - 3
                          && (i < 10 || i > 12))
-                    ter(i, j) = t_bookcase;
+                    set_ter(i, j, t_bookcase);
                 else if (i > 2 && i < SEEX * 2 - 3 && j > 2 && j < SEEY * 2 - 3)
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
             }
         }
         for (int j = 3; j <= 5; j += 3) {
-            ter(2, j) = t_window;
-            ter(SEEX * 2 - 3, j) = t_window;
-        }
-        ter(rng(10, 12), 2) = t_window;
-        ter(rng(10, 12), 17) = t_door_c;
-        ter(rng(8, 13), SEEY * 2 - 3) = t_door_c;
-        ter(rng(3, 7), SEEY * 2 - 3) = t_window;
-        ter(rng(14, 18), SEEY * 2 - 3) = t_window;
-        ter(15, 19) = t_counter;
-        ter(15, 20) = t_counter;
+            set_ter(2, j, t_window);
+            set_ter(SEEX * 2 - 3, j, t_window);
+        }
+        set_ter(rng(10, 12), 2, t_window);
+        set_ter(rng(10, 12), 17, t_door_c);
+        set_ter(rng(8, 13), SEEY * 2 - 3, t_door_c);
+        set_ter(rng(3, 7), SEEY * 2 - 3, t_window);
+        set_ter(rng(14, 18), SEEY * 2 - 3, t_window);
+        set_ter(15, 19, t_counter);
+        set_ter(15, 20, t_counter);
         place_items(mi_magazines, 80, 3, 16, 9, 16, false, 0);
         place_items(mi_magazines, 80, 13, 16, 20, 16, false, 0);
 
@@ -2538,19 +2542,19 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (((i == 1 || i == SEEX * 2 - 2) && j > 0 && j < SEEY * 2 - 2)
                     || ((i == 10 || i == 13) && j > 0 && j < 18))
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (((j == 0 || j == SEEY * 2 - 2) && i > 0 && i < SEEX * 2 - 1)
                          || ((j == 6 || j == 12 || j == 18) && i > 1 && i < SEEX * 2 - 2 && i != 11
                              && i != 12))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
             }
         }
         for (int j = 3; j <= 15; j += 6) {
-            ter(10, j) = t_door_c;
-            ter(13, j) = t_door_c;
+            set_ter(10, j, t_door_c);
+            set_ter(13, j, t_door_c);
         }
-        ter(14, 19) = t_counter;
-        ter(15, 19) = t_counter;
+        set_ter(14, 19, t_counter);
+        set_ter(15, 19, t_counter);
         set_science_room(this, 2, 1, true, turn);
         set_science_room(this, 2, 7, true, turn);
         set_science_room(this, 2, 13, true, turn);
@@ -2564,26 +2568,26 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((j == 8 && i > 1 && i < SEEX * 2 - 2) || (j == 13 && i > 2 && i < SEEX * 2 - 3))
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (j == 19) {
                     if (i < 2 || i > SEEX * 2 - 3)
-                        ter(i, j) = grass_or_dirt();
+                        set_ter(i, j, grass_or_dirt());
                     else if ((i > 4 && i < 8) || (i > 15 && i < 19))
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else if (i == 11 || i == 12)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else if (j == 14 && i > 2 && i < 15)
-                    ter(i, j) = t_rack;
+                    set_ter(i, j, t_rack);
                 else if ((j == 16 || j == 9) && i > 2 && i < 19)
-                    ter(i, j) = t_counter;
+                    set_ter(i, j, t_counter);
                 else if ((i == 2 || i == SEEX * 2 - 3) && j > 8 && j < 19)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
             }
         }
-        ter(3, 12) = t_bed;
-        ter(4, 12) = t_bed;
+        set_ter(3, 12, t_bed);
+        set_ter(4, 12, t_bed);
         place_items(mi_dissection, 70, 3, 9, 18, 9, false, 0);
         place_items(mi_electronics, 50, 3, 9, 18, 9, false, 0);
 
@@ -2592,13 +2596,13 @@ void Map::draw_map(oter_id terrain_type,
     case ot_radio_tower:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = grass_or_dirt();
+                set_ter(i, j, grass_or_dirt());
         }
         lw = rng(1, SEEX * 2 - 2);
         tw = rng(1, SEEY * 2 - 2);
         for (int i = lw; i < lw + 4; i++) {
             for (int j = tw; j < tw + 4; j++)
-                ter(i, j) = t_radio_tower;
+                set_ter(i, j, t_radio_tower);
         }
         rw = -1;
         bw = -1;
@@ -2614,23 +2618,23 @@ void Map::draw_map(oter_id terrain_type,
             for (int i = rw; i < rw + 12; i++) {
                 for (int j = bw; j < bw + 6; j++) {
                     if (j == bw || j == bw + 5)
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                     else if (i == rw || i == rw + 11)
-                        ter(i, j) = t_wall_v;
+                        set_ter(i, j, t_wall_v);
                     else if (j == bw + 1)
-                        ter(i, j) = t_counter;
+                        set_ter(i, j, t_counter);
                     else
-                        ter(i, j) = t_floor;
+                        set_ter(i, j, t_floor);
                 }
             }
             cw = rng(rw + 2, rw + 8);
-            ter(cw, bw + 5) = t_window;
-            ter(cw + 1, bw + 5) = t_window;
-            ter(rng(rw + 2, rw + 8), bw + 5) = t_door_c;
-            ter(rng(rw + 2, rw + 8), bw + 1) = t_radio_controls;
+            set_ter(cw, bw + 5, t_window);
+            set_ter(cw + 1, bw + 5, t_window);
+            set_ter(rng(rw + 2, rw + 8), bw + 5, t_door_c);
+            set_ter(rng(rw + 2, rw + 8), bw + 1, t_radio_controls);
             place_items(mi_radio, 60, rw + 1, bw + 2, rw + 10, bw + 4, true, 0);
         } else // No control room... simple controls near the tower
-            ter(rng(lw, lw + 3), tw + 4) = t_radio_controls;
+            set_ter(rng(lw, lw + 3), tw + 4, t_radio_controls);
         break;
 
     case ot_gate:
@@ -2653,33 +2657,33 @@ void Map::draw_map(oter_id terrain_type,
             s_fac = 15;
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = grass_or_dirt();
+                set_ter(i, j, grass_or_dirt());
         }
         for (int i = w_fac; i < e_fac; i++) {
             for (int j = 9; j < 15; j++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         for (int j = n_fac; j < s_fac; j++) {
             for (int i = 9; i < 15; i++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         if (terrain_type == ot_gate) {
             if (e_fac == 0) {
                 for (int i = 9; i < 15; i++) {
                     for (int j = 9; j < 15; j++) {
                         if (j == 11)
-                            ter(i, j) = t_portcullis;
+                            set_ter(i, j, t_portcullis);
                         else
-                            ter(i, j) = grass_or_dirt();
+                            set_ter(i, j, grass_or_dirt());
                     }
                 }
             } else { // It's safe to assume with a gate that if e_fac!=0, n_fac==0
                 for (int i = 9; i < 15; i++) {
                     for (int j = 9; j < 15; j++) {
                         if (i == 11)
-                            ter(i, j) = t_portcullis;
+                            set_ter(i, j, t_portcullis);
                         else
-                            ter(i, j) = grass_or_dirt();
+                            set_ter(i, j, grass_or_dirt());
                     }
                 }
             }
@@ -2690,11 +2694,11 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 8 || j < 8 || i > SEEX * 2 - 9 || j > SEEY * 2 - 9)
-                    ter(i, j) = grass_or_dirt();
+                    set_ter(i, j, grass_or_dirt());
                 else if ((i == 11 || i == 12) && (j == 11 || j == 12))
-                    ter(i, j) = t_slope_down;
+                    set_ter(i, j, t_slope_down);
                 else
-                    ter(i, j) = t_dirtmound;
+                    set_ter(i, j, t_dirtmound);
             }
         }
         break;
@@ -2721,9 +2725,9 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (rng(0, n_fac) > j || rng(0, e_fac) > SEEX * 2 - 1 - i || rng(0, w_fac) > i
                     || rng(0, s_fac) > SEEY * 2 - 1 - j)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
                 else
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
             }
         }
         break;
@@ -2760,11 +2764,11 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((n_fac < 0 && j < n_fac * -1) || (s_fac < 0 && j >= SEEY * 2 - s_fac)
                     || (w_fac < 0 && i < w_fac * -1) || (e_fac < 0 && i >= SEEX * 2 - e_fac)) {
-                    ter(i, j) = ter_id::t_rock_floor;
+                    set_ter(i, j, ter_id::t_rock_floor);
                 } else if (j < n_fac || j >= SEEY * 2 - s_fac || i < w_fac || i >= SEEX * 2 - e_fac)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_lava;
+                    set_ter(i, j, t_lava);
             }
         }
         break;
@@ -2783,88 +2787,88 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j < n_fac || j >= SEEY * 2 - s_fac || i < w_fac || i >= SEEX * 2 - e_fac
                     || (i >= 6 && i < SEEX * 2 - 6 && j >= 6 && j < SEEY * 2 - 6))
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
                 else
-                    ter(i, j) = t_lava;
+                    set_ter(i, j, t_lava);
                 if (i >= SEEX - 1 && i <= SEEX && j >= SEEY - 1 && j <= SEEY)
-                    ter(i, j) = t_slope_down;
+                    set_ter(i, j, t_slope_down);
             }
         }
         switch (rng(0, 4)) { // Randomly chosen "altar" design
         case 0:
             for (int i = 7; i <= 16; i += 3) {
-                ter(i, 6) = t_rock;
-                ter(i, 17) = t_rock;
-                ter(6, i) = t_rock;
-                ter(17, i) = t_rock;
+                set_ter(i, 6, t_rock);
+                set_ter(i, 17, t_rock);
+                set_ter(6, i, t_rock);
+                set_ter(17, i, t_rock);
                 if (i > 7 && i < 16) {
-                    ter(i, 10) = t_rock;
-                    ter(i, 13) = t_rock;
+                    set_ter(i, 10, t_rock);
+                    set_ter(i, 13, t_rock);
                 } else {
-                    ter(i - 1, 6) = t_rock;
-                    ter(i - 1, 10) = t_rock;
-                    ter(i - 1, 13) = t_rock;
-                    ter(i - 1, 17) = t_rock;
+                    set_ter(i - 1, 6, t_rock);
+                    set_ter(i - 1, 10, t_rock);
+                    set_ter(i - 1, 13, t_rock);
+                    set_ter(i - 1, 17, t_rock);
                 }
             }
             break;
         case 1:
             for (int i = 6; i < 11; i++) {
-                ter(i, i) = t_lava;
-                ter(SEEX * 2 - 1 - i, i) = t_lava;
-                ter(i, SEEY * 2 - 1 - i) = t_lava;
-                ter(SEEX * 2 - 1 - i, SEEY * 2 - 1 - i) = t_lava;
+                set_ter(i, i, t_lava);
+                set_ter(SEEX * 2 - 1 - i, i, t_lava);
+                set_ter(i, SEEY * 2 - 1 - i, t_lava);
+                set_ter(SEEX * 2 - 1 - i, SEEY * 2 - 1 - i, t_lava);
                 if (i < 10) {
-                    ter(i + 1, i) = t_lava;
-                    ter(SEEX * 2 - i, i) = t_lava;
-                    ter(i + 1, SEEY * 2 - 1 - i) = t_lava;
-                    ter(SEEX * 2 - i, SEEY * 2 - 1 - i) = t_lava;
-
-                    ter(i, i + 1) = t_lava;
-                    ter(SEEX * 2 - 1 - i, i + 1) = t_lava;
-                    ter(i, SEEY * 2 - i) = t_lava;
-                    ter(SEEX * 2 - 1 - i, SEEY * 2 - i) = t_lava;
+                    set_ter(i + 1, i, t_lava);
+                    set_ter(SEEX * 2 - i, i, t_lava);
+                    set_ter(i + 1, SEEY * 2 - 1 - i, t_lava);
+                    set_ter(SEEX * 2 - i, SEEY * 2 - 1 - i, t_lava);
+
+                    set_ter(i, i + 1, t_lava);
+                    set_ter(SEEX * 2 - 1 - i, i + 1, t_lava);
+                    set_ter(i, SEEY * 2 - i, t_lava);
+                    set_ter(SEEX * 2 - 1 - i, SEEY * 2 - i, t_lava);
                 }
                 if (i < 9) {
-                    ter(i + 2, i) = t_rock;
-                    ter(SEEX * 2 - i + 1, i) = t_rock;
-                    ter(i + 2, SEEY * 2 - 1 - i) = t_rock;
-                    ter(SEEX * 2 - i + 1, SEEY * 2 - 1 - i) = t_rock;
-
-                    ter(i, i + 2) = t_rock;
-                    ter(SEEX * 2 - 1 - i, i + 2) = t_rock;
-                    ter(i, SEEY * 2 - i + 1) = t_rock;
-                    ter(SEEX * 2 - 1 - i, SEEY * 2 - i + 1) = t_rock;
+                    set_ter(i + 2, i, t_rock);
+                    set_ter(SEEX * 2 - i + 1, i, t_rock);
+                    set_ter(i + 2, SEEY * 2 - 1 - i, t_rock);
+                    set_ter(SEEX * 2 - i + 1, SEEY * 2 - 1 - i, t_rock);
+
+                    set_ter(i, i + 2, t_rock);
+                    set_ter(SEEX * 2 - 1 - i, i + 2, t_rock);
+                    set_ter(i, SEEY * 2 - i + 1, t_rock);
+                    set_ter(SEEX * 2 - 1 - i, SEEY * 2 - i + 1, t_rock);
                 }
             }
             break;
         case 2:
             for (int i = 7; i < 17; i++) {
-                ter(i, 6) = t_rock;
-                ter(6, i) = t_rock;
-                ter(i, 17) = t_rock;
-                ter(17, i) = t_rock;
+                set_ter(i, 6, t_rock);
+                set_ter(6, i, t_rock);
+                set_ter(i, 17, t_rock);
+                set_ter(17, i, t_rock);
                 if (i != 7 && i != 16 && i != 11 && i != 12) {
-                    ter(i, 8) = t_rock;
-                    ter(8, i) = t_rock;
-                    ter(i, 15) = t_rock;
-                    ter(15, i) = t_rock;
+                    set_ter(i, 8, t_rock);
+                    set_ter(8, i, t_rock);
+                    set_ter(i, 15, t_rock);
+                    set_ter(15, i, t_rock);
                 }
                 if (i == 11 || i == 12) {
-                    ter(i, 10) = t_rock;
-                    ter(10, i) = t_rock;
-                    ter(i, 13) = t_rock;
-                    ter(13, i) = t_rock;
+                    set_ter(i, 10, t_rock);
+                    set_ter(10, i, t_rock);
+                    set_ter(i, 13, t_rock);
+                    set_ter(13, i, t_rock);
                 }
             }
             break;
         case 3:
             for (int i = 6; i < 11; i++) {
                 for (int j = 6; j < 11; j++) {
-                    ter(i, j) = t_lava;
-                    ter(SEEX * 2 - 1 - i, j) = t_lava;
-                    ter(i, SEEY * 2 - 1 - j) = t_lava;
-                    ter(SEEX * 2 - 1 - i, SEEY * 2 - 1 - j) = t_lava;
+                    set_ter(i, j, t_lava);
+                    set_ter(SEEX * 2 - 1 - i, j, t_lava);
+                    set_ter(i, SEEY * 2 - 1 - j, t_lava);
+                    set_ter(SEEX * 2 - 1 - i, SEEY * 2 - 1 - j, t_lava);
                 }
             }
             break;
@@ -2882,35 +2886,35 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((j < n_fac * SEEX || (i < w_fac * SEEX && !one_in(10))
                      || j > SEEY * 2 - s_fac * SEEY || i > SEEX * 2 - e_fac * SEEX)) {
-                    ter(i, j) = (!one_in(10) ? ter_id::t_slime : ter_id::t_rock_floor);
+                    set_ter(i, j, (!one_in(10) ? ter_id::t_slime : ter_id::t_rock_floor));
                 } else if (rng(0, SEEX) > abs(i - SEEX) && rng(0, SEEY) > abs(j - SEEY))
-                    ter(i, j) = t_slime;
+                    set_ter(i, j, t_slime);
                 else if (t_above == ot_null)
-                    ter(i, j) = t_dirt;
+                    set_ter(i, j, t_dirt);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
 
         if (terrain_type == ot_slimepit_down)
-            ter(rng(3, SEEX * 2 - 4), rng(3, SEEY * 2 - 4)) = t_slope_down;
+            set_ter(rng(3, SEEX * 2 - 4), rng(3, SEEY * 2 - 4), t_slope_down);
 
         if (t_above == ot_slimepit_down) {
             switch (rng(1, 4)) {
             case 1: {
-                ter(rng(0, 2), rng(0, 2)) = ter_id::t_slope_up;
+                set_ter(rng(0, 2), rng(0, 2), ter_id::t_slope_up);
             } break;
 
             case 2: {
-                ter(rng(0, 2), SEEY * 2 - rng(1, 3)) = ter_id::t_slope_up;
+                set_ter(rng(0, 2), SEEY * 2 - rng(1, 3), ter_id::t_slope_up);
             } break;
 
             case 3: {
-                ter(SEEX * 2 - rng(1, 3), rng(0, 2)) = ter_id::t_slope_up;
+                set_ter(SEEX * 2 - rng(1, 3), rng(0, 2), ter_id::t_slope_up);
             } break;
 
             case 4: {
-                ter(SEEX * 2 - rng(1, 3), SEEY * 2 - rng(1, 3)) = ter_id::t_slope_up;
+                set_ter(SEEX * 2 - rng(1, 3), SEEY * 2 - rng(1, 3), ter_id::t_slope_up);
             } break;
             }
         }
@@ -2924,45 +2928,45 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i == 0 || j == 0 || i == SEEX * 2 - 1 || j == SEEY * 2 - 1)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         switch (rng(1, 4)) { // TODO: More types!
         case 1:              // Weapons cache
             for (int i = 2; i < SEEX * 2 - 2; i++) {
-                ter(i, 1) = t_rack;
-                ter(i, 5) = t_rack;
-                ter(i, 9) = t_rack;
+                set_ter(i, 1, t_rack);
+                set_ter(i, 5, t_rack);
+                set_ter(i, 9, t_rack);
             }
             place_items(mi_allguns, 92, 2, 1, SEEX * 2 - 3, 1, false, 0);
             place_items(mi_ammo, 94, 2, 5, SEEX * 2 - 3, 5, false, 0);
             place_items(mi_weapons, 88, 2, 9, SEEX * 2 - 3, 9, false, 0);
-            ter(SEEX - 1, SEEY * 2 - 2) = t_stairs_up;
-            ter(SEEX, SEEY * 2 - 2) = t_stairs_up;
+            set_ter(SEEX - 1, SEEY * 2 - 2, t_stairs_up);
+            set_ter(SEEX, SEEY * 2 - 2, t_stairs_up);
             break;
         case 2: // Survival Bunker
-            ter(1, 1) = t_bed;
-            ter(1, 2) = t_bed;
-            ter(SEEX * 2 - 2, 1) = t_bed;
-            ter(SEEX * 2 - 2, 2) = t_bed;
+            set_ter(1, 1, t_bed);
+            set_ter(1, 2, t_bed);
+            set_ter(SEEX * 2 - 2, 1, t_bed);
+            set_ter(SEEX * 2 - 2, 2, t_bed);
             for (int i = 1; i < SEEY; i++) {
-                ter(SEEX - 1, i) = t_rack;
-                ter(SEEX, i) = t_rack;
+                set_ter(SEEX - 1, i, t_rack);
+                set_ter(SEEX, i, t_rack);
             }
             place_items(mi_softdrugs, 86, SEEX - 1, 1, SEEX, 2, false, 0);
             place_items(mi_cannedfood, 92, SEEX - 1, 3, SEEX, 6, false, 0);
             place_items(mi_homeguns, 72, SEEX - 1, 7, SEEX, 7, false, 0);
             place_items(mi_survival_tools, 83, SEEX - 1, 8, SEEX, 10, false, 0);
             place_items(mi_manuals, 60, SEEX - 1, 11, SEEX, 11, false, 0);
-            ter(SEEX - 1, SEEX * 2 - 2) = t_stairs_up;
-            ter(SEEX, SEEX * 2 - 2) = t_stairs_up;
+            set_ter(SEEX - 1, SEEX * 2 - 2, t_stairs_up);
+            set_ter(SEEX, SEEX * 2 - 2, t_stairs_up);
             break;
         case 3: // Chem lab
             for (int i = 1; i < SEEY + 4; i++) {
-                ter(1, i) = t_counter;
-                ter(SEEX * 2 - 2, i) = t_counter;
+                set_ter(1, i, t_counter);
+                set_ter(SEEX * 2 - 2, i, t_counter);
             }
             place_items(mi_chemistry, 90, 1, 1, 1, SEEY + 3, false, 0);
             if (one_in(3))
@@ -2989,23 +2993,23 @@ void Map::draw_map(oter_id terrain_type,
                     || (j < 4 && (n_fac == 0 || i < 4 || i > SEEX * 2 - 5))
                     || (i > SEEX * 2 - 5 && (e_fac == 0 || j < 4 || j > SEEY * 2 - 5))
                     || (j > SEEY * 2 - 5 && (s_fac == 0 || i < 4 || i > SEEX * 2 - 5)))
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
-        ter(2, 2) = t_stairs_up;
-        ter(SEEX * 2 - 3, 2) = t_stairs_up;
-        ter(2, SEEY * 2 - 3) = t_stairs_up;
-        ter(SEEX * 2 - 3, SEEY * 2 - 3) = t_stairs_up;
+        set_ter(2, 2, t_stairs_up);
+        set_ter(SEEX * 2 - 3, 2, t_stairs_up);
+        set_ter(2, SEEY * 2 - 3, t_stairs_up);
+        set_ter(SEEX * 2 - 3, SEEY * 2 - 3, t_stairs_up);
         if (ter(2, SEEY) == t_floor)
-            ter(2, SEEY) = t_stairs_up;
+            set_ter(2, SEEY, t_stairs_up);
         if (ter(SEEX * 2 - 3, SEEY) == t_floor)
-            ter(SEEX * 2 - 3, SEEY) = t_stairs_up;
+            set_ter(SEEX * 2 - 3, SEEY, t_stairs_up);
         if (ter(SEEX, 2) == t_floor)
-            ter(SEEX, 2) = t_stairs_up;
+            set_ter(SEEX, 2, t_stairs_up);
         if (ter(SEEX, SEEY * 2 - 3) == t_floor)
-            ter(SEEX, SEEY * 2 - 3) = t_stairs_up;
+            set_ter(SEEX, SEEY * 2 - 3, t_stairs_up);
         break;
     case ot_subway_ns:
     case ot_subway_ew:
@@ -3019,15 +3023,15 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < w_fac || i > e_fac)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else if (one_in(90))
-                    ter(i, j) = t_rubble;
+                    set_ter(i, j, t_rubble);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (t_above >= ot_sub_station_north && t_above <= ot_sub_station_west)
-            ter(SEEX * 2 - 5, rng(SEEY - 5, SEEY + 4)) = t_stairs_up;
+            set_ter(SEEX * 2 - 5, rng(SEEY - 5, SEEY + 4), t_stairs_up);
         place_items(mi_subway, 30, 4, 0, SEEX * 2 - 5, SEEY * 2 - 1, true, 0);
         if (terrain_type == ot_subway_ew)
             rotate(1);
@@ -3040,15 +3044,15 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i >= SEEX * 2 - 4 && j < 4) || i < 4 || j >= SEEY * 2 - 4)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else if (one_in(30))
-                    ter(i, j) = t_rubble;
+                    set_ter(i, j, t_rubble);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (t_above >= ot_sub_station_north && t_above <= ot_sub_station_west)
-            ter(SEEX * 2 - 5, rng(SEEY - 5, SEEY + 4)) = t_stairs_up;
+            set_ter(SEEX * 2 - 5, rng(SEEY - 5, SEEY + 4), t_stairs_up);
         place_items(mi_subway, 30, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
         if (terrain_type == ot_subway_es)
             rotate(1);
@@ -3065,15 +3069,15 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < 4 || (i >= SEEX * 2 - 4 && (j < 4 || j >= SEEY * 2 - 4)))
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else if (one_in(30))
-                    ter(i, j) = t_rubble;
+                    set_ter(i, j, t_rubble);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (t_above >= ot_sub_station_north && t_above <= ot_sub_station_west)
-            ter(4, rng(SEEY - 5, SEEY + 4)) = t_stairs_up;
+            set_ter(4, rng(SEEY - 5, SEEY + 4), t_stairs_up);
         place_items(mi_subway, 35, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
         if (terrain_type == ot_subway_esw)
             rotate(1);
@@ -3087,15 +3091,15 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i < 4 || i >= SEEX * 2 - 4) && (j < 4 || j >= SEEY * 2 - 4))
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else if (one_in(30))
-                    ter(i, j) = t_rubble;
+                    set_ter(i, j, t_rubble);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (t_above >= ot_sub_station_north && t_above <= ot_sub_station_west)
-            ter(4 + rng(0, 1) * (SEEX * 2 - 9), 4 + rng(0, 1) * (SEEY * 2 - 9)) = t_stairs_up;
+            set_ter(4 + rng(0, 1) * (SEEX * 2 - 9), 4 + rng(0, 1) * (SEEY * 2 - 9), t_stairs_up);
         place_items(mi_subway, 40, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
         break;
 
@@ -3104,9 +3108,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < SEEX - 2 || i > SEEX + 1)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_sewage;
+                    set_ter(i, j, t_sewage);
             }
         }
         place_items(mi_sewer, 10, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
@@ -3121,9 +3125,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i > SEEX + 1 && j < SEEY - 2) || i < SEEX - 2 || j > SEEY + 1)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_sewage;
+                    set_ter(i, j, t_sewage);
             }
         }
         place_items(mi_sewer, 18, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
@@ -3142,9 +3146,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < SEEX - 2 || (i > SEEX + 1 && (j < SEEY - 2 || j > SEEY + 1)))
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_sewage;
+                    set_ter(i, j, t_sewage);
             }
         }
         place_items(mi_sewer, 23, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
@@ -3161,17 +3165,17 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((i < SEEX - 2 || i > SEEX + 1) && (j < SEEY - 2 || j > SEEY + 1))
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_sewage;
+                    set_ter(i, j, t_sewage);
                 if (rn == 0
                     && (trig_dist(i, j, SEEX - 1, SEEY - 1) <= 6
                         || trig_dist(i, j, SEEX - 1, SEEY) <= 6
                         || trig_dist(i, j, SEEX, SEEY - 1) <= 6
                         || trig_dist(i, j, SEEX, SEEY) <= 6))
-                    ter(i, j) = t_sewage;
+                    set_ter(i, j, t_sewage);
                 if (rn == 0 && (i == SEEX - 1 || i == SEEX) && (j == SEEY - 1 || j == SEEY))
-                    ter(i, j) = t_grate;
+                    set_ter(i, j, t_grate);
             }
         }
         place_items(mi_sewer, 28, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, true, 0);
@@ -3182,12 +3186,12 @@ void Map::draw_map(oter_id terrain_type,
         x = SEEX;
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         for (int j = 0; j < SEEY * 2; j++) {
             for (int i = x - 2; i <= x + 3; i++) {
                 if (i >= 1 && i < SEEX * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
             x += rng(-1, 1);
             while (abs(SEEX - x) > SEEX * 2 - j - 1) {
@@ -3211,21 +3215,21 @@ void Map::draw_map(oter_id terrain_type,
         // First, set it all to rock
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         for (int i = SEEX - 2; i <= SEEX + 3; i++) {
-            ter(i, 0) = t_rock_floor;
-            ter(i, 1) = t_rock_floor;
-            ter(i, 2) = t_rock_floor;
-            ter(SEEX * 2 - 1, i) = t_rock_floor;
-            ter(SEEX * 2 - 2, i) = t_rock_floor;
-            ter(SEEX * 2 - 3, i) = t_rock_floor;
+            set_ter(i, 0, t_rock_floor);
+            set_ter(i, 1, t_rock_floor);
+            set_ter(i, 2, t_rock_floor);
+            set_ter(SEEX * 2 - 1, i, t_rock_floor);
+            set_ter(SEEX * 2 - 2, i, t_rock_floor);
+            set_ter(SEEX * 2 - 3, i, t_rock_floor);
         }
         do {
             for (int i = x - 2; i <= x + 3; i++) {
                 for (int j = y - 2; j <= y + 3; j++) {
                     if (i > 0 && i < SEEX * 2 - 1 && j > 0 && j < SEEY * 2 - 1)
-                        ter(i, j) = t_rock_floor;
+                        set_ter(i, j, t_rock_floor);
                 }
             }
             if (!one_in(3))
@@ -3243,7 +3247,7 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = x - 2; i <= x + 3; i++) {
             for (int j = y - 2; j <= y + 3; j++) {
                 if (i > 0 && i < SEEX * 2 - 1 && j > 0 && j < SEEY * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (terrain_type == ot_ants_es)
@@ -3260,13 +3264,13 @@ void Map::draw_map(oter_id terrain_type,
     case ot_ants_esw:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         x = SEEX;
         for (int j = 0; j < SEEY * 2; j++) {
             for (int i = x - 2; i <= x + 3; i++) {
                 if (i >= 1 && i < SEEX * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
             x += rng(-1, 1);
             while (abs(SEEX - x) > SEEY * 2 - j - 1) {
@@ -3280,7 +3284,7 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = SEEX; i < SEEX * 2; i++) {
             for (int j = y - 2; j <= y + 3; j++) {
                 if (j >= 1 && j < SEEY * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
             y += rng(-1, 1);
             while (abs(SEEY - y) > SEEX * 2 - 1 - i) {
@@ -3301,13 +3305,13 @@ void Map::draw_map(oter_id terrain_type,
     case ot_ants_nesw:
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_rock;
+                set_ter(i, j, t_rock);
         }
         x = SEEX;
         for (int j = 0; j < SEEY * 2; j++) {
             for (int i = x - 2; i <= x + 3; i++) {
                 if (i >= 1 && i < SEEX * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
             x += rng(-1, 1);
             while (abs(SEEX - x) > SEEY * 2 - j - 1) {
@@ -3322,7 +3326,7 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = y - 2; j <= y + 3; j++) {
                 if (j >= 1 && j < SEEY * 2 - 1)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
             y += rng(-1, 1);
             while (abs(SEEY - y) > SEEX * 2 - i - 1) {
@@ -3340,9 +3344,9 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (i < SEEX - 4 || i > SEEX + 5 || j < SEEY - 4 || j > SEEY + 5)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         rn = rng(10, 20);
@@ -3355,32 +3359,32 @@ void Map::draw_map(oter_id terrain_type,
             for (int i = x - cw; i <= x + cw; i++) {
                 for (int j = y - cw; j <= y + cw; j++) {
                     if (trig_dist(x, y, i, j) <= cw)
-                        ter(i, j) = t_rock_floor;
+                        set_ter(i, j, t_rock_floor);
                 }
             }
         }
         if (connects_to(t_north, 2)) {
             for (int i = SEEX - 2; i <= SEEX + 3; i++) {
                 for (int j = 0; j <= SEEY; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_east, 3)) {
             for (int i = SEEX; i <= SEEX * 2 - 1; i++) {
                 for (int j = SEEY - 2; j <= SEEY + 3; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_south, 0)) {
             for (int i = SEEX - 2; i <= SEEX + 3; i++) {
                 for (int j = SEEY; j <= SEEY * 2 - 1; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_west, 1)) {
             for (int i = 0; i <= SEEX; i++) {
                 for (int j = SEEY - 2; j <= SEEY + 3; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (terrain_type == ot_ants_food)
@@ -3397,30 +3401,30 @@ void Map::draw_map(oter_id terrain_type,
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++) {
                 if (j == 0 || j == SEEY * 2 - 1)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (i == 0 || i == SEEX * 2 - 1)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (j == SEEY) {
                     if (i % 4 == 2)
-                        ter(i, j) = t_door_c;
+                        set_ter(i, j, t_door_c);
                     else if (i % 5 == 3)
-                        ter(i, j) = t_window;
+                        set_ter(i, j, t_window);
                     else
-                        ter(i, j) = t_wall_h;
+                        set_ter(i, j, t_wall_h);
                 } else
-                    ter(i, j) = t_floor;
+                    set_ter(i, j, t_floor);
             }
         }
-        ter(7, SEEY * 2 - 4) = t_rack;
-        ter(SEEX * 2 - 2, SEEY * 2 - 4) = t_gas_pump;
+        set_ter(7, SEEY * 2 - 4, t_rack);
+        set_ter(SEEX * 2 - 2, SEEY * 2 - 4, t_gas_pump);
         if (t_above != ot_null) {
-            ter(SEEX - 2, SEEY + 2) = t_stairs_up;
-            ter(2, 2) = t_water_sh;
-            ter(2, 3) = t_water_sh;
-            ter(3, 2) = t_water_sh;
-            ter(3, 3) = t_water_sh;
+            set_ter(SEEX - 2, SEEY + 2, t_stairs_up);
+            set_ter(2, 2, t_water_sh);
+            set_ter(2, 3, t_water_sh);
+            set_ter(3, 2, t_water_sh);
+            set_ter(3, 3, t_water_sh);
         } else
-            ter(SEEX - 2, SEEY + 2) = t_stairs_down;
+            set_ter(SEEX - 2, SEEY + 2, t_stairs_down);
         break;
 
     case ot_cavern:
@@ -3437,9 +3441,9 @@ void Map::draw_map(oter_id terrain_type,
             for (int j = 0; j < SEEY * 2; j++) {
                 if ((j < n_fac || j > s_fac || i < w_fac || i > e_fac)
                     && (!one_in(3) || j == 0 || j == SEEY * 2 - 1 || i == 0 || i == SEEX * 2 - 1))
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
                 else
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
 
@@ -3449,32 +3453,32 @@ void Map::draw_map(oter_id terrain_type,
             int py = rng(5, SEEY * 2 - 6);
             for (int i = px - 1; i <= px + 1; i++) {
                 for (int j = py - 1; j <= py + 1; j++)
-                    ter(i, j) = t_rock;
+                    set_ter(i, j, t_rock);
             }
         }
 
         if (connects_to(t_north, 2)) {
             for (int i = SEEX - 2; i <= SEEX + 3; i++) {
                 for (int j = 0; j <= SEEY; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_east, 3)) {
             for (int i = SEEX; i <= SEEX * 2 - 1; i++) {
                 for (int j = SEEY - 2; j <= SEEY + 3; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_south, 0)) {
             for (int i = SEEX - 2; i <= SEEX + 3; i++) {
                 for (int j = SEEY; j <= SEEY * 2 - 1; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         if (connects_to(t_west, 1)) {
             for (int i = 0; i <= SEEX; i++) {
                 for (int j = SEEY - 2; j <= SEEY + 3; j++)
-                    ter(i, j) = t_rock_floor;
+                    set_ter(i, j, t_rock_floor);
             }
         }
         place_items(mi_cavern, 60, 0, 0, SEEX * 2 - 1, SEEY * 2 - 1, false, 0);
@@ -3500,7 +3504,7 @@ void Map::draw_map(oter_id terrain_type,
                  oterlist[terrain_type].name.c_str());
         for (int i = 0; i < SEEX * 2; i++) {
             for (int j = 0; j < SEEY * 2; j++)
-                ter(i, j) = t_floor;
+                set_ter(i, j, t_floor);
         }
         break;
     }
@@ -3512,96 +3516,96 @@ void Map::draw_map(oter_id terrain_type,
             if (connects_to(t_north, 2)) {
                 for (int i = SEEX - 2; i < SEEX + 2; i++) {
                     for (int j = 0; j < SEEY; j++)
-                        ter(i, j) = t_sewage;
+                        set_ter(i, j, t_sewage);
                 }
             } else {
                 for (int j = 0; j < 3; j++) {
-                    ter(SEEX, j) = t_rock_floor;
-                    ter(SEEX - 1, j) = t_rock_floor;
+                    set_ter(SEEX, j, t_rock_floor);
+                    set_ter(SEEX - 1, j, t_rock_floor);
                 }
-                ter(SEEX, 3) = t_door_metal_c;
-                ter(SEEX - 1, 3) = t_door_metal_c;
+                set_ter(SEEX, 3, t_door_metal_c);
+                set_ter(SEEX - 1, 3, t_door_metal_c);
             }
         }
         if (t_east >= ot_sewer_ns && t_east <= ot_sewer_nesw && !connects_to(terrain_type, 1)) {
             if (connects_to(t_east, 3)) {
                 for (int i = SEEX; i < SEEX * 2; i++) {
                     for (int j = SEEY - 2; j < SEEY + 2; j++)
-                        ter(i, j) = t_sewage;
+                        set_ter(i, j, t_sewage);
                 }
             } else {
                 for (int i = SEEX * 2 - 3; i < SEEX * 2; i++) {
-                    ter(i, SEEY) = t_rock_floor;
-                    ter(i, SEEY - 1) = t_rock_floor;
+                    set_ter(i, SEEY, t_rock_floor);
+                    set_ter(i, SEEY - 1, t_rock_floor);
                 }
-                ter(SEEX * 2 - 4, SEEY) = t_door_metal_c;
-                ter(SEEX * 2 - 4, SEEY - 1) = t_door_metal_c;
+                set_ter(SEEX * 2 - 4, SEEY, t_door_metal_c);
+                set_ter(SEEX * 2 - 4, SEEY - 1, t_door_metal_c);
             }
         }
         if (t_south >= ot_sewer_ns && t_south <= ot_sewer_nesw && !connects_to(terrain_type, 2)) {
             if (connects_to(t_south, 0)) {
                 for (int i = SEEX - 2; i < SEEX + 2; i++) {
                     for (int j = SEEY; j < SEEY * 2; j++)
-                        ter(i, j) = t_sewage;
+                        set_ter(i, j, t_sewage);
                 }
             } else {
                 for (int j = SEEY * 2 - 3; j < SEEY * 2; j++) {
-                    ter(SEEX, j) = t_rock_floor;
-                    ter(SEEX - 1, j) = t_rock_floor;
+                    set_ter(SEEX, j, t_rock_floor);
+                    set_ter(SEEX - 1, j, t_rock_floor);
                 }
-                ter(SEEX, SEEY * 2 - 4) = t_door_metal_c;
-                ter(SEEX - 1, SEEY * 2 - 4) = t_door_metal_c;
+                set_ter(SEEX, SEEY * 2 - 4, t_door_metal_c);
+                set_ter(SEEX - 1, SEEY * 2 - 4, t_door_metal_c);
             }
         }
         if (t_west >= ot_sewer_ns && t_west <= ot_sewer_nesw && !connects_to(terrain_type, 3)) {
             if (connects_to(t_west, 1)) {
                 for (int i = 0; i < SEEX; i++) {
                     for (int j = SEEY - 2; j < SEEY + 2; j++)
-                        ter(i, j) = t_sewage;
+                        set_ter(i, j, t_sewage);
                 }
             } else {
                 for (int i = 0; i < 3; i++) {
-                    ter(i, SEEY) = t_rock_floor;
-                    ter(i, SEEY - 1) = t_rock_floor;
+                    set_ter(i, SEEY, t_rock_floor);
+                    set_ter(i, SEEY - 1, t_rock_floor);
                 }
-                ter(3, SEEY) = t_door_metal_c;
-                ter(3, SEEY - 1) = t_door_metal_c;
+                set_ter(3, SEEY, t_door_metal_c);
+                set_ter(3, SEEY - 1, t_door_metal_c);
             }
         }
     } else if (terrain_type >= ot_sewer_ns && terrain_type <= ot_sewer_nesw) {
         if (t_above == ot_road_nesw_manhole)
-            ter(rng(SEEX - 2, SEEX + 1), rng(SEEY - 2, SEEY + 1)) = t_ladder;
+            set_ter(rng(SEEX - 2, SEEX + 1), rng(SEEY - 2, SEEY + 1), t_ladder);
         if (t_north >= ot_subway_ns && t_north <= ot_subway_nesw && !connects_to(terrain_type, 0)) {
             for (int j = 0; j < SEEY - 3; j++) {
-                ter(SEEX, j) = t_rock_floor;
-                ter(SEEX - 1, j) = t_rock_floor;
+                set_ter(SEEX, j, t_rock_floor);
+                set_ter(SEEX - 1, j, t_rock_floor);
             }
-            ter(SEEX, SEEY - 3) = t_door_metal_c;
-            ter(SEEX - 1, SEEY - 3) = t_door_metal_c;
+            set_ter(SEEX, SEEY - 3, t_door_metal_c);
+            set_ter(SEEX - 1, SEEY - 3, t_door_metal_c);
         }
         if (t_east >= ot_subway_ns && t_east <= ot_subway_nesw && !connects_to(terrain_type, 1)) {
             for (int i = SEEX + 3; i < SEEX * 2; i++) {
-                ter(i, SEEY) = t_rock_floor;
-                ter(i, SEEY - 1) = t_rock_floor;
+                set_ter(i, SEEY, t_rock_floor);
+                set_ter(i, SEEY - 1, t_rock_floor);
             }
-            ter(SEEX + 2, SEEY) = t_door_metal_c;
-            ter(SEEX + 2, SEEY - 1) = t_door_metal_c;
+            set_ter(SEEX + 2, SEEY, t_door_metal_c);
+            set_ter(SEEX + 2, SEEY - 1, t_door_metal_c);
         }
         if (t_south >= ot_subway_ns && t_south <= ot_subway_nesw && !connects_to(terrain_type, 2)) {
             for (int j = SEEY + 3; j < SEEY * 2; j++) {
-                ter(SEEX, j) = t_rock_floor;
-                ter(SEEX - 1, j) = t_rock_floor;
+                set_ter(SEEX, j, t_rock_floor);
+                set_ter(SEEX - 1, j, t_rock_floor);
             }
-            ter(SEEX, SEEY + 2) = t_door_metal_c;
-            ter(SEEX - 1, SEEY + 2) = t_door_metal_c;
+            set_ter(SEEX, SEEY + 2, t_door_metal_c);
+            set_ter(SEEX - 1, SEEY + 2, t_door_metal_c);
         }
         if (t_west >= ot_subway_ns && t_west <= ot_subway_nesw && !connects_to(terrain_type, 3)) {
             for (int i = 0; i < SEEX - 3; i++) {
-                ter(i, SEEY) = t_rock_floor;
-                ter(i, SEEY - 1) = t_rock_floor;
+                set_ter(i, SEEY, t_rock_floor);
+                set_ter(i, SEEY - 1, t_rock_floor);
             }
-            ter(SEEX - 3, SEEY) = t_door_metal_c;
-            ter(SEEX - 3, SEEY - 1) = t_door_metal_c;
+            set_ter(SEEX - 3, SEEY, t_door_metal_c);
+            set_ter(SEEX - 3, SEEY - 1, t_door_metal_c);
         }
     } else if (terrain_type >= ot_ants_ns && terrain_type <= ot_ants_queen) {
         if (t_above == ot_anthill) {
@@ -3610,7 +3614,7 @@ void Map::draw_map(oter_id terrain_type,
                 int x = rng(0, SEEX * 2 - 1), y = rng(0, SEEY * 2 - 1);
                 if (ter(x, y) == t_rock_floor) {
                     done = true;
-                    ter(x, y) = t_slope_up;
+                    set_ter(x, y, t_slope_up);
                 }
             } while (!done);
         }
@@ -3678,7 +3682,7 @@ void Map::add_spawn(mon_id type, int count, int x, int y)
     x -= SEEX * int(x / SEEX);
     y -= SEEY * int(y / SEEY);
     spawn_point tmp(type, count, x, y);
-    grid[nonant].spawns.push_back(tmp);
+    spawns[nonant].push_back(tmp);
 }
 
 void Map::make_all_items_owned()
@@ -3710,7 +3714,7 @@ void Map::rotate(int turns)
         }
         // Now, spawn points
         for (int i = 0; i < 5; i++) {
-            for (const auto& spawn : grid[i].spawns) {
+            for (const auto& spawn : spawns[i]) {
                 int n {-1};
 
                 if (i == 0)
@@ -3744,7 +3748,7 @@ void Map::rotate(int turns)
         }
         // Now, spawn points
         for (int i = 0; i < 5; i++) {
-            for (const auto& spawn : grid[i].spawns) {
+            for (const auto& spawn : spawns[i]) {
                 int n {-1};
 
                 if (i == 0)
@@ -3778,7 +3782,7 @@ void Map::rotate(int turns)
         }
         // Now, spawn points
         for (int i = 0; i < 5; i++) {
-            for (const auto& spawn : grid[i].spawns) {
+            for (const auto& spawn : spawns[i]) {
                 int n {-1};
 
                 if (i == 0)
@@ -3807,34 +3811,34 @@ void Map::rotate(int turns)
     // Set the spawn points
     for (int i = 0; i < 5; i++) {
         if (i != 2)
-            grid[i].spawns = sprot[i];
+            spawns[i] = sprot[i];
     }
     for (int i = 0; i < SEEX * 2; i++) {
         for (int j = 0; j < SEEY * 2; j++) {
-            ter(i, j) = rotated[i][j];
+            set_ter(i, j, rotated[i][j]);
             i_at(i, j) = itrot[i][j];
             tr_at(i, j) = traprot[i][j];
             if (turns % 2 == 1) { // Rotate things like walls 90 degrees
                 if (ter(i, j) == t_wall_v)
-                    ter(i, j) = t_wall_h;
+                    set_ter(i, j, t_wall_h);
                 else if (ter(i, j) == t_wall_h)
-                    ter(i, j) = t_wall_v;
+                    set_ter(i, j, t_wall_v);
                 else if (ter(i, j) == t_railing_v)
-                    ter(i, j) = t_railing_h;
+                    set_ter(i, j, t_railing_h);
                 else if (ter(i, j) == t_railing_h)
-                    ter(i, j) = t_railing_v;
+                    set_ter(i, j, t_railing_v);
                 else if (ter(i, j) == t_wall_glass_h)
-                    ter(i, j) = t_wall_glass_v;
+                    set_ter(i, j, t_wall_glass_v);
                 else if (ter(i, j) == t_wall_glass_v)
-                    ter(i, j) = t_wall_glass_h;
+                    set_ter(i, j, t_wall_glass_h);
                 else if (ter(i, j) == t_reinforced_glass_h)
-                    ter(i, j) = t_reinforced_glass_v;
+                    set_ter(i, j, t_reinforced_glass_v);
                 else if (ter(i, j) == t_reinforced_glass_v)
-                    ter(i, j) = t_reinforced_glass_h;
+                    set_ter(i, j, t_reinforced_glass_h);
                 else if (ter(i, j) == t_fence_v)
-                    ter(i, j) = t_fence_h;
+                    set_ter(i, j, t_fence_h);
                 else if (ter(i, j) == t_fence_h)
-                    ter(i, j) = t_fence_v;
+                    set_ter(i, j, t_fence_v);
             }
         }
     }
@@ -3896,19 +3900,19 @@ void house_room(Map* m, room_type type, int x1, int y1, int x2, int y2)
         for (int j = y1; j <= y2; j++) {
             if (m->ter(i, j) == t_grass || m->ter(i, j) == t_dirt || m->ter(i, j) == t_floor) {
                 if (j == y1 || j == y2) {
-                    m->ter(i, j) = t_wall_h;
-                    m->ter(i, j) = t_wall_h;
+                    m->set_ter(i, j, t_wall_h);
+                    m->set_ter(i, j, t_wall_h);
                 } else if (i == x1 || i == x2) {
-                    m->ter(i, j) = t_wall_v;
-                    m->ter(i, j) = t_wall_v;
+                    m->set_ter(i, j, t_wall_v);
+                    m->set_ter(i, j, t_wall_v);
                 } else
-                    m->ter(i, j) = t_floor;
+                    m->set_ter(i, j, t_floor);
             }
         }
     }
     for (int i = y1 + 1; i <= y2 - 1; i++) {
-        m->ter(x1, i) = t_wall_v;
-        m->ter(x2, i) = t_wall_v;
+        m->set_ter(x1, i, t_wall_v);
+        m->set_ter(x2, i, t_wall_v);
     }
 
     items_location placed = mi_none;
@@ -3925,19 +3929,19 @@ void house_room(Map* m, room_type type, int x1, int y1, int x2, int y2)
         m->place_items(mi_cleaning, 58, x1 + 1, y1 + 1, x2 - 1, y2 - 2, false, 0);
         switch (rng(1, 4)) {
         case 1:
-            m->ter(x1 + 1, y1 + 1) = t_fridge;
+            m->set_ter(x1 + 1, y1 + 1, t_fridge);
             m->place_items(mi_fridge, 82, x1 + 1, y1 + 1, x1 + 1, y1 + 1, false, 0);
             break;
         case 2:
-            m->ter(x2 - 1, y1 + 1) = t_fridge;
+            m->set_ter(x2 - 1, y1 + 1, t_fridge);
             m->place_items(mi_fridge, 82, x2 - 1, y1 + 1, x2 - 1, y1 + 1, false, 0);
             break;
         case 3:
-            m->ter(x1 + 1, y2 - 1) = t_fridge;
+            m->set_ter(x1 + 1, y2 - 1, t_fridge);
             m->place_items(mi_fridge, 82, x1 + 1, y2 - 1, x1 + 1, y2 - 1, false, 0);
             break;
         case 4:
-            m->ter(x2 - 1, y2 - 1) = t_fridge;
+            m->set_ter(x2 - 1, y2 - 1, t_fridge);
             m->place_items(mi_fridge, 82, x2 - 1, y2 - 1, x2 - 1, y2 - 1, false, 0);
             break;
         }
@@ -3949,51 +3953,51 @@ void house_room(Map* m, room_type type, int x1, int y1, int x2, int y2)
             m->place_items(mi_homeguns, 78, x1 + 1, y1 + 1, x2 - 1, y2 - 1, false, 0);
         switch (rng(1, 5)) {
         case 1:
-            m->ter(x1 + 1, y1 + 1) = t_bed;
-            m->ter(x1 + 1, y1 + 2) = t_bed;
+            m->set_ter(x1 + 1, y1 + 1, t_bed);
+            m->set_ter(x1 + 1, y1 + 2, t_bed);
             break;
         case 2:
-            m->ter(x1 + 1, y2 - 1) = t_bed;
-            m->ter(x1 + 2, y2 - 1) = t_bed;
+            m->set_ter(x1 + 1, y2 - 1, t_bed);
+            m->set_ter(x1 + 2, y2 - 1, t_bed);
             break;
         case 3:
-            m->ter(x2 - 1, y2 - 2) = t_bed;
-            m->ter(x2 - 1, y2 - 1) = t_bed;
+            m->set_ter(x2 - 1, y2 - 2, t_bed);
+            m->set_ter(x2 - 1, y2 - 1, t_bed);
             break;
         case 4:
-            m->ter(x2 - 2, y1 + 1) = t_bed;
-            m->ter(x2 - 1, y1 + 1) = t_bed;
+            m->set_ter(x2 - 2, y1 + 1, t_bed);
+            m->set_ter(x2 - 1, y1 + 1, t_bed);
             break;
         case 5:
-            m->ter(int((x1 + x2) / 2), y2 - 1) = t_bed;
-            m->ter(int((x1 + x2) / 2) + 1, y2 - 1) = t_bed;
-            m->ter(int((x1 + x2) / 2), y2 - 2) = t_bed;
-            m->ter(int((x1 + x2) / 2) + 1, y2 - 2) = t_bed;
+            m->set_ter(int((x1 + x2) / 2), y2 - 1, t_bed);
+            m->set_ter(int((x1 + x2) / 2) + 1, y2 - 1, t_bed);
+            m->set_ter(int((x1 + x2) / 2), y2 - 2, t_bed);
+            m->set_ter(int((x1 + x2) / 2) + 1, y2 - 2, t_bed);
             break;
         }
         switch (rng(1, 4)) {
         case 1:
-            m->ter(x1 + 2, y1 + 1) = t_dresser;
+            m->set_ter(x1 + 2, y1 + 1, t_dresser);
             m->place_items(mi_dresser, 80, x1 + 2, y1 + 1, x1 + 2, y1 + 1, false, 0);
             break;
         case 2:
-            m->ter(x2 - 1, y2 - 1) = t_dresser;
+            m->set_ter(x2 - 1, y2 - 1, t_dresser);
             m->place_items(mi_dresser, 80, x2 - 1, y2 - 1, x2 - 1, y2 - 1, false, 0);
             break;
         case 3:
             rn = int((x1 + x2) / 2);
-            m->ter(rn, y1 + 1) = t_dresser;
+            m->set_ter(rn, y1 + 1, t_dresser);
             m->place_items(mi_dresser, 80, rn, y1 + 1, rn, y1 + 1, false, 0);
             break;
         case 4:
             rn = int((y1 + y2) / 2);
-            m->ter(x1 + 1, rn) = t_dresser;
+            m->set_ter(x1 + 1, rn, t_dresser);
             m->place_items(mi_dresser, 80, x1 + 1, rn, x1 + 1, rn, false, 0);
             break;
         }
         break;
     case room_bathroom:
-        m->ter(x2 - 1, y2 - 1) = t_toilet;
+        m->set_ter(x2 - 1, y2 - 1, t_toilet);
         m->place_items(mi_harddrugs, 18, x1 + 1, y1 + 1, x2 - 1, y2 - 2, false, 0);
         m->place_items(mi_cleaning, 48, x1 + 1, y1 + 1, x2 - 1, y2 - 2, false, 0);
         placed = mi_softdrugs;
@@ -4018,7 +4022,7 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
     }
     for (int i = x1; i <= x2; i++) {
         for (int j = y1; j <= y2; j++)
-            m->ter(i, j) = t_floor;
+            m->set_ter(i, j, t_floor);
     }
     int area = height * width;
     std::vector<room_type> valid_rooms;
@@ -4055,14 +4059,14 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
         if (rotate % 2 == 0) { // Vertical
             int desk = y1 + rng(int(height / 2) - int(height / 4), int(height / 2) + 1);
             for (int x = x1 + int(width / 4); x < x2 - int(width / 4); x++)
-                m->ter(x, desk) = t_counter;
-            m->ter(x2 - int(width / 4), desk) = t_computer_lab;
+                m->set_ter(x, desk, t_counter);
+            m->set_ter(x2 - int(width / 4), desk, t_computer_lab);
             m->add_spawn(mon_turret, 1, int((x1 + x2) / 2), desk);
         } else {
             int desk = x1 + rng(int(height / 2) - int(height / 4), int(height / 2) + 1);
             for (int y = y1 + int(width / 4); y < y2 - int(width / 4); y++)
-                m->ter(desk, y) = t_counter;
-            m->ter(desk, y2 - int(width / 4)) = t_computer_lab;
+                m->set_ter(desk, y, t_counter);
+            m->set_ter(desk, y2 - int(width / 4), t_computer_lab);
             m->add_spawn(mon_turret, 1, desk, int((y1 + y2) / 2));
         }
         break;
@@ -4071,7 +4075,7 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
             for (int x = x1; x <= x2; x++) {
                 if (x % 3 == 0) {
                     for (int y = y1 + 1; y <= y2 - 1; y++) {
-                        m->ter(x, y) = t_counter;
+                        m->set_ter(x, y, t_counter);
                     }
                     m->place_items(mi_chemistry, 70, x, y1 + 1, x, y2 - 1, false, 0);
                 }
@@ -4080,7 +4084,7 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
             for (int y = y1; y <= y2; y++) {
                 if (y % 3 == 0) {
                     for (int x = x1 + 1; x <= x2 - 1; x++) {
-                        m->ter(x, y) = t_counter;
+                        m->set_ter(x, y, t_counter);
                     }
                     m->place_items(mi_chemistry, 70, x1 + 1, y, x2 - 1, y, false, 0);
                 }
@@ -4088,10 +4092,10 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
         }
         break;
     case room_teleport:
-        m->ter(int((x1 + x2) / 2), int((y1 + y2) / 2)) = t_counter;
-        m->ter(int((x1 + x2) / 2) + 1, int((y1 + y2) / 2)) = t_counter;
-        m->ter(int((x1 + x2) / 2), int((y1 + y2) / 2) + 1) = t_counter;
-        m->ter(int((x1 + x2) / 2) + 1, int((y1 + y2) / 2) + 1) = t_counter;
+        m->set_ter(int((x1 + x2) / 2), int((y1 + y2) / 2), t_counter);
+        m->set_ter(int((x1 + x2) / 2) + 1, int((y1 + y2) / 2), t_counter);
+        m->set_ter(int((x1 + x2) / 2), int((y1 + y2) / 2) + 1, t_counter);
+        m->set_ter(int((x1 + x2) / 2) + 1, int((y1 + y2) / 2) + 1, t_counter);
         m->add_trap(trapx, trapy, tr_telepad);
         m->place_items(mi_teleport, 70, int((x1 + x2) / 2), int((y1 + y2) / 2),
                        int((x1 + x2) / 2) + 1, int((y1 + y2) / 2) + 1, false, 0);
@@ -4104,19 +4108,19 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
         } while (!one_in(5));
         if (rotate == 0) {
             m->tr_at(x1, y2) = tr_null;
-            m->ter(x1, y2) = t_fridge;
+            m->set_ter(x1, y2, t_fridge);
             m->place_items(mi_goo, 60, x1, y2, x1, y2, false, 0);
         } else if (rotate == 1) {
             m->tr_at(x1, y1) = tr_null;
-            m->ter(x1, y1) = t_fridge;
+            m->set_ter(x1, y1, t_fridge);
             m->place_items(mi_goo, 60, x1, y1, x1, y1, false, 0);
         } else if (rotate == 2) {
             m->tr_at(x2, y1) = tr_null;
-            m->ter(x2, y1) = t_fridge;
+            m->set_ter(x2, y1, t_fridge);
             m->place_items(mi_goo, 60, x2, y1, x2, y1, false, 0);
         } else {
             m->tr_at(x2, y2) = tr_null;
-            m->ter(x2, y2) = t_fridge;
+            m->set_ter(x2, y2, t_fridge);
             m->place_items(mi_goo, 60, x2, y2, x2, y2, false, 0);
         }
         break;
@@ -4124,7 +4128,7 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
         for (int x = x1 + 1; x <= x2 - 1; x++) {
             for (int y = y1 + 1; y <= y2 - 1; y++) {
                 if (x % 3 == 0 && y % 3 == 0) {
-                    m->ter(x, y) = t_vat;
+                    m->set_ter(x, y, t_vat);
                     m->place_items(mi_cloning_vat, 20, x, y, x, y, false, 0);
                 }
             }
@@ -4133,19 +4137,19 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
     case room_vivisect:
         if (rotate == 0) {
             for (int x = x1; x <= x2; x++)
-                m->ter(x, y2 - 1) = t_counter;
+                m->set_ter(x, y2 - 1, t_counter);
             m->place_items(mi_dissection, 80, x1, y2 - 1, x2, y2 - 1, false, 0);
         } else if (rotate == 1) {
             for (int y = y1; y <= y2; y++)
-                m->ter(x1 + 1, y) = t_counter;
+                m->set_ter(x1 + 1, y, t_counter);
             m->place_items(mi_dissection, 80, x1 + 1, y1, x1 + 1, y2, false, 0);
         } else if (rotate == 2) {
             for (int x = x1; x <= x2; x++)
-                m->ter(x, y1 + 1) = t_counter;
+                m->set_ter(x, y1 + 1, t_counter);
             m->place_items(mi_dissection, 80, x1, y1 + 1, x2, y1 + 1, false, 0);
         } else if (rotate == 3) {
             for (int y = y1; y <= y2; y++)
-                m->ter(x2 - 1, y) = t_counter;
+                m->set_ter(x2 - 1, y, t_counter);
             m->place_items(mi_dissection, 80, x2 - 1, y1, x2 - 1, y2, false, 0);
         }
         m->add_trap(int((x1 + x2) / 2), int((y1 + y2) / 2), tr_dissector);
@@ -4153,23 +4157,23 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
     case room_dorm:
         if (rotate % 2 == 0) {
             for (int y = y1 + 1; y <= y2 - 1; y += 3) {
-                m->ter(x1, y) = t_bed;
-                m->ter(x1 + 1, y) = t_bed;
-                m->ter(x2, y) = t_bed;
-                m->ter(x2 - 1, y) = t_bed;
-                m->ter(x1, y + 1) = t_dresser;
-                m->ter(x2, y + 1) = t_dresser;
+                m->set_ter(x1, y, t_bed);
+                m->set_ter(x1 + 1, y, t_bed);
+                m->set_ter(x2, y, t_bed);
+                m->set_ter(x2 - 1, y, t_bed);
+                m->set_ter(x1, y + 1, t_dresser);
+                m->set_ter(x2, y + 1, t_dresser);
                 m->place_items(mi_dresser, 70, x1, y + 1, x1, y + 1, false, 0);
                 m->place_items(mi_dresser, 70, x2, y + 1, x2, y + 1, false, 0);
             }
         } else if (rotate % 2 == 1) {
             for (int x = x1 + 1; x <= x2 - 1; x += 3) {
-                m->ter(x, y1) = t_bed;
-                m->ter(x, y1 + 1) = t_bed;
-                m->ter(x, y2) = t_bed;
-                m->ter(x, y2 - 1) = t_bed;
-                m->ter(x + 1, y1) = t_dresser;
-                m->ter(x + 1, y2) = t_dresser;
+                m->set_ter(x, y1, t_bed);
+                m->set_ter(x, y1 + 1, t_bed);
+                m->set_ter(x, y2, t_bed);
+                m->set_ter(x, y2 - 1, t_bed);
+                m->set_ter(x + 1, y1, t_dresser);
+                m->set_ter(x + 1, y2, t_dresser);
                 m->place_items(mi_dresser, 70, x + 1, y1, x + 1, y1, false, 0);
                 m->place_items(mi_dresser, 70, x + 1, y2, x + 1, y2, false, 0);
             }
@@ -4180,21 +4184,21 @@ void science_room(Map* m, int x1, int y1, int x2, int y2, int rotate)
         if (rotate % 2 == 0) {
             int w1 = int((x1 + x2) / 2) - 2, w2 = int((x1 + x2) / 2) + 2;
             for (int y = y1; y <= y2; y++) {
-                m->ter(w1, y) = t_wall_v;
-                m->ter(w2, y) = t_wall_v;
+                m->set_ter(w1, y, t_wall_v);
+                m->set_ter(w2, y, t_wall_v);
             }
-            m->ter(w1, int((y1 + y2) / 2)) = t_door_metal_c;
-            m->ter(w2, int((y1 + y2) / 2)) = t_door_metal_c;
+            m->set_ter(w1, int((y1 + y2) / 2), t_door_metal_c);
+            m->set_ter(w2, int((y1 + y2) / 2), t_door_metal_c);
             science_room(m, x1, y1, w1 - 1, y2, 1);
             science_room(m, w2 + 1, y1, x2, y2, 3);
         } else {
             int w1 = int((y1 + y2) / 2) - 2, w2 = int((y1 + y2) / 2) + 2;
             for (int x = x1; x <= x2; x++) {
-                m->ter(x, w1) = t_wall_h;
-                m->ter(x, w2) = t_wall_h;
+                m->set_ter(x, w1, t_wall_h);
+                m->set_ter(x, w2, t_wall_h);
             }
-            m->ter(int((x1 + x2) / 2), w1) = t_door_metal_c;
-            m->ter(int((x1 + x2) / 2), w2) = t_door_metal_c;
+            m->set_ter(int((x1 + x2) / 2), w1, t_door_metal_c);
+            m->set_ter(int((x1 + x2) / 2), w2, t_door_metal_c);
             science_room(m, x1, y1, x2, w1 - 1, 2);
             science_room(m, x1, w2 + 1, x2, y2, 0);
         }
@@ -4223,7 +4227,7 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn)
         for (int i = x1; i <= x2; i++) {
             for (int j = y1; j <= y2; j++) {
                 if ((i == x1 || j == y1 || j == y2) && i != x1)
-                    m->ter(i, j) = t_counter;
+                    m->set_ter(i, j, t_counter);
             }
         }
         m->place_items(mi_chemistry, 85, x1 + 1, y1, x2 - 1, y1, false, 0);
@@ -4240,9 +4244,9 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn)
         for (int i = x1; i <= x2; i++) {
             for (int j = y1; j <= y2; j++) {
                 if (i == x1)
-                    m->ter(i, j) = t_counter;
+                    m->set_ter(i, j, t_counter);
                 else if ((i > x1 + 1 && i < x2 && j == y1 + 1) || j == y2 - 1) {
-                    m->ter(i, j) = ter_id::t_water_sh;
+                    m->set_ter(i, j, ter_id::t_water_sh);
                 }
             }
         }
@@ -4260,7 +4264,7 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn)
         for (int i = x1; i <= x2; i++) {
             for (int j = y1; j <= y2; j++) {
                 if ((i == x1 || j == y1 || j == y2) && i != x1)
-                    m->ter(i, j) = t_counter;
+                    m->set_ter(i, j, t_counter);
             }
         }
         m->place_items(mi_electronics, 85, x1 + 1, y1, x2 - 1, y1, false, turn - 50);
@@ -4277,11 +4281,11 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn)
         for (int i = x1; i <= x2; i++) {
             for (int j = y1; j <= y2; j++) {
                 if (i == x1 + 1)
-                    m->ter(i, j) = t_wall_glass_v;
+                    m->set_ter(i, j, t_wall_glass_v);
                 else if (i == x1 && (j == y1 + 1 || j == y2 - 1))
-                    m->ter(i, j) = t_wall_glass_h;
+                    m->set_ter(i, j, t_wall_glass_h);
                 else if ((j == y1 || j == y2) && i >= x1 + 3 && i <= x2 - 1)
-                    m->ter(i, j) = t_counter;
+                    m->set_ter(i, j, t_counter);
             }
         }
         // TODO: Place a monster in the sealed areas.
@@ -4301,7 +4305,7 @@ void set_science_room(Map* m, int x1, int y1, bool faces_right, int turn)
         }
         for (int i = x1; i <= x2; i++) {
             for (int j = y1; j <= y2; j++) {
-                m->ter(i, j) = rotated[x2 - (i - x1)][j];
+                m->set_ter(i, j, rotated[x2 - (i - x1)][j]);
                 m->i_at(i, j) = itrot[x2 - (i - x1)][j];
             }
         }
@@ -31,6 +31,10 @@ namespace oocdda {
 #    define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
 
+// Candidates for a target are looked at nearest first; once this many of one
+// kind have been out of sight, the ones further off are given up on.
+static const int sight_checks = 4;
+
 bool Monster::wander()
 {
     if (plans.empty())
@@ -50,15 +54,60 @@ bool Monster::can_move_to(Map& m, int x, int y)
     return true;
 }
 
+// Can we get onto (x, y), one way or another?
+static bool can_step(Monster& z, Map& m, int x, int y)
+{
+    return z.can_move_to(m, x, y) || (m.has_flag(bashable, x, y) && z.has_flag(MF_BASHES));
+}
+
 // Resets plans (list of squares to visit) and builds it as a straight line
 // to the destination (x,y). t is used to choose which eligable line to use.
 // Currently, this assumes we can see (x,y), so shouldn't be used in any other
 // circumstance (or else the monster will "phase" through solid terrain!)
-void Monster::set_dest(int x, int y, int& t)
+// Seeing isn't walking, though: if the line crosses a window or a fence, we
+// take a route around it rather than walk into it over and over.
+void Monster::set_dest(Game* g, int x, int y, int& t)
 {
     plans.clear();
     // TODO: This causes a segfault, once in a blue moon!  Whyyyyy.
     plans = line_to(posx, posy, x, y, t);
+    for (const auto& step : plans) {
+        if (!can_step(*this, g->m, step.x, step.y) && (step.x != x || step.y != y)) {
+            std::vector<Point> straight = plans;
+            if (!route_to(g, x, y))
+                plans = straight; // No way around in reach; better than nothing
+            return;
+        }
+    }
+}
+
+// The whole way, so if we lose sight of the player we still carry on to where
+// they were, as with set_dest.  Each step is one lookup in the field.  Plans
+// that still start with the field's step are kept, so a monster chasing the
+// player doesn't walk the field to them every turn.
+bool Monster::follow_flow(Game* g)
+{
+    if (has_flag(MF_DIGS) || has_flag(MF_AQUATIC) || !g->u_flow.reachable(posx, posy))
+        return false;
+    Point here(posx, posy), next = g->u_flow.next_step(posx, posy);
+    if (!plans.empty() && plans[0] == next && next != here)
+        return true;
+    plans.clear();
+    while (next != here) {
+        plans.push_back(next);
+        here = next;
+        next = g->u_flow.next_step(here.x, here.y);
+    }
+    return !plans.empty();
+}
+
+bool Monster::route_to(Game* g, int x, int y)
+{
+    // The map only knows about walking, opening doors and bashing; leave the
+    // diggers and the fish to their own devices.
+    if (has_flag(MF_DIGS) || has_flag(MF_AQUATIC))
+        return false;
+    return g->m.route(posx, posy, x, y, plans, false, has_flag(MF_BASHES), 200);
 }
 
 // Move towards (x,y) for f more turns--generally if we hear a sound there
@@ -78,25 +127,27 @@ void Monster::plan(Game* g)
     int closest = -1;
     int dist = 1000;
     int tc, stc;
+    int looks = 0; // Lines of sight tried so far; see sight_checks
     if (friendly != 0) { // Target monsters, not the player!
-        for (std::size_t i {0}; i < g->z.size(); ++i) {
+        g->mon_grid.nearest(posx, posy, sightrange, [&](int i) {
             const Monster* monster {&g->z[i]};
-
-            if (monster->friendly == 0 && rl_dist(posx, posy, monster->posx, monster->posy) < dist
-                && g->m.sees(posx, posy, monster->posx, monster->posy, sightrange, tc)) {
-                closest = static_cast<int>(i);
-                dist = rl_dist(posx, posy, monster->posx, monster->posy);
+            if (monster->friendly != 0)
+                return false;
+            if (g->m.sees(posx, posy, monster->posx, monster->posy, sightrange, tc)) {
+                closest = i;
                 stc = tc;
+                return true;
             }
-        }
+            return ++looks >= sight_checks;
+        });
 
         if (closest >= 0)
-            set_dest(g->z[closest].posx, g->z[closest].posy, stc);
+            set_dest(g, g->z[closest].posx, g->z[closest].posy, stc);
         else if (friendly > 0 && one_in(3)) // Grow restless with no targets
             friendly--;
         else if (friendly < 0 && g->sees_u(posx, posy, tc)) {
             if (rl_dist(posx, posy, g->u.posx, g->u.posy) > 2)
-                set_dest(g->u.posx, g->u.posy, tc);
+                set_dest(g, g->u.posx, g->u.posy, tc);
             else
                 plans.clear();
         }
@@ -116,34 +167,39 @@ void Monster::plan(Game* g)
             stc = tc;
         }
 
-        for (std::size_t i {0}; i < g->active_npc.size(); ++i) {
+        // Only someone nearer than the player will do; NPCs win ties with friendly monsters.
+        g->npc_grid.nearest(posx, posy, MIN(sightrange, dist - 1), [&](int i) {
             const npc* nearby_npc {&g->active_npc[i]};
-
-            if (rl_dist(posx, posy, nearby_npc->posx, nearby_npc->posy) < dist
-                && g->m.sees(posx, posy, nearby_npc->posx, nearby_npc->posy, sightrange, tc)) {
+            if (g->m.sees(posx, posy, nearby_npc->posx, nearby_npc->posy, sightrange, tc)) {
                 dist = rl_dist(posx, posy, nearby_npc->posx, nearby_npc->posy);
-                closest = static_cast<int>(i);
+                closest = i;
                 stc = tc;
+                return true;
             }
-        }
+            return ++looks >= sight_checks;
+        });
 
-        for (std::size_t i {0}; i < g->z.size(); ++i) {
+        looks = 0;
+        g->mon_grid.nearest(posx, posy, MIN(sightrange, dist - 1), [&](int i) {
             const Monster* monster {&g->z[i]};
-
-            if (monster->friendly != 0 && rl_dist(posx, posy, monster->posx, monster->posy) < dist
-                && g->m.sees(posx, posy, monster->posx, monster->posy, sightrange, tc)) {
+            if (monster->friendly == 0)
+                return false;
+            if (g->m.sees(posx, posy, monster->posx, monster->posy, sightrange, tc)) {
                 dist = rl_dist(posx, posy, monster->posx, monster->posy);
-                closest = -3 - static_cast<int>(i);
+                closest = -3 - i;
                 stc = tc;
+                return true;
             }
-        }
-
-        if (closest == -2)
-            set_dest(g->u.posx, g->u.posy, stc);
-        else if (closest <= -3)
-            set_dest(g->z[-3 - closest].posx, g->z[-3 - closest].posy, stc);
+            return ++looks >= sight_checks;
+        });
+
+        if (closest == -2) {
+            if (!follow_flow(g))
+                set_dest(g, g->u.posx, g->u.posy, stc);
+        } else if (closest <= -3)
+            set_dest(g, g->z[-3 - closest].posx, g->z[-3 - closest].posy, stc);
         else if (closest >= 0)
-            set_dest(g->active_npc[closest].posx, g->active_npc[closest].posy, stc);
+            set_dest(g, g->active_npc[closest].posx, g->active_npc[closest].posy, stc);
     }
 }
 
@@ -187,6 +243,14 @@ void Monster::move(Game* g)
     }
 
     moves -= 100;
+    // Something has come between us and where we're headed (a door shut, say);
+    // look for a way round once, rather than walk into it turn after turn.
+    if (plans.size() > 0 && !can_step(*this, g->m, plans[0].x, plans[0].y)
+        && (plans[0].x != g->u.posx || plans[0].y != g->u.posy)) {
+        const Point goal = plans.back();
+        if (!route_to(g, goal.x, goal.y))
+            plans.clear();
+    }
     bool moved {false};
     Point next;
     int mondex = (plans.size() > 0 ? g->mon_at(plans[0].x, plans[0].y) : -1);
@@ -201,10 +265,21 @@ void Monster::move(Game* g)
     } else if (has_flag(MF_SMELLS)) {
         // No sight... or our plans are invalid (e.g. moving through a transparent, but
         //  solid, square of terrain).  Fall back to smell if we have it.
-        Point tmp = scent_move(g);
-        if (tmp.x != -1) {
+        // Once on the trail, it leads the way u_flow does; take that step unless
+        //  someone's in it.
+        Point tmp = g->u_flow.next_step(posx, posy);
+        if (!is_fleeing(g->u) && g->scent(posx, posy) > 0 && (tmp.x != posx || tmp.y != posy)
+            && (g->mon_at(tmp.x, tmp.y) == -1 || has_flag(MF_ATTACKMON))
+            && can_step(*this, g->m, tmp.x, tmp.y)) {
+            plans.clear();
             next = tmp;
             moved = true;
+        } else {
+            tmp = scent_move(g);
+            if (tmp.x != -1) {
+                next = tmp;
+                moved = true;
+            }
         }
     }
     if (wandf > 0 && !moved) { // No LOS, no scent, so as a fall-back follow sound
@@ -400,6 +475,7 @@ Point Monster::sound_move(Game* g)
 
 void Monster::hit_player(Game* g, player& p)
 {
+    const RngScope scope {RngStream::combat};
     if (type->melee_dice == 0) // We don't attack, so just return
         return;
     bool is_npc = p.is_npc();
@@ -450,6 +526,7 @@ void Monster::hit_player(Game* g, player& p)
             tmp->die(g);
             int index = g->npc_at(p.posx, p.posy);
             g->active_npc.erase(g->active_npc.begin() + index);
+            g->npc_grid.invalidate();
             plans.clear();
         }
     }
@@ -466,8 +543,11 @@ void Monster::move_to(Game* g, int x, int y)
         if (!has_flag(MF_DIGS) && !has_flag(MF_FLIES)
             && (!has_flag(MF_SWIMS) || !g->m.has_flag(swimmable, x, y)))
             moves -= (g->m.move_cost(x, y) - 2) * 50;
+        const int oldx {posx};
+        const int oldy {posy};
         posx = x;
         posy = y;
+        g->mon_grid.moved(*this, oldx, oldy);
         if (g->m.tr_at(posx, posy) != tr_null) { // Monster stepped on a trap!
             trap* tr = g->traps[g->m.tr_at(posx, posy)];
             if (dice(3, sk_dodge + 1) < dice(3, tr->avoidance)) {
@@ -477,7 +557,7 @@ void Monster::move_to(Game* g, int x, int y)
         }
         // Diggers turn the dirt into dirtmound
         if (has_flag(MF_DIGS))
-            g->m.ter(posx, posy) = t_dirtmound;
+            g->m.set_ter(posx, posy, t_dirtmound);
     } else if (has_flag(MF_ATTACKMON) || g->z[mondex].friendly != 0)
         // If there IS a monster there, and we fight monsters, fight it!
         hit_monster(g, mondex);
@@ -504,8 +584,11 @@ void Monster::stumble(Game* g, bool moved)
     }
     if (valid_stumbles.size() > 0 && (one_in(8) || (!moved && one_in(3)))) {
         int choice = rng(0, valid_stumbles.size() - 1);
+        const int oldx {posx};
+        const int oldy {posy};
         posx = valid_stumbles[choice].x;
         posy = valid_stumbles[choice].y;
+        g->mon_grid.moved(*this, oldx, oldy);
         if (!has_flag(MF_DIGS) || !has_flag(MF_FLIES))
             moves -= (g->m.move_cost(posx, posy) - 2) * 50;
         // Here we have to fix our plans[] list, trying to get back to the last point
@@ -522,7 +605,7 @@ void Monster::stumble(Game* g, bool moved)
                 }
 
                 // Set plans to a route between where we are now, and where we were
-                set_dest(plans[0].x, plans[0].y, tc);
+                set_dest(g, plans[0].x, plans[0].y, tc);
 
                 // Append old plans to the new plans.
                 for (const auto index : plans2) {
@@ -11,6 +11,7 @@
 #include "color.hpp"
 #include "game.hpp"
 #include "itype.hpp"
+#include "keypress.hpp"
 #include "map.hpp"
 #include "mapdata.hpp"
 #include "mapitems.hpp"
@@ -28,7 +29,7 @@ Monster::Monster()
 {
     /*
      mvprintz(10, 30, c_red, "INVALID MONSTER!");
-     getch();
+     get_key();
     */
     posx = 20;
     posy = 10;
@@ -223,7 +224,7 @@ void Monster::debug(player& u)
         }
     }
 
-    getch();
+    get_key();
 }
 
 void Monster::shift(int sx, int sy)
@@ -316,6 +317,7 @@ int Monster::hit(player& p, body_part& bp_hit)
 
 void Monster::hit_monster(Game* g, int i)
 {
+    const RngScope scope {RngStream::combat};
     int junk;
     Monster* target = &(g->z[i]);
 
@@ -43,8 +43,11 @@ public:
     bool wander();                          // Returns true if we have no plans
     bool can_move_to(Map& m, int x, int y); // Can we move to (x, y)?
 
-    void set_dest(int x, int y, int& t); // Go in a straight line to (x, y)
-                                         // t determines WHICH Bresenham line
+    void set_dest(Game* g, int x, int y, int& t); // Go in a straight line to (x, y)
+                                                  // t determines WHICH Bresenham line
+                                                  // If it's blocked, go around instead
+    bool route_to(Game* g, int x, int y); // Plans a way around to (x, y); false if none
+    bool follow_flow(Game* g);            // Plans the way to the player from g->u_flow
     void wander_to(int x, int y, int f); // Try to get to (x, y), we don't know
                                          // the route.  Give up after f steps.
     void plan(Game* g);
@@ -267,12 +267,12 @@ void growplants(Game& g, Monster& z)
                                           body_part_name(hit, side).c_str());
                             g.active_npc[npcdex].hit(&g, hit, side, 0, rng(10, 30));
                         } else
-                            g.m.ter(z.posx + i, z.posy + j) = t_tree_young;
+                            g.m.set_ter(z.posx + i, z.posy + j, t_tree_young);
                     }
                 } else if (one_in(3))
-                    g.m.ter(z.posx + i, z.posy + j) = t_underbrush;
+                    g.m.set_ter(z.posx + i, z.posy + j, t_underbrush);
             } else if (one_in(3) && g.m.is_destructable(z.posx + i, z.posy + j))
-                g.m.ter(z.posx + i, z.posy + j) = t_dirtmound;
+                g.m.set_ter(z.posx + i, z.posy + j, t_dirtmound);
         }
     }
 
@@ -281,7 +281,7 @@ void growplants(Game& g, Monster& z)
             for (int j = -5; j <= 5; j++) {
                 if (i != 0 || j != 0) {
                     if (g.m.ter(z.posx + i, z.posy + j) == t_tree_young)
-                        g.m.ter(z.posx + i, z.posy + j) = t_tree;
+                        g.m.set_ter(z.posx + i, z.posy + j, t_tree);
                     else if (g.m.ter(z.posx + i, z.posy + j) == t_underbrush) {
                         int mondex = g.mon_at(z.posx + i, z.posy + j);
                         if (mondex != -1) {
@@ -454,7 +454,7 @@ void stare(Game& g, Monster& z)
             }
 
             if (g.m.is_destructable(point.x, point.y)) {
-                g.m.ter(point.x, point.y) = ter_id::t_rubble;
+                g.m.set_ter(point.x, point.y, ter_id::t_rubble);
             }
         }
     }
@@ -40,7 +40,7 @@ int random_good_trait(character_type type);
 int random_bad_trait(character_type type);
 int random_skill(character_type type);
 
-bool player::create(Game* g, character_type type)
+bool player::create(Game* g, character_type type, std::string tempname)
 {
     WINDOW* w = newwin(25, 80, 0, 0);
     int tab = 0, points = 36;
@@ -197,10 +197,15 @@ bool player::create(Game* g, character_type type)
             }
         }
         tab = 3;
+        // Given a name, there's nothing left to ask
+        if (!tempname.empty()) {
+            name = tempname;
+            tab = 4;
+        }
     } else
         points = 4;
 
-    do {
+    while (tab >= 0 && tab < 4) {
         werase(w);
         draw_tabs(w);
         wrefresh(w);
@@ -218,7 +223,7 @@ bool player::create(Game* g, character_type type)
             tab += set_description(w, this, points);
             break;
         }
-    } while (tab >= 0 && tab < 4);
+    }
     delwin(w);
 
     if (tab < 0)
@@ -0,0 +1,247 @@
+#ifndef OOCDDA_NOISE_MAP_HPP
+#define OOCDDA_NOISE_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <optional>
+#include <vector>
+
+#include "point.hpp"
+
+namespace oocdda {
+/**
+ * \brief Collects the noises made over a turn and works out, once, what can be heard where.
+ *
+ * Noises are queued with add() and spread over a width by height window by resolve() in a single
+ * pass for all of them, so each listener then costs one lookup however many noises there were.
+ * Every square keeps only the loudest noise reaching it. Distances are measured along the way the
+ * sound travels, a diagonal step counting as about 1.4 squares, and a damping function can make
+ * some squares, like walls, count as several.
+ *
+ * A noise carries for twice its volume in squares, for the keen of hearing; what it sounds like
+ * at that distance is up to the listener. Noises and listeners outside the window are reckoned by
+ * straight-line distance instead; resolve() sets the noises outside aside, so a listener inside
+ * only looks at those.
+ */
+class NoiseMap {
+public:
+    /// What a listener hears: the loudest noise, and how far it had to travel.
+    struct Heard {
+        Point source;
+        int volume;
+        int distance; ///< In squares, rounded down.
+    };
+
+    NoiseMap(const int width, const int height)
+        : width_ {width}
+        , height_ {height}
+        , loudness_(static_cast<std::size_t>(width * height), silent)
+        , source_(static_cast<std::size_t>(width * height), -1)
+    {
+    }
+
+    /// Queues a noise of \p volume at (\p x, \p y) for the next resolve().
+    void add(const int x, const int y, const int volume)
+    {
+        if (volume > 0) {
+            sources_.push_back({{x, y}, volume});
+        }
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return sources_.empty(); }
+
+    /**
+     * \brief Spreads the queued noises over the window.
+     *
+     * \param damping Called as damping(x, y) for squares inside the window; gives how many
+     * squares' worth of sound stepping onto that square costs, 1 for open air, or 0 if no sound
+     * gets through at all.
+     */
+    template<typename Damping>
+    void resolve(const Damping& damping)
+    {
+        std::fill(loudness_.begin(), loudness_.end(), silent);
+        open_.clear();
+        outside_.clear();
+
+        for (std::size_t s {0}; s < sources_.size(); ++s) {
+            const Point at {sources_[s].at};
+            const int loudness {sources_[s].volume * straight};
+
+            if (!inside(at)) {
+                outside_.push_back(s);
+            } else if (loudness > loudness_[cell(at)]) {
+                loudness_[cell(at)] = loudness;
+                source_[cell(at)] = static_cast<int>(s);
+                open_.push_back({cell(at), loudness});
+            }
+        }
+
+        std::make_heap(open_.begin(), open_.end(), quieter);
+
+        while (!open_.empty()) {
+            std::pop_heap(open_.begin(), open_.end(), quieter);
+            const Node node {open_.back()};
+            open_.pop_back();
+
+            if (node.loudness != loudness_[node.cell]) {
+                continue; // Already reached by something louder
+            }
+
+            const int s {source_[node.cell]};
+            // Past this it's out of earshot even for the keen of hearing.
+            const int faintest {-sources_[static_cast<std::size_t>(s)].volume * straight};
+            const Point here {point(node.cell)};
+
+            for (const auto& offset : offsets) {
+                const Point next {here.x + offset.x, here.y + offset.y};
+
+                if (!inside(next)) {
+                    continue;
+                }
+
+                const int damp {damping(next.x, next.y)};
+
+                if (damp <= 0) {
+                    continue;
+                }
+
+                const int step {offset.x != 0 && offset.y != 0 ? diagonal : straight};
+                const int loudness {node.loudness - step * damp};
+                const std::size_t n {cell(next)};
+
+                if (loudness >= faintest && loudness > loudness_[n]) {
+                    loudness_[n] = loudness;
+                    source_[n] = s;
+                    open_.push_back({n, loudness});
+                    std::push_heap(open_.begin(), open_.end(), quieter);
+                }
+            }
+        }
+
+        resolved_ = sources_.size();
+    }
+
+    /// The loudest noise reaching (\p x, \p y) as of the last resolve(), if any does.
+    [[nodiscard]] auto heard(const int x, const int y) const -> std::optional<Heard>
+    {
+        int best {-1};
+        int best_loudness {silent};
+
+        const auto straight_line {[&](const std::size_t s) {
+            const Point at {sources_[s].at};
+            const int dx {std::abs(at.x - x)};
+            const int dy {std::abs(at.y - y)};
+            const int travelled {std::max(dx, dy) * straight
+                                 + std::min(dx, dy) * (diagonal - straight)};
+            const int loudness {sources_[s].volume * straight - travelled};
+
+            if (loudness >= -sources_[s].volume * straight && loudness > best_loudness) {
+                best = static_cast<int>(s);
+                best_loudness = loudness;
+            }
+        }};
+
+        if (inside({x, y})) {
+            best = source_[cell({x, y})];
+            best_loudness = loudness_[cell({x, y})];
+
+            // Noises inside reach listeners inside through the window, so only those outside are
+            // left to check.
+            for (const std::size_t s : outside_) {
+                straight_line(s);
+            }
+        } else {
+            for (std::size_t s {0}; s < resolved_; ++s) {
+                straight_line(s);
+            }
+        }
+
+        if (best < 0 || best_loudness == silent) {
+            return std::nullopt;
+        }
+
+        const Source& source {sources_[static_cast<std::size_t>(best)]};
+        const int travelled {source.volume * straight - best_loudness};
+        return Heard {source.at, source.volume, travelled / straight};
+    }
+
+    /// Moves the queued noises along with the window, whose corner moved by (\p dx, \p dy).
+    void shift(const int dx, const int dy)
+    {
+        for (auto& source : sources_) {
+            source.at.x -= dx;
+            source.at.y -= dy;
+        }
+    }
+
+    /// Forgets every noise, heard or still queued.
+    void clear()
+    {
+        sources_.clear();
+        outside_.clear();
+        std::fill(loudness_.begin(), loudness_.end(), silent);
+        resolved_ = 0;
+    }
+
+private:
+    struct Source {
+        Point at;
+        int volume;
+    };
+
+    struct Node {
+        std::size_t cell;
+        int loudness;
+    };
+
+    /// Sound travelled per straight and diagonal step, in tenths of a square.
+    static constexpr int straight {10};
+    static constexpr int diagonal {14};
+    static constexpr int silent {INT_MIN};
+
+    static constexpr std::array<Point, 8> offsets {{
+        {0, -1},
+        {1, 0},
+        {0, 1},
+        {-1, 0},
+        {1, -1},
+        {1, 1},
+        {-1, 1},
+        {-1, -1},
+    }};
+
+    static auto quieter(const Node& a, const Node& b) -> bool { return a.loudness < b.loudness; }
+
+    [[nodiscard]] auto inside(const Point p) const -> bool
+    {
+        return p.x >= 0 && p.x < width_ && p.y >= 0 && p.y < height_;
+    }
+
+    [[nodiscard]] auto cell(const Point p) const -> std::size_t
+    {
+        return static_cast<std::size_t>(p.y * width_ + p.x);
+    }
+
+    [[nodiscard]] auto point(const std::size_t n) const -> Point
+    {
+        return {static_cast<int>(n) % width_, static_cast<int>(n) / width_};
+    }
+
+    int width_;
+    int height_;
+    std::vector<Source> sources_;
+    std::size_t resolved_ {0};  ///< Sources [0, resolved_) were spread by the last resolve().
+    std::vector<int> loudness_; ///< Tenths of a square the loudest noise here has left to carry.
+    std::vector<int> source_;   ///< Index of that noise in sources_.
+    std::vector<Node> open_;    ///< Binary heap, loudest on top.
+
+    /// Those of the resolved sources outside the window, all a listener inside has to check.
+    std::vector<std::size_t> outside_;
+};
+} // namespace oocdda
+
+#endif // OOCDDA_NOISE_MAP_HPP
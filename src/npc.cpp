@@ -49,7 +49,7 @@ npc::npc()
     dex_max = 0;
     int_max = 0;
     per_max = 0;
-    target = NULL;
+    target = {};
     my_fac = NULL;
     moves = 100;
     mission = MISSION_NULL;
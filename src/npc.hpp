@@ -10,6 +10,7 @@
 #include "omdata.hpp"
 #include "player.hpp"
 #include "skill.hpp"
+#include "slot_map.hpp"
 
 namespace oocdda {
 class Game;
@@ -172,7 +173,8 @@ public:
     void move(Game* g);                      // Actual movement; depends on target and attitude
     int confident_range();                   // Range at which we have 50% chance of a shot hitting
     bool wont_shoot_friend();                // Confident that we won't shoot a friend.
-    Monster* choose_monster_target(Game* g); // Most often, the closest to us
+    SlotHandle choose_monster_target(Game* g); // Most often, the closest to us
+    Monster* target_monster(Game* g);        // What target names; NULL if it's gone
     bool want_to_attack_player(Game* g);
     int follow_distance(); // How closely do we follow the player?
     bool can_reload();
@@ -203,7 +205,7 @@ public:
 
     void die(Game* g);
 
-    Monster* target;         // Current monster we want to kill
+    SlotHandle target;       // Current monster we want to kill, in Game::z
     npc_attitude attitude;   // What we want to do to the player
     int wandx, wandy, wandf; // Location of heard sound, etc.
 
@@ -33,13 +33,14 @@ void npc::move(Game* g)
     std::vector<Point> path;
     npc_action action = npc_pause;
     target = choose_monster_target(g); // Set a target
+    Monster* mon = target_monster(g);
     // If we aren't moving towards an item or a monster, find an item
-    if (!fetching_item() && target == NULL)
+    if (!fetching_item() && mon == NULL)
         find_items(g);
 
     if (want_to_attack_player(g))
         action = method_of_attacking_player(g, path);
-    else if (target != NULL)
+    else if (mon != NULL)
         action = method_of_attacking_monster(g, path);
     else if (mission == MISSION_SHOPKEEP)
         action = npc_pause;
@@ -62,6 +63,7 @@ void npc::move(Game* g)
                  npc_action_name(action).c_str(), mission);
 
     int oldmoves = moves;
+    mon = target_monster(g); // method_of_attacking_monster() may have retargeted
 
     switch (action) {
     case npc_pause:
@@ -82,9 +84,10 @@ void npc::move(Game* g)
         break;
 
     case npc_flee_monster:
-        if (target == NULL)
+        if (mon == NULL)
             debugmsg("%s tried to flee a null monster!", name.c_str());
-        move_away_from(g, target->posx, target->posy);
+        else
+            move_away_from(g, mon->posx, mon->posy);
         break;
 
     case npc_melee_monster:
@@ -96,15 +99,15 @@ void npc::move(Game* g)
         break;
 
     case npc_shoot_monster:
-        if (trig_dist(posx, posy, target->posx, target->posy) <= confident_range() / 3
-            && target->hp >= weapon.curammo->damage * 3)
-            g->fire(*this, target->posx, target->posy, path, true); // Burst fire
+        if (trig_dist(posx, posy, mon->posx, mon->posy) <= confident_range() / 3
+            && mon->hp >= weapon.curammo->damage * 3)
+            g->fire(*this, mon->posx, mon->posy, path, true); // Burst fire
         else
-            g->fire(*this, target->posx, target->posy, path, false); // Normal
+            g->fire(*this, mon->posx, mon->posy, path, false); // Normal
         break;
 
     case npc_alt_attack_monster:
-        alt_attack(g, target, NULL);
+        alt_attack(g, mon, NULL);
         break;
 
     case npc_look_for_player:
@@ -181,7 +184,7 @@ void npc::move(Game* g)
     }
 }
 
-Monster* npc::choose_monster_target(Game* g)
+SlotHandle npc::choose_monster_target(Game* g)
 {
     int closest = 1000, plclosest = 1000, lowHP = 10000, pllowHP = 10000;
     int index = -1, plindex = -1;
@@ -225,11 +228,17 @@ Monster* npc::choose_monster_target(Game* g)
             importance -= 5;
 
         if (bravery_check(importance))
-            return &(g->z[plindex]);
+            return g->z.handle(plindex);
     }
     if (index != -1)
-        return &(g->z[index]);
-    return NULL;
+        return g->z.handle(index);
+    return {};
+}
+
+Monster* npc::target_monster(Game* g)
+{
+    Monster* const mon = g->z.get(target);
+    return mon != NULL && !mon->dead ? mon : NULL;
 }
 
 void npc::find_items(Game* g)
@@ -326,7 +335,7 @@ bool npc::want_to_attack_player(Game* g)
     int j;
     if ((attitude == NPCATT_KILL || attitude == NPCATT_FLEE)
         && g->m.sees(posx, posy, g->u.posx, g->u.posy, g->light_level(), j)
-        && (target == NULL || rl_dist(posx, posy, g->u.posx, g->u.posy) > 3))
+        && (target_monster(g) == NULL || rl_dist(posx, posy, g->u.posx, g->u.posy) > 3))
         return true;
     return false;
 }
@@ -399,25 +408,27 @@ npc_action npc::method_of_attacking_player(Game* g, std::vector<Point>& path)
 
 npc_action npc::method_of_attacking_monster(Game* g, std::vector<Point>& path)
 {
-    if (target == NULL) {
+    Monster* mon = target_monster(g);
+    if (mon == NULL) {
         debugmsg("Tried to figure out how to attack a null monster!");
         return npc_pause;
     }
     if (g->debugmon)
-        debugmsg("method_of_attacking_monster(); %s (%d:%d)", target->name().c_str(), target->posx,
-                 target->posy);
+        debugmsg("method_of_attacking_monster(); %s (%d:%d)", mon->name().c_str(), mon->posx,
+                 mon->posy);
     int linet, light = g->light_level();
-    if (g->m.sees(posx, posy, target->posx, target->posy, light, linet))
-        path = line_to(posx, posy, target->posx, target->posy, linet);
+    if (g->m.sees(posx, posy, mon->posx, mon->posy, light, linet))
+        path = line_to(posx, posy, mon->posx, mon->posy, linet);
     else {
         target = choose_monster_target(g);
-        if (g->m.sees(posx, posy, target->posx, target->posy, light, linet))
-            path = line_to(posx, posy, target->posx, target->posy, linet);
+        mon = target_monster(g);
+        if (mon != NULL && g->m.sees(posx, posy, mon->posx, mon->posy, light, linet))
+            path = line_to(posx, posy, mon->posx, mon->posy, linet);
         else
             return npc_pause;
     }
-    int dist = trig_dist(posx, posy, target->posx, target->posy);
-    int rldist = rl_dist(posx, posy, target->posx, target->posy);
+    int dist = trig_dist(posx, posy, mon->posx, mon->posy);
+    int rldist = rl_dist(posx, posy, mon->posx, mon->posy);
     if (weapon.is_gun()) {
         if (weapon.charges > 0) {
             if (dist <= confident_range()) {
@@ -426,7 +437,7 @@ npc_action npc::method_of_attacking_monster(Game* g, std::vector<Point>& path)
                 }
 
                 // You or a friendly NPC is in the way.
-                const std::string saytext {"Move so I can shoot that" + target->name() + "!"};
+                const std::string saytext {"Move so I can shoot that" + mon->name() + "!"};
                 say(g, saytext);
 
                 if (can_reload()) {
@@ -442,7 +453,7 @@ npc_action npc::method_of_attacking_monster(Game* g, std::vector<Point>& path)
                 return npc_action::npc_reload;
             }
 
-            if (target->speed >= 100) {
+            if (mon->speed >= 100) {
                 // They're fast, don't ignore them.
                 return npc_action::npc_melee_monster;
             }
@@ -452,13 +463,13 @@ npc_action npc::method_of_attacking_monster(Game* g, std::vector<Point>& path)
         } else { // Gun isn't loaded
             if (can_reload() && rldist * 1.5 <= weapon.reload_time(*this))
                 return npc_reload; // Plenty of time to reload
-            else if (target->speed >= 90 && hp_percentage() >= 75)
+            else if (mon->speed >= 90 && hp_percentage() >= 75)
                 return npc_melee_monster;
             else
                 return long_term_goal_action(g, path); // Ignore the monster
         }
     } else {                                                    // Our weapon isn't a gun
-        if ((rldist * 100) / target->speed <= 6) {              // Close enough to care
+        if ((rldist * 100) / mon->speed <= 6) {                 // Close enough to care
             if (hp_percentage() + sklevel[sk_melee] * 10 >= 80) // We're confident
                 return npc_melee_monster;
             else
@@ -616,18 +627,24 @@ void npc::go_to_destination(Game* g)
         if (goaly == mapy)
             sy = 0;
         int x = posx + 8 * sx, y = posy + 8 * sy, linet, light = g->light_level();
+        std::vector<Point> path;
+        // Walk (or open, or bash) our way there if the map knows how...
+        if (g->m.move_cost(x, y) > 0 && g->m.route(posx, posy, x, y, path, true, true, 200)) {
+            move_to(g, path[0].x, path[0].y);
+            return;
+        }
+        // ...otherwise head for somewhere near it that we can see.
         for (int i = 0; i < 8; i++) {
             for (int dx = 0 - i; dx <= i; dx++) {
                 for (int dy = 0 - i; dy <= i; dy++) {
                     if (g->m.sees(posx, posy, x + dx, y + dy, light, linet)) {
-                        std::vector<Point> path = line_to(posx, posy, x + dx, y + dy, linet);
-                        if (can_move_to(g, path[0].x, path[0].y)) {
+                        path = line_to(posx, posy, x + dx, y + dy, linet);
+                        if (can_move_to(g, path[0].x, path[0].y)
+                            || g->m.route(posx, posy, x + dx, y + dy, path, true, true, 200))
                             move_to(g, path[0].x, path[0].y);
-                            return;
-                        } else {
+                        else
                             move_pause();
-                            return;
-                        }
+                        return;
                     }
                 }
             }
@@ -658,7 +675,8 @@ void npc::move_to(Game* g, int x, int y)
     if (x == posx && y == posy) // We're just pausing!
         moves -= 100;
     else if (g->mon_at(x, y) != -1) {
-        // Shouldn't happen, but it might.
+        // Shouldn't happen, but it might.  Hit whatever's in the way, targeted or not.
+        target = g->z.handle(g->mon_at(x, y));
         melee_monster(g);
     } else if (g->u.posx == x && g->u.posy == y) {
         say(g, "Excuse me, let me pass.");
@@ -667,8 +685,11 @@ void npc::move_to(Game* g, int x, int y)
         // TODO: Determine if it's an enemy NPC (hit them), or a friendly in the way
         moves -= 100;
     else if (g->m.move_cost(x, y) > 0) {
+        const int oldx {posx};
+        const int oldy {posy};
         posx = x;
         posy = y;
+        g->npc_grid.moved(*this, oldx, oldy);
         moves -= g->m.move_cost(x, y) * 50;
     } else if (g->m.open_door(x, y, (g->m.ter(posx, posy) == t_floor)))
         moves -= 100;
@@ -722,10 +743,13 @@ void npc::move_pause()
 
 void npc::melee_monster(Game* g)
 {
-    int dam = hit_mon(g, target);
-    if (target->hurt(dam)) {
-        g->kill_mon(g->mon_at(target->posx, target->posy));
-        target = NULL;
+    Monster* const mon = target_monster(g);
+    if (mon == NULL)
+        return;
+    int dam = hit_mon(g, mon);
+    if (mon->hurt(dam)) {
+        g->kill_mon(g->z.index_of(target));
+        target = {};
     }
 }
 
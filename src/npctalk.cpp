@@ -605,7 +605,7 @@ int dialogue::opt(std::string challenge, ...)
     bool okay;
     do {
         do {
-            ch = getch() - '0';
+            ch = get_key() - '0';
             r = ch - 1;
             if (r < 0)
                 r += options.size();
@@ -741,7 +741,7 @@ Tab key to switch lists, letters to pick items, Enter to finalize, Esc to quit\n
             wrefresh(w_them);
             wrefresh(w_you);
         } // Done updating the screen
-        ch = getch();
+        ch = get_key();
         switch (ch) {
         case '\t':
             focus_them = !focus_them;
@@ -780,7 +780,7 @@ Tab key to switch lists, letters to pick items, Enter to finalize, Esc to quit\n
             wborder(w_tmp, LINE_XOXO, LINE_XOXO, LINE_OXOX, LINE_OXOX, LINE_OXXO, LINE_OOXX,
                     LINE_XXOO, LINE_XOOX);
             wrefresh(w_tmp);
-            help = getch();
+            help = get_key();
             help -= 'a';
             werase(w_tmp);
             delwin(w_tmp);
@@ -0,0 +1,360 @@
+#ifndef OOCDDA_OCCUPANCY_GRID_HPP
+#define OOCDDA_OCCUPANCY_GRID_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace oocdda {
+/**
+ * \brief Answers "who stands at (x, y)?" for a vector of creatures in constant time.
+ *
+ * Each square of a width by height window holds the lowest index of the creatures standing on it,
+ * so lookups agree with a front-to-back scan of the vector. Squares outside the window fall back
+ * to such a scan.
+ *
+ * Squares are also grouped into buckets that count who stands in them, so nearest() can walk
+ * outwards from a spot skipping the empty stretches of the map.
+ *
+ * Creatures appended to the vector are picked up on the next lookup. Moving a creature must be
+ * reported through moved(); erasing, clearing or shifting the whole vector through invalidate().
+ *
+ * Creatures with a dead flag are left out once it's set, which must be reported through removed().
+ * Erasing one of those by moving the last creature into its place can then be reported through
+ * swapped_out(), which is cheaper than starting over.
+ */
+template<typename Creature>
+class OccupancyGrid {
+public:
+    /**
+     * \param creatures The vector to index; must outlive the grid.
+     * \param width, height The size of the indexed window, starting at (0, 0).
+     */
+    OccupancyGrid(const std::vector<Creature>& creatures, const int width, const int height)
+        : creatures_ {creatures}
+        , width_ {width}
+        , height_ {height}
+        , cells_(static_cast<std::size_t>(width * height))
+        , buckets_wide_ {(width + bucket_size - 1) / bucket_size}
+        , buckets_high_ {(height + bucket_size - 1) / bucket_size}
+        , buckets_(static_cast<std::size_t>(buckets_wide_ * buckets_high_))
+    {
+    }
+
+    OccupancyGrid(const OccupancyGrid&) = delete;
+    OccupancyGrid(OccupancyGrid&&) = delete;
+    auto operator=(const OccupancyGrid&) -> OccupancyGrid& = delete;
+    auto operator=(OccupancyGrid&&) -> OccupancyGrid& = delete;
+    ~OccupancyGrid() = default;
+
+    /// Index of the first creature at (\p x, \p y); -1 for none.
+    [[nodiscard]] auto at(const int x, const int y) -> int
+    {
+        if (!inside(x, y)) {
+            return scan(x, y);
+        }
+
+        sync();
+        return cells_[cell(x, y)].first;
+    }
+
+    /**
+     * \brief Offers the creatures within \p range of (\p x, \p y) to \p visit, nearest first.
+     *
+     * Distance is the larger of the x and y distances, as for rl_dist(); creatures the same
+     * distance away come in vector order. Creatures outside the window aren't offered.
+     *
+     * \param range Negative for no limit.
+     * \param visit Called as visit(index); returning true stops the search.
+     * \return The index \p visit stopped at, or -1.
+     */
+    template<typename Visit>
+    auto nearest(const int x, const int y, const int range, const Visit& visit) -> int
+    {
+        sync();
+        pending_.clear();
+
+        const int limit {range < 0 ? width_ + height_ : range};
+        // From outside the window the rings below don't bound anything, so gather it all first.
+        const bool within {inside(x, y)};
+        const int bx {std::clamp(x / bucket_size, 0, buckets_wide_ - 1)};
+        const int by {std::clamp(y / bucket_size, 0, buckets_high_ - 1)};
+        const int rings {std::max(buckets_wide_, buckets_high_)};
+
+        for (int ring {0}; ring <= rings; ++ring) {
+            for (int j {by - ring}; j <= by + ring; ++j) {
+                for (int i {bx - ring}; i <= bx + ring; ++i) {
+                    if (std::max(std::abs(i - bx), std::abs(j - by)) == ring) {
+                        gather(i, j, x, y, limit);
+                    }
+                }
+            }
+
+            // Buckets further out are all more than this far away.
+            const int bound {ring == rings || !within ? limit : ring * bucket_size};
+
+            if (!within && ring < rings) {
+                continue;
+            }
+
+            while (!pending_.empty() && pending_.front().distance <= bound) {
+                std::pop_heap(pending_.begin(), pending_.end(), later);
+                const int index {pending_.back().index};
+                pending_.pop_back();
+
+                if (visit(index)) {
+                    return index;
+                }
+            }
+
+            if (bound >= limit) {
+                break;
+            }
+        }
+
+        return -1;
+    }
+
+    /// Records that \p creature, an element of the vector, walked from (\p oldx, \p oldy).
+    void moved(const Creature& creature, const int oldx, const int oldy)
+    {
+        const auto index {index_of(creature)};
+
+        // Creatures not indexed yet are placed on the next sync, wherever they are by then.
+        if (stale_ || index < 0 || index >= indexed_ || !counts(creature)
+            || (creature.posx == oldx && creature.posy == oldy)) {
+            return;
+        }
+
+        remove(index, oldx, oldy);
+        add(index, creature.posx, creature.posy);
+    }
+
+    /// Records that \p creature, an element of the vector, has just been flagged dead.
+    void removed(const Creature& creature)
+    {
+        const auto index {index_of(creature)};
+
+        // Not indexed yet means it never will be now.
+        if (stale_ || index < 0 || index >= indexed_) {
+            return;
+        }
+
+        remove(index, creature.posx, creature.posy);
+    }
+
+    /**
+     * \brief Records that the dead creature at \p index was erased by moving the last one into its
+     * place.
+     */
+    void swapped_out(const int index)
+    {
+        // Anything not yet caught up with is easier to start over.
+        if (stale_ || static_cast<std::size_t>(indexed_) != creatures_.size() + 1) {
+            stale_ = true;
+            return;
+        }
+
+        const int last {--indexed_};
+        const auto& moved {creatures_[static_cast<std::size_t>(index)]};
+
+        if (index == last || !counts(moved) || !inside(moved.posx, moved.posy)) {
+            return;
+        }
+
+        auto& square {cells_[cell(moved.posx, moved.posy)]};
+
+        if (square.first == last || index < square.first) {
+            square.first = index;
+        }
+    }
+
+    /// Drops everything; the grid is rebuilt from the vector on the next lookup.
+    void invalidate() { stale_ = true; }
+
+private:
+    struct Cell {
+        int first {-1}; ///< Lowest index standing here.
+        int count {0};
+    };
+
+    struct Candidate {
+        int distance;
+        int index;
+    };
+
+    /// Squares per side of a bucket.
+    static constexpr int bucket_size {4};
+
+    /// Heap order: nearest on top, then lowest index.
+    static auto later(const Candidate& a, const Candidate& b) -> bool
+    {
+        return a.distance > b.distance || (a.distance == b.distance && a.index > b.index);
+    }
+
+    /// Adds everyone in bucket (\p i, \p j) within \p limit of (\p x, \p y) to pending_.
+    void gather(const int i, const int j, const int x, const int y, const int limit)
+    {
+        if (i < 0 || i >= buckets_wide_ || j < 0 || j >= buckets_high_
+            || buckets_[static_cast<std::size_t>(j * buckets_wide_ + i)] == 0) {
+            return;
+        }
+
+        const int right {std::min((i + 1) * bucket_size, width_)};
+        const int bottom {std::min((j + 1) * bucket_size, height_)};
+
+        for (int sy {j * bucket_size}; sy < bottom; ++sy) {
+            for (int sx {i * bucket_size}; sx < right; ++sx) {
+                const auto& square {cells_[cell(sx, sy)]};
+                const int distance {std::max(std::abs(sx - x), std::abs(sy - y))};
+
+                if (square.count == 0 || distance > limit) {
+                    continue;
+                }
+
+                offer({distance, square.first});
+
+                // Stacked creatures again; find the rest the slow way.
+                for (int k {square.first + 1}, left {square.count - 1}; left > 0 && k < indexed_;
+                     ++k) {
+                    if (creatures_[k].posx == sx && creatures_[k].posy == sy
+                        && counts(creatures_[k])) {
+                        offer({distance, k});
+                        --left;
+                    }
+                }
+            }
+        }
+    }
+
+    void offer(const Candidate candidate)
+    {
+        pending_.push_back(candidate);
+        std::push_heap(pending_.begin(), pending_.end(), later);
+    }
+
+    [[nodiscard]] auto bucket(const int x, const int y) -> int&
+    {
+        return buckets_[static_cast<std::size_t>((y / bucket_size) * buckets_wide_
+                                                 + x / bucket_size)];
+    }
+
+    /// Whether \p creature stands anywhere as far as the grid is concerned.
+    [[nodiscard]] static auto counts(const Creature& creature) -> bool
+    {
+        if constexpr (requires { creature.dead; }) {
+            return !creature.dead;
+        } else {
+            return true;
+        }
+    }
+
+    [[nodiscard]] auto inside(const int x, const int y) const -> bool
+    {
+        return x >= 0 && x < width_ && y >= 0 && y < height_;
+    }
+
+    [[nodiscard]] auto cell(const int x, const int y) const -> std::size_t
+    {
+        return static_cast<std::size_t>(y * width_ + x);
+    }
+
+    [[nodiscard]] auto scan(const int x, const int y) const -> int
+    {
+        for (std::size_t i {0}; i < creatures_.size(); ++i) {
+            if (creatures_[i].posx == x && creatures_[i].posy == y && counts(creatures_[i])) {
+                return static_cast<int>(i);
+            }
+        }
+
+        return -1;
+    }
+
+    [[nodiscard]] auto index_of(const Creature& creature) const -> int
+    {
+        const auto* const begin {creatures_.data()};
+        const auto* const end {begin + creatures_.size()};
+        const std::less<const Creature*> before;
+
+        // Temporaries, e.g. monsters about to be spawned, aren't in the vector.
+        if (before(&creature, begin) || !before(&creature, end)) {
+            return -1;
+        }
+
+        return static_cast<int>(&creature - begin);
+    }
+
+    void sync()
+    {
+        // Indexing a shrunk vector would read past its end; start over instead.
+        if (stale_ || static_cast<std::size_t>(indexed_) > creatures_.size()) {
+            cells_.assign(cells_.size(), Cell {});
+            buckets_.assign(buckets_.size(), 0);
+            indexed_ = 0;
+            stale_ = false;
+        }
+
+        // Creatures are only ever appended, so catching up means indexing the tail.
+        for (; static_cast<std::size_t>(indexed_) < creatures_.size(); ++indexed_) {
+            if (counts(creatures_[indexed_])) {
+                add(indexed_, creatures_[indexed_].posx, creatures_[indexed_].posy);
+            }
+        }
+    }
+
+    void add(const int index, const int x, const int y)
+    {
+        if (!inside(x, y)) {
+            return;
+        }
+
+        auto& square {cells_[cell(x, y)]};
+        ++square.count;
+        ++bucket(x, y);
+
+        if (square.first < 0 || index < square.first) {
+            square.first = index;
+        }
+    }
+
+    void remove(const int index, const int x, const int y)
+    {
+        if (!inside(x, y)) {
+            return;
+        }
+
+        auto& square {cells_[cell(x, y)]};
+        --square.count;
+        --bucket(x, y);
+
+        if (square.first != index) {
+            return;
+        }
+
+        // Only stacked creatures, which the game tries hard to avoid, need the slow path.
+        square.first = -1;
+
+        for (int i {0}; square.count > 0 && i < indexed_; ++i) {
+            if (creatures_[i].posx == x && creatures_[i].posy == y && counts(creatures_[i])) {
+                square.first = i;
+                break;
+            }
+        }
+    }
+
+    const std::vector<Creature>& creatures_;
+    int width_;
+    int height_;
+    std::vector<Cell> cells_;
+    int buckets_wide_;
+    int buckets_high_;
+    std::vector<int> buckets_; ///< How many creatures stand in each bucket.
+    std::vector<Candidate> pending_; ///< Heap of those found by nearest() but not yet offered.
+    int indexed_ {0}; ///< Creatures [0, indexed_) are in the grid.
+    bool stale_ {false};
+};
+} // namespace oocdda
+
+#endif // OOCDDA_OCCUPANCY_GRID_HPP
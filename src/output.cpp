@@ -88,6 +88,28 @@ void mvwputch(WINDOW* w, int y, int x, nc_color FG, long ch)
     wattroff(w, FG);
 }
 
+int wpresent(WINDOW* from, WINDOW* to)
+{
+    int height, width, top, left, cury, curx;
+    getmaxyx(to, height, width);
+    getbegyx(to, top, left);
+    getyx(curscr, cury, curx); // Reading curscr moves its cursor, which curses goes by
+    int changed = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const chtype cell = mvwinch(from, y, x);
+            if (cell != mvwinch(to, y, x) || cell != mvwinch(curscr, top + y, left + x)) {
+                mvwaddch(to, y, x, cell);
+                changed++;
+            }
+        }
+    }
+    wmove(curscr, cury, curx);
+    if (changed > 0)
+        wrefresh(to);
+    return changed;
+}
+
 void mvputch_inv(int y, int x, nc_color FG, long ch)
 {
     nc_color HC;
@@ -372,7 +394,7 @@ void debugmsg(const char* mes, ...)
     va_end(ap);
     attron(c_red);
     mvprintw(0, 0, "DEBUG: %s                \n  Press spacebar...", buff);
-    while (getch() != ' ')
+    while (get_key() != ' ')
         ;
     attroff(c_red);
 }
@@ -392,7 +414,7 @@ bool query_yn(const char* mes, ...)
     wrefresh(w);
     char ch;
     do
-        ch = getch();
+        ch = get_key();
     while (ch != 'Y' && ch != 'N');
     werase(w);
     wrefresh(w);
@@ -422,7 +444,7 @@ std::string string_input_popup(const char* mes, ...)
     mvwputch(w, 1, posx, h_ltgray, '_');
     do {
         wrefresh(w);
-        long ch = getch();
+        long ch = get_key();
         if (ch == 27) { // Escape
             werase(w);
             wrefresh(w);
@@ -479,7 +501,7 @@ int menu_vec(const char* mes, std::vector<std::string> options)
     wrefresh(w);
 
     do {
-        ch = getch();
+        ch = get_key();
     } while (ch < '1' || ch >= '1' + std::ssize(options));
 
     werase(w);
@@ -552,7 +574,7 @@ void popup_top(const char* mes, ...)
     wrefresh(w);
     char ch;
     do
-        ch = getch();
+        ch = get_key();
     while (ch != ' ' && ch != '\n' && ch != KEY_ESCAPE);
     werase(w);
     wrefresh(w);
@@ -608,7 +630,7 @@ void popup(const char* mes, ...)
     wrefresh(w);
     char ch;
     do
-        ch = getch();
+        ch = get_key();
     while (ch != ' ' && ch != '\n' && ch != KEY_ESCAPE);
     werase(w);
     wrefresh(w);
@@ -641,7 +663,7 @@ void full_screen_popup(const char* mes, ...)
     wrefresh(w);
     char ch;
     do
-        ch = getch();
+        ch = get_key();
     while (ch != ' ' && ch != '\n' && ch != KEY_ESCAPE);
     werase(w);
     wrefresh(w);
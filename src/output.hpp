@@ -51,6 +51,11 @@ void mvwprintz(WINDOW* w, int y, int x, nc_color FG, const char* mes, ...);
 void printz(nc_color FG, const char* mes, ...);
 void wprintz(WINDOW* w, nc_color FG, const char* mes, ...);
 
+// Copies onto to each cell of from (a window or pad at least its size) that differs from to or
+//  from what's on screen under it, then refreshes to if any did; returns how many cells that was.
+//  With from == to, only repaints whatever other windows drew over.
+int wpresent(WINDOW* from, WINDOW* to);
+
 void debugmsg(const char* mes, ...);
 bool query_yn(const char* mes, ...);
 std::string string_input_popup(const char* mes, ...);
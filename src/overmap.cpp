@@ -1,9 +1,10 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <cstdio>
 #include <cstdlib>
-#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "overmap.hpp"
@@ -11,10 +12,14 @@
 #include <ncurses/curses.h>
 
 #include "faction.hpp"
+#include "keypress.hpp"
 #include "line.hpp"
 #include "mongroup.hpp"
 #include "omdata.hpp"
 #include "output.hpp"
+#include "overmap_cache.hpp"
+#include "profiler.hpp"
+#include "region_store.hpp"
 #include "rng.hpp"
 #include "settlement.hpp"
 
@@ -38,7 +43,11 @@ class Game;
 
 void settlement_building(settlement& set, int x, int y);
 
-double dist(int x1, int y1, int x2, int y2) { return sqrt(pow(x1 - x2, 2) + pow(y1 - y2, 2)); }
+// Whether overmap (x, y, z) has been generated yet.
+bool overmap_exists(int x, int y, int z)
+{
+    return overmap_records().contains({x, y, z});
+}
 
 bool is_river(oter_id ter)
 {
@@ -220,6 +229,7 @@ void overmap::add_note(int x, int y, std::string message)
 
 void overmap::generate(Game* g, overmap* north, overmap* east, overmap* south, overmap* west)
 {
+    const RngScope scope {RngStream::overmap};
     erase();
     clear();
     move(0, 0);
@@ -350,7 +360,7 @@ void overmap::generate(Game* g, overmap* north, overmap* east, overmap* south, o
                 river_end.erase(river_end.begin());
             } else {
                 mvprintw(0, 0, "%zu   ", river_end_copy.size());
-                getch();
+                get_key();
                 place_river(river_start[index], river_end_copy[rng(0, river_end_copy.size() - 1)]);
             }
             river_start.erase(river_start.begin() + index);
@@ -365,7 +375,7 @@ void overmap::generate(Game* g, overmap* north, overmap* east, overmap* south, o
                 river_start.erase(river_start.begin());
             } else {
                 mvprintw(0, 0, "%zu   ", river_start_copy.size());
-                getch();
+                get_key();
                 place_river(river_start_copy[rng(0, river_start_copy.size() - 1)],
                             river_end[index]);
             }
@@ -460,6 +470,7 @@ void overmap::generate(Game* g, overmap* north, overmap* east, overmap* south, o
 
 void overmap::generate_sub(overmap* above)
 {
+    const RngScope scope {RngStream::overmap};
     std::vector<city> subway_points;
     std::vector<city> sewer_points;
     std::vector<city> ant_points;
@@ -613,7 +624,7 @@ void overmap::place_forest()
         fors = rng(15, 40);
 
         for (std::size_t j {0}; j < cities.size(); ++j) {
-            while (static_cast<int>(dist(forx, fory, cities[j].x, cities[j].y)) - fors / 2
+            while (trig_dist(forx, fory, cities[j].x, cities[j].y) - fors / 2
                    < cities[j].s) {
                 // Set forx and fory far enough from cities.
                 forx = static_cast<int>(rng(0, OMAPX - 1));
@@ -1034,7 +1045,9 @@ void overmap::put_buildings(int x, int y, int dir, city town)
     int ychange = dir % 2, xchange = (dir + 1) % 2;
     for (int i = -1; i <= 1; i += 2) {
         if ((ter(x + i * xchange, y + i * ychange) == ot_field) && !one_in(STREETCHANCE)) {
-            if (rng(0, 99) > 100 * dist(x, y, town.x, town.y) / town.s)
+            // rng(0, 99) > 100 * distance / size, squared to stay in integers
+            const long roll = rng(0, 99) * town.s;
+            if (roll * roll > 10000 * square_dist(x, y, town.x, town.y))
                 ter(x + i * xchange, y + i * ychange) = shop(((dir % 2) - i) % 4);
             else
                 ter(x + i * xchange, y + i * ychange) = house(((dir % 2) - i) % 4);
@@ -1359,7 +1372,7 @@ void overmap::make_hiway(int x1, int y1, int x2, int y2, oter_id base)
                 dir = static_cast<int>(i); // We are moving... whichever way that highway is moving.
 
                 // If we're closer to the destination than to the origin, this highway is done!
-                if (dist(x, y, x1, y1) > dist(x, y, x2, y2)) {
+                if (square_dist(x, y, x1, y1) > square_dist(x, y, x2, y2)) {
                     return;
                 }
 
@@ -1486,7 +1499,7 @@ void overmap::place_hiways(std::vector<city> cities, oter_id base)
         closest = -1;
 
         for (std::size_t j {i + 1}; j < cities.size(); ++j) {
-            distance = static_cast<int>(dist(cities[i].x, cities[i].y, cities[j].x, cities[j].y));
+            distance = trig_dist(cities[i].x, cities[i].y, cities[j].x, cities[j].y);
 
             if (distance < closest || closest < 0) {
                 closest = distance;
@@ -1793,142 +1806,54 @@ void overmap::save() { save(posx, posy, posz); }
 
 void overmap::save(int x, int y, int z)
 {
-    char buff[32];
-    sprintf(buff, "save/o.%d.%d.%d", x, y, z);
-    std::ofstream fout;
-    fout.open(buff, std::ios_base::trunc);
-    for (int j = 0; j < OMAPY; j++) {
-        for (int i = 0; i < OMAPX; i++)
-            fout << char(int(ter(i, j)) + 32);
-    }
-    for (int j = 0; j < OMAPY; j++) {
-        for (int i = 0; i < OMAPX; i++) {
-            if (seen(i, j))
-                fout << "1";
-            else
-                fout << "0";
-        }
-        fout << std::endl;
-    }
-
-    for (const auto& group : zg) {
-        fout << "Z " << group.type << ' ' << group.posx << ' ' << group.posy << ' '
-             << static_cast<int>(group.radius) << ' ' << group.population << '\n';
-    }
-
-    for (const auto& city : cities) {
-        fout << "C " << city.x << ' ' << city.y << ' ' << city.s << '\n';
-    }
-
-    for (const auto& road : roads_out) {
-        fout << "R " << road.x << ' ' << road.y << '\n';
-    }
-
-    for (const auto& radio : radios) {
-        fout << "T " << radio.x << ' ' << radio.y << ' ' << radio.strength << ' ' << '\n'
-             << radio.message << '\n';
-    }
-
-    for (const auto& note : notes) {
-        fout << "N " << note.x << ' ' << note.y << ' ' << note.num << '\n' << note.text << '\n';
-    }
-
-    fout.close();
+    const auto data {encode_overmap(*this)};
+    overmap_records().store({x, y, z}, {data.data(), data.size()});
+    overmap_cache().saved(*this, x, y, z);
 }
 
 void overmap::open(Game* g, int x, int y, int z)
 {
-    char buff[32];
-    char line[OMAPX];
-    char datatype;
-    int ct, cx, cy, cs, cp;
-    city tmp;
+    const ProfileScope profile {Phase::overmap_open};
     // Set position IDs
     posx = x;
     posy = y;
     posz = z;
-    sprintf(buff, "save/o.%d.%d.%d", x, y, z);
-    std::ifstream fin;
-    fin.open(buff);
+    const auto data {overmap_exists(x, y, z) ? overmap_records().load({x, y, z}) : std::nullopt};
+    if (data) {
+        if (decode_overmap(*data, *this))
+            return;
+        debugmsg("Corrupt overmap %d:%d:%d; regenerating it.", x, y, z);
+        // Throw away whatever was read before the damage.
+        zg.clear();
+        cities.clear();
+        roads_out.clear();
+        radios.clear();
+        notes.clear();
+    }
 
-    if (fin.is_open()) {
-        for (int j = 0; j < OMAPY; j++) {
-            // fin.getline(line, OMAPX + 1);
-            for (int i = 0; i < OMAPX; i++)
-                ter(i, j) = oter_id(fin.get() - 32);
-        }
-        for (int j = 0; j < OMAPY; j++) {
-            fin.getline(line, OMAPX + 1);
-            for (int i = 0; i < OMAPX; i++) {
-                if (line[i] == '1')
-                    seen(i, j) = true;
-                else
-                    seen(i, j) = false;
-            }
-        }
-        while (fin >> datatype) {
-            if (datatype == 'Z') {
-                fin >> ct >> cx >> cy >> cs >> cp;
-                zg.push_back(mongroup(moncat_id(ct), cx, cy, cs, cp));
-            } else if (datatype == 'C') {
-                fin >> cx >> cy >> cs;
-                tmp.x = cx;
-                tmp.y = cy;
-                tmp.s = cs;
-                cities.push_back(tmp);
-            } else if (datatype == 'R') {
-                fin >> cx >> cy;
-                tmp.x = cx;
-                tmp.y = cy;
-                tmp.s = 0;
-                roads_out.push_back(tmp);
-            } else if (datatype == 'T') {
-                radio_tower tmp;
-                fin >> tmp.x >> tmp.y >> tmp.strength;
-                getline(fin, tmp.message); // Chomp endl
-                getline(fin, tmp.message);
-                radios.push_back(tmp);
-            } else if (datatype == 'N') {
-                om_note tmp;
-                fin >> tmp.x >> tmp.y >> tmp.num;
-                getline(fin, tmp.text); // Chomp endl
-                getline(fin, tmp.text);
-                notes.push_back(tmp);
-            }
-        }
-        fin.close();
-    } else if (z <= -1) { // No map exists, and we are underground!
+    if (z <= -1) { // No map exists, and we are underground!
         // Fetch the terrain above
-        overmap* above = new overmap(g, x, y, z + 1);
-        generate_sub(above);
+        const auto above {overmap_cache().get(g, x, y, z + 1)};
+        generate_sub(above.get());
         save(x, y, z);
-        delete above;
     } else { // No map exists!  Prepare neighbors, and generate one.
-        std::vector<overmap*> pointers;
+        std::vector<std::shared_ptr<overmap>> pointers;
         // Fetch north and south
         for (int i = -1; i <= 1; i += 2) {
-            sprintf(buff, "save/o.%d.%d.%d", x, y + i, z);
-            fin.open(buff);
-            if (fin.is_open()) {
-                fin.close();
-                pointers.push_back(new overmap(g, x, y + i, z));
+            if (overmap_exists(x, y + i, z)) {
+                pointers.push_back(overmap_cache().get(g, x, y + i, z));
             } else
-                pointers.push_back(NULL);
+                pointers.push_back(nullptr);
         }
         // Fetch east and west
         for (int i = -1; i <= 1; i += 2) {
-            sprintf(buff, "save/o.%d.%d.%d", x + i, y, z);
-            fin.open(buff);
-            if (fin.is_open()) {
-                fin.close();
-                pointers.push_back(new overmap(g, x + i, y, z));
+            if (overmap_exists(x + i, y, z)) {
+                pointers.push_back(overmap_cache().get(g, x + i, y, z));
             } else
-                pointers.push_back(NULL);
+                pointers.push_back(nullptr);
         }
         // pointers looks like (north, south, west, east)
-        generate(g, pointers[0], pointers[3], pointers[1], pointers[2]);
-        for (int i = 0; i < 4; i++)
-            delete pointers[i];
+        generate(g, pointers[0].get(), pointers[3].get(), pointers[1].get(), pointers[2].get());
         save(x, y, z);
     }
 }
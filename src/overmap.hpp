@@ -2,11 +2,13 @@
 #define OOCDDA_OVERMAP_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "mongroup.hpp"
 #include "npc.hpp"
 #include "omdata.hpp"
+#include "overmap_io.hpp"
 #include "point.hpp"
 #include "settlement.hpp"
 
@@ -84,6 +86,10 @@ public:
     std::vector<npc> npcs;
 
 private:
+    friend auto encode_overmap(const overmap& om) -> std::vector<char>;
+    friend auto decode_overmap(std::string_view data, overmap& om) -> bool;
+    friend auto decode_legacy_overmap(std::string_view data, overmap& om) -> bool;
+
     oter_id t[OMAPX][OMAPY];
     oter_id nullret;
     bool s[OMAPX][OMAPY];
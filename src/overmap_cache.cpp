@@ -0,0 +1,115 @@
+#include <stdexcept>
+#include <utility>
+
+#include "overmap_cache.hpp"
+
+#include "overmap.hpp"
+#include "overmap_io.hpp"
+
+namespace oocdda {
+namespace {
+auto open_overmap(Game* g, const int x, const int y, const int z) -> std::shared_ptr<overmap>
+{
+    return std::make_shared<overmap>(g, x, y, z);
+}
+} // namespace
+
+OvermapCache::OvermapCache(RecordStore& store, const std::size_t capacity, Loader load)
+    : store_ {store}
+    , capacity_ {capacity}
+    , load_ {load ? std::move(load) : open_overmap}
+{
+    if (capacity_ == 0) {
+        throw std::invalid_argument("Overmap cache capacity must be positive");
+    }
+}
+
+OvermapCache::~OvermapCache() { flush(); }
+
+auto OvermapCache::get(Game* g, const int x, const int y, const int z) -> std::shared_ptr<overmap>
+{
+    const RecordKey key {x, y, z};
+
+    if (const auto it {nodes_.find(key)}; it != nodes_.end()) {
+        uses_.splice(uses_.begin(), uses_, it->second.use);
+        return it->second.data;
+    }
+
+    // Generating an overmap fetches its neighbours through this cache, so nothing found above may
+    // be relied on past this point.
+    auto data {load_(g, x, y, z)};
+
+    while (nodes_.size() >= capacity_) {
+        evict_oldest();
+    }
+
+    uses_.push_front(key);
+    nodes_.emplace(key, Node {data, uses_.begin()});
+    return data;
+}
+
+auto OvermapCache::contains(const int x, const int y, const int z) const -> bool
+{
+    return nodes_.contains({x, y, z});
+}
+
+void OvermapCache::mark_dirty(const int x, const int y, const int z)
+{
+    if (const auto it {nodes_.find({x, y, z})}; it != nodes_.end()) {
+        it->second.dirty = true;
+    }
+}
+
+void OvermapCache::saved(const overmap& om, const int x, const int y, const int z)
+{
+    const auto it {nodes_.find({x, y, z})};
+
+    if (it == nodes_.end() || it->second.data.get() == &om) {
+        return;
+    }
+
+    *it->second.data = om;
+    it->second.dirty = false;
+}
+
+void OvermapCache::flush()
+{
+    for (auto& [key, node] : nodes_) {
+        write_back(key, node);
+    }
+}
+
+void OvermapCache::clear()
+{
+    flush();
+    nodes_.clear();
+    uses_.clear();
+}
+
+void OvermapCache::write_back(const RecordKey& key, Node& node)
+{
+    if (!node.dirty) {
+        return;
+    }
+
+    const auto data {encode_overmap(*node.data)};
+    store_.store(key, {data.data(), data.size()});
+    node.dirty = false;
+}
+
+void OvermapCache::evict_oldest()
+{
+    const auto key {uses_.back()};
+    const auto it {nodes_.find(key)};
+    write_back(key, it->second);
+    nodes_.erase(it);
+    uses_.pop_back();
+}
+
+auto overmap_cache() -> OvermapCache&
+{
+    // Enough for the current overmap, its eight neighbours and the levels above and below.
+    static OvermapCache cache {overmap_records(), 16};
+    return cache;
+}
+} // namespace oocdda
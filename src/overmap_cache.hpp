@@ -0,0 +1,79 @@
+#ifndef OOCDDA_OVERMAP_CACHE_HPP
+#define OOCDDA_OVERMAP_CACHE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+
+#include "region_store.hpp"
+
+namespace oocdda {
+class Game;
+class overmap;
+
+/**
+ * \brief Shares recently used overmaps so neighbouring ones aren't parsed again for every redraw.
+ *
+ * Overmaps are handed out as shared pointers, so evicting one never pulls it from under a caller
+ * still using it. Callers that change a cached overmap mark it dirty; it is then saved when
+ * evicted or flushed. An overmap saved from elsewhere, e.g. the game's current one, replaces the
+ * cached copy.
+ */
+class OvermapCache {
+public:
+    /// Reads or generates an overmap the cache doesn't have.
+    using Loader = std::function<std::shared_ptr<overmap>(Game* g, int x, int y, int z)>;
+
+    /**
+     * \param store Where dirty overmaps are saved.
+     * \param capacity How many overmaps to keep before dropping the least recently used one.
+     * \param load What a miss calls; opens the overmap from overmap_records() if not given.
+     */
+    OvermapCache(RecordStore& store, std::size_t capacity, Loader load = {});
+    OvermapCache(const OvermapCache&) = delete;
+    OvermapCache(OvermapCache&&) = delete;
+    auto operator=(const OvermapCache&) -> OvermapCache& = delete;
+    auto operator=(OvermapCache&&) -> OvermapCache& = delete;
+    ~OvermapCache();
+
+    /// Returns overmap \p x, \p y, \p z, reading or generating it on a miss.
+    [[nodiscard]] auto get(Game* g, int x, int y, int z) -> std::shared_ptr<overmap>;
+
+    [[nodiscard]] auto contains(int x, int y, int z) const -> bool;
+
+    /// Records that the cached overmap \p x, \p y, \p z was changed and needs saving.
+    void mark_dirty(int x, int y, int z);
+
+    /// Called by overmap::save; refreshes the cached copy if \p om is a different instance.
+    void saved(const overmap& om, int x, int y, int z);
+
+    /// Saves every dirty overmap, keeping them cached.
+    void flush();
+
+    /// Saves every dirty overmap, then drops them all.
+    void clear();
+
+private:
+    struct Node {
+        std::shared_ptr<overmap> data;
+        std::list<RecordKey>::iterator use;
+        bool dirty {false};
+    };
+
+    void write_back(const RecordKey& key, Node& node);
+    void evict_oldest();
+
+    RecordStore& store_;
+    std::size_t capacity_;
+    Loader load_;
+    std::list<RecordKey> uses_; ///< Most recently used first.
+    std::map<RecordKey, Node> nodes_;
+};
+
+/// The cache in front of overmap_records().
+[[nodiscard]] auto overmap_cache() -> OvermapCache&;
+} // namespace oocdda
+
+#endif // OOCDDA_OVERMAP_CACHE_HPP
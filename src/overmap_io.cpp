@@ -0,0 +1,375 @@
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "overmap_io.hpp"
+
+#include "byte_buffer.hpp"
+#include "mongroup.hpp"
+#include "omdata.hpp"
+#include "overmap.hpp"
+
+namespace oocdda {
+namespace {
+static_assert(num_ter_types <= 256, "Overmap terrain ids are stored as single bytes");
+static_assert(OMAPX * OMAPY <= UINT16_MAX, "A terrain run must fit the whole plane");
+
+constexpr std::size_t num_squares {OMAPX * OMAPY};
+
+/// Starts a section holding \p count records; returns where to patch in its length.
+[[nodiscard]] auto begin_section(ByteWriter& out, const std::size_t count) -> std::size_t
+{
+    const auto length_offset {out.size()};
+    out.write(std::uint32_t {0});
+    out.write(static_cast<std::uint32_t>(count));
+    return length_offset;
+}
+
+void end_section(ByteWriter& out, const std::size_t length_offset)
+{
+    const auto begin {length_offset + sizeof(std::uint32_t)};
+    out.patch(length_offset, static_cast<std::uint32_t>(out.size() - begin));
+}
+
+/// Reads a section header; \p end receives the offset just past the section.
+[[nodiscard]] auto read_section(ByteReader& in, std::uint32_t& count, std::size_t& end) -> bool
+{
+    std::uint32_t length {0};
+
+    if (!in.read(length) || in.remaining() < length) {
+        return false;
+    }
+
+    end = in.offset() + length;
+    return in.read(count);
+}
+
+/// Skips whatever a newer version appended to the records of a section.
+[[nodiscard]] auto finish_section(ByteReader& in, const std::size_t end) -> bool
+{
+    return in.offset() <= end && in.skip(end - in.offset());
+}
+
+void clear_overmap(overmap& om)
+{
+    for (int i {0}; i < OMAPX; ++i) {
+        for (int j {0}; j < OMAPY; ++j) {
+            om.ter(i, j) = ot_null;
+            om.seen(i, j) = false;
+        }
+    }
+
+    om.zg.clear();
+    om.cities.clear();
+    om.roads_out.clear();
+    om.radios.clear();
+}
+} // namespace
+
+auto encode_overmap(const overmap& om) -> std::vector<char>
+{
+    ByteWriter out;
+
+    out.write_bytes(overmap_magic.data(), overmap_magic.size());
+    out.write(overmap_format_version);
+    out.write(std::uint16_t {0}); // Reserved
+
+    // Terrain, row by row, as (terrain, run length) pairs. Fields, forests and rivers make for long
+    // runs, so this is usually a small fraction of the plane.
+    const auto terrain_offset {begin_section(out, 0)};
+    std::uint32_t num_runs {0};
+
+    for (std::size_t n {0}; n < num_squares;) {
+        const auto terrain {om.t[n % OMAPX][n / OMAPX]};
+        std::uint16_t run {0};
+
+        while (n < num_squares && om.t[n % OMAPX][n / OMAPX] == terrain) {
+            ++run;
+            ++n;
+        }
+
+        out.write(static_cast<std::uint8_t>(terrain));
+        out.write(run);
+        ++num_runs;
+    }
+
+    out.patch(terrain_offset + sizeof(std::uint32_t), num_runs);
+    end_section(out, terrain_offset);
+
+    // Seen flags, one bit per square in the same order.
+    std::vector<std::uint8_t> seen((num_squares + 7) / 8);
+
+    for (std::size_t n {0}; n < num_squares; ++n) {
+        if (om.s[n % OMAPX][n / OMAPX]) {
+            seen[n / 8] |= static_cast<std::uint8_t>(1U << (n % 8));
+        }
+    }
+
+    out.write_bytes(seen.data(), seen.size());
+
+    auto section {begin_section(out, om.zg.size())};
+
+    for (const auto& group : om.zg) {
+        out.write(static_cast<std::int32_t>(group.type));
+        out.write(static_cast<std::int32_t>(group.posx));
+        out.write(static_cast<std::int32_t>(group.posy));
+        out.write(static_cast<std::uint8_t>(group.radius));
+        out.write(static_cast<std::uint32_t>(group.population));
+    }
+
+    end_section(out, section);
+    section = begin_section(out, om.cities.size());
+
+    for (const auto& city : om.cities) {
+        out.write(static_cast<std::int32_t>(city.x));
+        out.write(static_cast<std::int32_t>(city.y));
+        out.write(static_cast<std::int32_t>(city.s));
+    }
+
+    end_section(out, section);
+    section = begin_section(out, om.roads_out.size());
+
+    for (const auto& road : om.roads_out) {
+        out.write(static_cast<std::int32_t>(road.x));
+        out.write(static_cast<std::int32_t>(road.y));
+    }
+
+    end_section(out, section);
+    section = begin_section(out, om.radios.size());
+
+    for (const auto& radio : om.radios) {
+        out.write(static_cast<std::int32_t>(radio.x));
+        out.write(static_cast<std::int32_t>(radio.y));
+        out.write(static_cast<std::int32_t>(radio.strength));
+        out.write_string(radio.message);
+    }
+
+    end_section(out, section);
+    section = begin_section(out, om.notes.size());
+
+    for (const auto& note : om.notes) {
+        out.write(static_cast<std::int32_t>(note.x));
+        out.write(static_cast<std::int32_t>(note.y));
+        out.write(static_cast<std::int32_t>(note.num));
+        out.write_string(note.text);
+    }
+
+    end_section(out, section);
+    return std::move(out).bytes();
+}
+
+auto decode_overmap(const std::string_view data, overmap& om) -> bool
+{
+    if (!data.starts_with(std::string_view {overmap_magic.data(), overmap_magic.size()})) {
+        return decode_legacy_overmap(data, om);
+    }
+
+    ByteReader in {data};
+    std::uint16_t version {0};
+    std::uint16_t reserved {0};
+
+    if (!in.skip(overmap_magic.size()) || !in.read(version) || !in.read(reserved) || version == 0
+        || version > overmap_format_version) {
+        return false;
+    }
+
+    clear_overmap(om);
+    om.notes.clear();
+
+    std::uint32_t count {0};
+    std::size_t end {0};
+
+    if (!read_section(in, count, end)) {
+        return false;
+    }
+
+    std::size_t n {0};
+
+    for (std::uint32_t run {0}; run < count; ++run) {
+        std::uint8_t terrain {0};
+        std::uint16_t length {0};
+
+        if (!in.read(terrain) || !in.read(length) || terrain >= num_ter_types
+            || length > num_squares - n) {
+            return false;
+        }
+
+        for (const auto run_end {n + length}; n < run_end; ++n) {
+            om.t[n % OMAPX][n / OMAPX] = static_cast<oter_id>(terrain);
+        }
+    }
+
+    if (n != num_squares || !finish_section(in, end)) {
+        return false;
+    }
+
+    std::vector<std::uint8_t> seen((num_squares + 7) / 8);
+
+    if (!in.read_bytes(seen.data(), seen.size())) {
+        return false;
+    }
+
+    for (n = 0; n < num_squares; ++n) {
+        om.s[n % OMAPX][n / OMAPX] = (seen[n / 8] >> (n % 8) & 1U) != 0;
+    }
+
+    if (!read_section(in, count, end)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < count; ++i) {
+        std::int32_t type {0};
+        std::int32_t posx {0};
+        std::int32_t posy {0};
+        std::uint8_t radius {0};
+        std::uint32_t population {0};
+
+        if (!in.read(type) || !in.read(posx) || !in.read(posy) || !in.read(radius)
+            || !in.read(population) || type < 0 || type >= num_moncats) {
+            return false;
+        }
+
+        om.zg.emplace_back(static_cast<moncat_id>(type), posx, posy, radius, population);
+    }
+
+    if (!finish_section(in, end) || !read_section(in, count, end)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < count; ++i) {
+        std::int32_t x {0};
+        std::int32_t y {0};
+        std::int32_t s {0};
+
+        if (!in.read(x) || !in.read(y) || !in.read(s)) {
+            return false;
+        }
+
+        om.cities.emplace_back(x, y, s);
+    }
+
+    if (!finish_section(in, end) || !read_section(in, count, end)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < count; ++i) {
+        std::int32_t x {0};
+        std::int32_t y {0};
+
+        if (!in.read(x) || !in.read(y)) {
+            return false;
+        }
+
+        om.roads_out.emplace_back(x, y, 0);
+    }
+
+    if (!finish_section(in, end) || !read_section(in, count, end)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < count; ++i) {
+        radio_tower radio;
+        std::int32_t x {0};
+        std::int32_t y {0};
+        std::int32_t strength {0};
+
+        if (!in.read(x) || !in.read(y) || !in.read(strength) || !in.read_string(radio.message)) {
+            return false;
+        }
+
+        radio.x = x;
+        radio.y = y;
+        radio.strength = strength;
+        om.radios.push_back(radio);
+    }
+
+    if (!finish_section(in, end) || !read_section(in, count, end)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < count; ++i) {
+        om_note note;
+        std::int32_t x {0};
+        std::int32_t y {0};
+        std::int32_t num {0};
+
+        if (!in.read(x) || !in.read(y) || !in.read(num) || !in.read_string(note.text)) {
+            return false;
+        }
+
+        note.x = x;
+        note.y = y;
+        note.num = num;
+        om.notes.push_back(note);
+    }
+
+    return finish_section(in, end);
+}
+
+auto decode_legacy_overmap(const std::string_view data, overmap& om) -> bool
+{
+    std::istringstream fin {std::string {data}};
+    std::string line;
+    char datatype {};
+    int ct {0};
+    int cx {0};
+    int cy {0};
+    int cs {0};
+    int cp {0};
+
+    clear_overmap(om);
+    om.notes.clear();
+
+    // The terrain plane is one unbroken line of characters, offset by 32 to keep them printable.
+    for (int j {0}; j < OMAPY; ++j) {
+        for (int i {0}; i < OMAPX; ++i) {
+            const int terrain {fin.get() - 32};
+
+            if (!fin || terrain < 0 || terrain >= num_ter_types) {
+                return false;
+            }
+
+            om.t[i][j] = static_cast<oter_id>(terrain);
+        }
+    }
+
+    for (int j {0}; j < OMAPY; ++j) {
+        if (!std::getline(fin, line)) {
+            return false;
+        }
+
+        for (int i {0}; i < OMAPX; ++i) {
+            om.s[i][j] = static_cast<std::size_t>(i) < line.size() && line[i] == '1';
+        }
+    }
+
+    while (fin >> datatype) {
+        if (datatype == 'Z') {
+            fin >> ct >> cx >> cy >> cs >> cp;
+            om.zg.emplace_back(static_cast<moncat_id>(ct), cx, cy, static_cast<unsigned char>(cs),
+                               static_cast<unsigned int>(cp));
+        } else if (datatype == 'C') {
+            fin >> cx >> cy >> cs;
+            om.cities.emplace_back(cx, cy, cs);
+        } else if (datatype == 'R') {
+            fin >> cx >> cy;
+            om.roads_out.emplace_back(cx, cy, 0);
+        } else if (datatype == 'T') {
+            radio_tower radio;
+            fin >> radio.x >> radio.y >> radio.strength;
+            std::getline(fin, radio.message); // Chomp endl
+            std::getline(fin, radio.message);
+            om.radios.push_back(radio);
+        } else if (datatype == 'N') {
+            om_note note;
+            fin >> note.x >> note.y >> note.num;
+            std::getline(fin, note.text); // Chomp endl
+            std::getline(fin, note.text);
+            om.notes.push_back(note);
+        }
+    }
+
+    return true;
+}
+} // namespace oocdda
@@ -0,0 +1,56 @@
+#ifndef OOCDDA_OVERMAP_IO_HPP
+#define OOCDDA_OVERMAP_IO_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace oocdda {
+class overmap;
+
+/**
+ * \brief Tag at the start of every binary overmap record.
+ *
+ * Legacy text overmaps start with a terrain character, which is always printable, so they can
+ * never begin with this tag.
+ */
+inline constexpr std::array<char, 4> overmap_magic {'O', 'O', 'M', 'B'};
+
+/// Bumped whenever the binary layout changes; older versions are still accepted by the decoder.
+inline constexpr std::uint16_t overmap_format_version {1};
+
+/**
+ * \brief Serializes an overmap into the binary overmap format.
+ *
+ * The layout is a header (magic, version), the run-length encoded terrain plane, the seen flags
+ * packed one bit per square, and then one section each for monster groups, cities, roads out,
+ * radio towers and notes. Every section starts with its length in bytes and its record count. All
+ * integers are little-endian.
+ *
+ * The position and the NPCs are not part of the record.
+ */
+[[nodiscard]] auto encode_overmap(const overmap& om) -> std::vector<char>;
+
+/**
+ * \brief Restores an overmap from either the binary format or the legacy text format.
+ *
+ * \param data The raw contents of an overmap record.
+ * \param om The overmap to fill in. Terrain, seen flags, groups, cities, roads, radios and notes
+ * are replaced; the position is left alone.
+ *
+ * \return false if the data is truncated or not an overmap at all.
+ */
+[[nodiscard]] auto decode_overmap(std::string_view data, overmap& om) -> bool;
+
+/**
+ * \brief Restores an overmap from the original text format.
+ *
+ * Only used to import saves written before the binary format existed.
+ *
+ * \copydetails decode_overmap
+ */
+[[nodiscard]] auto decode_legacy_overmap(std::string_view data, overmap& om) -> bool;
+} // namespace oocdda
+
+#endif // OOCDDA_OVERMAP_IO_HPP
@@ -0,0 +1,176 @@
+#ifndef OOCDDA_PATH_FINDER_HPP
+#define OOCDDA_PATH_FINDER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#include "point.hpp"
+
+namespace oocdda {
+/**
+ * \brief A* search over a width by height grid where all eight neighbours are one step away.
+ *
+ * The buffers are sized once and reused, so a search allocates nothing beyond what the caller's
+ * path vector may need to grow. Squares are told apart between searches by a generation stamp
+ * rather than by clearing them.
+ */
+class PathFinder {
+public:
+    /**
+     * \param min_cost The cheapest step the cost function will ever give, used to scale the
+     * distance estimate so it never overestimates.
+     */
+    PathFinder(const int width, const int height, const int min_cost = 1)
+        : width_ {width}
+        , height_ {height}
+        , min_cost_ {min_cost}
+        , cost_(static_cast<std::size_t>(width * height))
+        , parent_(static_cast<std::size_t>(width * height))
+        , opened_(static_cast<std::size_t>(width * height))
+        , closed_(static_cast<std::size_t>(width * height))
+    {
+        open_.reserve(static_cast<std::size_t>(width * height));
+    }
+
+    /**
+     * \brief Finds the cheapest path from \p from to \p to.
+     *
+     * \param cost Called as cost(x, y) for squares inside the grid; gives the cost of stepping
+     * onto that square, or 0 if it can't be entered.
+     * \param budget Gives up after expanding this many squares.
+     * \param path Set to the squares to step onto in turn, ending with \p to; left empty if there's
+     * no path within the budget.
+     * \return Whether a path was found.
+     */
+    template<typename Cost>
+    auto find(const Point from, const Point to, const Cost& cost, const int budget,
+              std::vector<Point>& path) -> bool
+    {
+        path.clear();
+
+        if (!inside(from) || !inside(to) || from == to) {
+            return false;
+        }
+
+        ++generation_;
+        open_.clear();
+        open(cell(from), 0, -1, estimate(from, to));
+
+        for (int expanded {0}; !open_.empty() && expanded < budget;) {
+            std::pop_heap(open_.begin(), open_.end(), worse);
+            const Node node {open_.back()};
+            open_.pop_back();
+
+            if (closed_[node.cell] == generation_ || node.cost != cost_[node.cell]) {
+                continue; // Already expanded by a cheaper route
+            }
+
+            closed_[node.cell] = generation_;
+            ++expanded;
+
+            const Point here {point(node.cell)};
+
+            if (here == to) {
+                trace(node.cell, path);
+                return true;
+            }
+
+            for (int dy {-1}; dy <= 1; ++dy) {
+                for (int dx {-1}; dx <= 1; ++dx) {
+                    const Point next {here.x + dx, here.y + dy};
+
+                    if ((dx == 0 && dy == 0) || !inside(next)) {
+                        continue;
+                    }
+
+                    const std::size_t n {cell(next)};
+
+                    if (closed_[n] == generation_) {
+                        continue;
+                    }
+
+                    const int step {cost(next.x, next.y)};
+
+                    if (step <= 0) {
+                        continue;
+                    }
+
+                    const int total {node.cost + step};
+
+                    if (opened_[n] != generation_ || total < cost_[n]) {
+                        open(n, total, static_cast<int>(node.cell), total + estimate(next, to));
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+private:
+    struct Node {
+        std::size_t cell;
+        int cost;     ///< Of getting here.
+        int priority; ///< cost plus the estimate of what's left.
+    };
+
+    /// Heap order: lowest priority on top, ties going to whichever got further.
+    static auto worse(const Node& a, const Node& b) -> bool
+    {
+        return a.priority > b.priority || (a.priority == b.priority && a.cost < b.cost);
+    }
+
+    [[nodiscard]] auto inside(const Point p) const -> bool
+    {
+        return p.x >= 0 && p.x < width_ && p.y >= 0 && p.y < height_;
+    }
+
+    [[nodiscard]] auto cell(const Point p) const -> std::size_t
+    {
+        return static_cast<std::size_t>(p.y * width_ + p.x);
+    }
+
+    [[nodiscard]] auto point(const std::size_t n) const -> Point
+    {
+        return {static_cast<int>(n) % width_, static_cast<int>(n) / width_};
+    }
+
+    [[nodiscard]] auto estimate(const Point a, const Point b) const -> int
+    {
+        return std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)) * min_cost_;
+    }
+
+    void open(const std::size_t n, const int cost, const int parent, const int priority)
+    {
+        opened_[n] = generation_;
+        cost_[n] = cost;
+        parent_[n] = parent;
+        open_.push_back({n, cost, priority});
+        std::push_heap(open_.begin(), open_.end(), worse);
+    }
+
+    /// Fills \p path with the squares leading to \p n, not counting where the search began.
+    void trace(std::size_t n, std::vector<Point>& path) const
+    {
+        for (; parent_[n] != -1; n = static_cast<std::size_t>(parent_[n])) {
+            path.push_back(point(n));
+        }
+
+        std::reverse(path.begin(), path.end());
+    }
+
+    int width_;
+    int height_;
+    int min_cost_;
+    std::vector<int> cost_;
+    std::vector<int> parent_;
+    std::vector<unsigned> opened_; ///< Generation in which each square was last opened.
+    std::vector<unsigned> closed_; ///< Generation in which each square was last expanded.
+    std::vector<Node> open_;       ///< Binary heap, ordered by worse().
+    unsigned generation_ {0};
+};
+} // namespace oocdda
+
+#endif // OOCDDA_PATH_FINDER_HPP
@@ -24,6 +24,7 @@
 #include "npc.hpp"
 #include "output.hpp"
 #include "pldata.hpp"
+#include "profiler.hpp"
 #include "rng.hpp"
 #include "trap.hpp"
 
@@ -1237,7 +1238,7 @@ void player::power_bionics(Game* g)
     int b {0};
 
     do {
-        ch = getch();
+        ch = get_key();
         if (ch == '!') {
             activating = !activating;
             if (activating)
@@ -1790,6 +1791,7 @@ void player::pause()
 
 int player::hit_mon(Game* g, Monster* z)
 {
+    const RngScope scope {RngStream::combat};
     bool is_u = (this == &(g->u)); // Affects how we'll display messages
     int j;
     bool can_see = (is_u || g->u_see(posx, posy, j));
@@ -2098,6 +2100,7 @@ int player::hit_mon(Game* g, Monster* z)
 
 bool player::hit_player(player& p, body_part& bp, int& hitdam, int& hitcut)
 {
+    const RngScope scope {RngStream::combat};
     if (p.is_npc()) {
         npc* foe = dynamic_cast<npc*>(&p);
         if (foe->attitude != NPCATT_FLEE)
@@ -2619,6 +2622,7 @@ int player::addiction_level(add_type type)
 
 void player::suffer(Game* g)
 {
+    const ProfileScope profile {Phase::suffer};
     for (std::size_t i {0}; i < my_bionics.size(); ++i) {
         if (my_bionics[i].powered) {
             activate_bionic(static_cast<int>(i), g);
@@ -24,7 +24,7 @@ public:
     player();
     virtual ~player() = default;
 
-    bool create(Game* g, character_type type);
+    bool create(Game* g, character_type type, std::string tempname = "");
     int random_good_trait(character_type type);
     int random_bad_trait(character_type type);
     void normalize(Game* g); // Starting set up of HP and inventory
@@ -0,0 +1,211 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace oocdda {
+auto phase_name(const Phase phase) -> std::string_view
+{
+    switch (phase) {
+    case Phase::events:
+        return "events";
+    case Phase::fields:
+        return "fields";
+    case Phase::active_items:
+        return "active items";
+    case Phase::monsters:
+        return "monsters";
+    case Phase::npcs:
+        return "overmap npcs";
+    case Phase::suffer:
+        return "suffer";
+    case Phase::warmth:
+        return "warmth";
+    case Phase::skills:
+        return "skills";
+    case Phase::activity:
+        return "activity";
+    case Phase::input:
+        return "input";
+    case Phase::scent:
+        return "scent";
+    case Phase::map_shift:
+        return "map shift";
+    case Phase::submap_save:
+        return "submap save";
+    case Phase::submap_load:
+        return "submap load";
+    case Phase::mapgen:
+        return "mapgen";
+    case Phase::overmap_open:
+        return "overmap open";
+    case Phase::count:
+        break;
+    }
+
+    return "unknown";
+}
+
+void DurationHistogram::add(const std::uint64_t nanoseconds)
+{
+    ++buckets_[bucket_for(nanoseconds)];
+    ++count_;
+}
+
+void DurationHistogram::merge(const DurationHistogram& other)
+{
+    for (std::size_t i {0}; i < num_buckets; ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+
+    count_ += other.count_;
+}
+
+void DurationHistogram::clear()
+{
+    buckets_.fill(0);
+    count_ = 0;
+}
+
+auto DurationHistogram::lower_bound(const std::size_t index) -> std::uint64_t
+{
+    if (index < 8) {
+        return index;
+    }
+
+    if (index >= num_buckets - 1) {
+        return std::uint64_t {1} << max_octave;
+    }
+
+    const auto octave {static_cast<int>((index - 8) / 8) + 3};
+    return (8 + (index - 8) % 8) << (octave - 3);
+}
+
+auto DurationHistogram::percentile(const double fraction) const -> std::uint64_t
+{
+    if (count_ == 0) {
+        return 0;
+    }
+
+    const auto wanted {std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count_))))};
+    std::uint64_t seen {0};
+
+    for (std::size_t i {0}; i < num_buckets - 1; ++i) {
+        seen += buckets_[i];
+
+        if (seen >= wanted) {
+            return lower_bound(i + 1);
+        }
+    }
+
+    return lower_bound(num_buckets - 1);
+}
+
+Profiler::Profiler(const std::uint32_t window)
+    : window_ {window}
+{
+}
+
+void Profiler::record(const Phase phase, const std::uint64_t nanoseconds)
+{
+    Timings& timings {phases_[static_cast<std::size_t>(phase)]};
+
+    ++timings.totals.calls;
+    timings.totals.nanoseconds += nanoseconds;
+    timings.totals.longest = std::max(timings.totals.longest, nanoseconds);
+
+    if (timings.halves[timings.filling].count() >= window_) {
+        timings.filling ^= 1;
+        timings.halves[timings.filling].clear();
+    }
+
+    timings.halves[timings.filling].add(nanoseconds);
+}
+
+auto Profiler::totals(const Phase phase) const -> const Totals&
+{
+    return phases_[static_cast<std::size_t>(phase)].totals;
+}
+
+auto Profiler::recent(const Phase phase) const -> DurationHistogram
+{
+    const Timings& timings {phases_[static_cast<std::size_t>(phase)]};
+    DurationHistogram both {timings.halves[0]};
+    both.merge(timings.halves[1]);
+    return both;
+}
+
+auto Profiler::table_header() -> std::string
+{
+    std::ostringstream out;
+    out << std::left << std::setw(14) << "phase" << std::right << std::setw(10) << "calls"
+        << std::setw(12) << "total_ms" << std::setw(10) << "mean_us" << std::setw(10) << "p50_us"
+        << std::setw(10) << "p99_us" << std::setw(10) << "max_us";
+    return out.str();
+}
+
+auto Profiler::table_row(const Phase phase) const -> std::string
+{
+    const auto micro {[](const std::uint64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1000.0;
+    }};
+
+    const Totals& sums {totals(phase)};
+    const DurationHistogram histogram {recent(phase)};
+    const double mean {sums.calls == 0 ? 0.0
+                                       : micro(sums.nanoseconds) / static_cast<double>(sums.calls)};
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    out << std::left << std::setw(14) << phase_name(phase) << std::right << std::setw(10)
+        << sums.calls << std::setw(12) << micro(sums.nanoseconds) / 1000.0 << std::setw(10) << mean
+        << std::setw(10) << micro(std::min(histogram.percentile(0.5), sums.longest))
+        << std::setw(10) << micro(std::min(histogram.percentile(0.99), sums.longest))
+        << std::setw(10) << micro(sums.longest);
+    return out.str();
+}
+
+void Profiler::write(std::ostream& out) const
+{
+    out << table_header() << '\n';
+
+    for (std::size_t i {0}; i < phases_.size(); ++i) {
+        out << table_row(static_cast<Phase>(i)) << '\n';
+    }
+
+    // Then every bucket anything fell in, as "from_ns to_ns count".
+    for (std::size_t i {0}; i < phases_.size(); ++i) {
+        const auto phase {static_cast<Phase>(i)};
+        const DurationHistogram histogram {recent(phase)};
+
+        if (histogram.count() == 0) {
+            continue;
+        }
+
+        out << '\n' << phase_name(phase) << '\n';
+
+        for (std::size_t b {0}; b < DurationHistogram::num_buckets; ++b) {
+            if (histogram.bucket(b) != 0) {
+                out << DurationHistogram::lower_bound(b) << ' '
+                    << DurationHistogram::lower_bound(b + 1) << ' ' << histogram.bucket(b)
+                    << '\n';
+            }
+        }
+    }
+}
+
+void Profiler::clear()
+{
+    phases_ = {};
+}
+
+auto profiler() -> Profiler&
+{
+    static Profiler profiler;
+    return profiler;
+}
+} // namespace oocdda
@@ -0,0 +1,165 @@
+#ifndef OOCDDA_PROFILER_HPP
+#define OOCDDA_PROFILER_HPP
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace oocdda {
+/// The parts of a turn, and the map work under them, that the profiler times.
+enum class Phase {
+    events,
+    fields,
+    active_items,
+    monsters,
+    npcs,
+    suffer,
+    warmth,
+    skills,
+    activity,
+    input,
+    scent,
+    map_shift,
+    submap_save,
+    submap_load,
+    mapgen,
+    overmap_open,
+    count
+};
+
+[[nodiscard]] auto phase_name(Phase phase) -> std::string_view;
+
+/**
+ * \brief Counts durations in buckets that grow with them, eight to each doubling, so any one is
+ * placed to within an eighth wherever it falls.
+ */
+class DurationHistogram {
+public:
+    /// Durations from 2^max_octave ns, about 18 minutes, up all go in the last bucket.
+    static constexpr int max_octave {40};
+    static constexpr std::size_t num_buckets {8 + (max_octave - 3) * 8 + 1};
+
+    void add(std::uint64_t nanoseconds);
+    void merge(const DurationHistogram& other);
+    void clear();
+
+    [[nodiscard]] auto count() const -> std::uint64_t { return count_; }
+    [[nodiscard]] auto bucket(const std::size_t index) const -> std::uint32_t
+    {
+        return buckets_[index];
+    }
+
+    /// Smallest duration that can go in bucket \p index; the next bucket's is the bound above it.
+    [[nodiscard]] static auto lower_bound(std::size_t index) -> std::uint64_t;
+
+    [[nodiscard]] static auto bucket_for(const std::uint64_t nanoseconds) -> std::size_t
+    {
+        if (nanoseconds < 8) {
+            return static_cast<std::size_t>(nanoseconds);
+        }
+
+        const int octave {static_cast<int>(std::bit_width(nanoseconds)) - 1};
+
+        if (octave >= max_octave) {
+            return num_buckets - 1;
+        }
+
+        // The three bits below the top one pick the eighth.
+        const auto eighth {static_cast<std::size_t>((nanoseconds >> (octave - 3)) & 7)};
+        return 8 + static_cast<std::size_t>(octave - 3) * 8 + eighth;
+    }
+
+    /// The bound below which a \p fraction of the durations fell, rounded up to the end of its
+    /// bucket; 0 if empty.
+    [[nodiscard]] auto percentile(double fraction) const -> std::uint64_t;
+
+private:
+    std::array<std::uint32_t, num_buckets> buckets_ {};
+    std::uint64_t count_ {0};
+};
+
+/**
+ * \brief Times the phases of every turn, keeping totals and a histogram of the recent ones.
+ *
+ * Each phase's histogram covers its last window to two windows of timings: the timings fill one
+ * half, and once it holds a window's worth the older half is cleared to take the next ones.
+ * Phases nest, so e.g. input includes any map shifts it leads to.
+ */
+class Profiler {
+public:
+    struct Totals {
+        std::uint64_t calls {0};
+        std::uint64_t nanoseconds {0};
+        std::uint64_t longest {0};
+    };
+
+    explicit Profiler(std::uint32_t window = 1024);
+
+    void record(Phase phase, std::uint64_t nanoseconds);
+
+    /// Since the start, or the last clear().
+    [[nodiscard]] auto totals(Phase phase) const -> const Totals&;
+
+    /// The recent timings of \p phase.
+    [[nodiscard]] auto recent(Phase phase) const -> DurationHistogram;
+
+    /// A table of every phase, then the recent histogram of each, for reading or diffing.
+    void write(std::ostream& out) const;
+
+    /// The column headings of write()'s table, and the row of it for \p phase, without newlines.
+    [[nodiscard]] static auto table_header() -> std::string;
+    [[nodiscard]] auto table_row(Phase phase) const -> std::string;
+
+    /// How many timings of each phase the recent histograms keep at least; at most twice that.
+    [[nodiscard]] auto window() const -> std::uint32_t { return window_; }
+
+    void clear();
+
+private:
+    struct Timings {
+        Totals totals;
+        std::array<DurationHistogram, 2> halves;
+        std::size_t filling {0};
+    };
+
+    std::uint32_t window_;
+    std::array<Timings, static_cast<std::size_t>(Phase::count)> phases_;
+};
+
+/// The profiler every ProfileScope reports to.
+[[nodiscard]] auto profiler() -> Profiler&;
+
+/// Times \p phase from construction until it goes out of scope.
+class ProfileScope {
+public:
+    explicit ProfileScope(const Phase phase)
+        : phase_ {phase}
+        , start_ {std::chrono::steady_clock::now()}
+    {
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope(ProfileScope&&) = delete;
+    auto operator=(const ProfileScope&) -> ProfileScope& = delete;
+    auto operator=(ProfileScope&&) -> ProfileScope& = delete;
+
+    ~ProfileScope()
+    {
+        const auto taken {std::chrono::steady_clock::now() - start_};
+        profiler().record(phase_,
+                          static_cast<std::uint64_t>(
+                              std::chrono::duration_cast<std::chrono::nanoseconds>(taken).count()));
+    }
+
+private:
+    Phase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+} // namespace oocdda
+
+#endif // OOCDDA_PROFILER_HPP
@@ -0,0 +1,368 @@
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "region_store.hpp"
+
+#include "async_record_store.hpp"
+#include "io_worker.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oocdda {
+namespace {
+static_assert(std::endian::native == std::endian::little, "Region files are little-endian");
+
+constexpr std::array<char, 4> region_magic {'O', 'R', 'E', 'G'};
+constexpr std::uint16_t region_format_version {1};
+// Slots grow in steps of this many bytes, so records that change size a little stay in place.
+constexpr std::uint32_t slot_granularity {512};
+
+struct RegionHeader {
+    std::array<char, 4> magic;
+    std::uint16_t version;
+    std::uint16_t reserved;
+    std::uint32_t num_slots;
+    std::uint32_t padding;
+};
+
+struct SlotEntry {
+    std::uint64_t offset;
+    std::uint32_t length;
+    std::uint32_t capacity;
+};
+
+static_assert(sizeof(RegionHeader) == 16);
+static_assert(sizeof(SlotEntry) == 16);
+
+[[nodiscard]] constexpr auto floor_div(const int value, const int divisor) noexcept -> int
+{
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+[[nodiscard]] auto system_error(const std::string& what, const std::filesystem::path& path)
+    -> std::runtime_error
+{
+    return std::runtime_error(what + " '" + path.string() + "': " + std::strerror(errno));
+}
+
+/// Reads the `<x>.<y>.<z>` of a legacy record file name; std::nullopt if \p name isn't one.
+[[nodiscard]] auto parse_legacy_key(std::string_view name) -> std::optional<RecordKey>
+{
+    std::array<int, 3> coordinates {};
+
+    for (std::size_t i {0}; i < coordinates.size(); ++i) {
+        if (i > 0) {
+            if (!name.starts_with('.')) {
+                return std::nullopt;
+            }
+
+            name.remove_prefix(1);
+        }
+
+        const auto [next, error] {
+            std::from_chars(name.data(), name.data() + name.size(), coordinates[i])};
+
+        if (error != std::errc {}) {
+            return std::nullopt;
+        }
+
+        name.remove_prefix(static_cast<std::size_t>(next - name.data()));
+    }
+
+    if (!name.empty()) {
+        return std::nullopt;
+    }
+
+    return RecordKey {coordinates[0], coordinates[1], coordinates[2]};
+}
+} // namespace
+
+class RegionStore::RegionFile {
+public:
+    RegionFile(const std::filesystem::path& path, const std::uint32_t num_slots, const bool create)
+        : path_ {path}
+    {
+        fd_ = ::open(path.c_str(), create ? O_RDWR | O_CREAT : O_RDWR, 0644);
+
+        if (fd_ < 0) {
+            throw system_error("Failed to open region file", path_);
+        }
+
+        struct stat info {};
+
+        if (::fstat(fd_, &info) != 0) {
+            ::close(fd_);
+            throw system_error("Failed to stat region file", path_);
+        }
+
+        const auto index_end {sizeof(RegionHeader) + num_slots * sizeof(SlotEntry)};
+
+        if (info.st_size == 0) {
+            // Fresh file: the zero-filled index already means "every slot empty".
+            resize(index_end);
+            const RegionHeader header {region_magic, region_format_version, 0, num_slots, 0};
+            std::memcpy(data_, &header, sizeof(header));
+            return;
+        }
+
+        map(static_cast<std::size_t>(info.st_size));
+        RegionHeader header {};
+        std::memcpy(&header, data_, sizeof(header));
+
+        if (size_ < index_end || header.magic != region_magic
+            || header.version != region_format_version || header.num_slots != num_slots) {
+            unmap();
+            ::close(fd_);
+            throw std::runtime_error("'" + path_.string() + "' is not a valid region file");
+        }
+    }
+
+    RegionFile(const RegionFile&) = delete;
+    RegionFile(RegionFile&&) = delete;
+    auto operator=(const RegionFile&) -> RegionFile& = delete;
+    auto operator=(RegionFile&&) -> RegionFile& = delete;
+
+    ~RegionFile()
+    {
+        flush();
+        unmap();
+        ::close(fd_);
+    }
+
+    [[nodiscard]] auto read(const int slot) const -> std::optional<std::string_view>
+    {
+        const auto entry {slot_entry(slot)};
+
+        if (entry.capacity == 0) {
+            return std::nullopt;
+        }
+
+        return std::string_view {data_ + entry.offset, entry.length};
+    }
+
+    void write(const int slot, const std::string_view record)
+    {
+        auto entry {slot_entry(slot)};
+
+        if (entry.capacity == 0 || record.size() > entry.capacity) {
+            // Outgrown (or never allocated): move the slot to the end of the file. The old space
+            // is simply abandoned; records rarely grow once a submap has been visited.
+            entry.offset = size_;
+            entry.capacity = static_cast<std::uint32_t>(
+                (record.size() / slot_granularity + 1) * slot_granularity);
+            resize(size_ + entry.capacity);
+        }
+
+        entry.length = static_cast<std::uint32_t>(record.size());
+        std::memcpy(data_ + entry.offset, record.data(), record.size());
+        std::memcpy(data_ + entry_offset(slot), &entry, sizeof(entry));
+    }
+
+    void flush() const
+    {
+        if (data_ != nullptr) {
+            ::msync(data_, size_, MS_ASYNC);
+        }
+    }
+
+private:
+    [[nodiscard]] static auto entry_offset(const int slot) -> std::size_t
+    {
+        return sizeof(RegionHeader) + static_cast<std::size_t>(slot) * sizeof(SlotEntry);
+    }
+
+    [[nodiscard]] auto slot_entry(const int slot) const -> SlotEntry
+    {
+        SlotEntry entry {};
+        std::memcpy(&entry, data_ + entry_offset(slot), sizeof(entry));
+        return entry;
+    }
+
+    void resize(const std::size_t new_size)
+    {
+        unmap();
+
+        if (::ftruncate(fd_, static_cast<off_t>(new_size)) != 0) {
+            throw system_error("Failed to grow region file", path_);
+        }
+
+        map(new_size);
+    }
+
+    void map(const std::size_t size)
+    {
+        void* const mapping {::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0)};
+
+        if (mapping == MAP_FAILED) {
+            throw system_error("Failed to map region file", path_);
+        }
+
+        data_ = static_cast<char*>(mapping);
+        size_ = size;
+    }
+
+    void unmap()
+    {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    std::filesystem::path path_;
+    int fd_ {-1};
+    char* data_ {nullptr};
+    std::size_t size_ {0};
+};
+
+RegionStore::RegionStore(std::filesystem::path directory, std::string prefix, const int region_size)
+    : directory_ {std::move(directory)}
+    , prefix_ {std::move(prefix)}
+    , region_size_ {region_size}
+{
+    if (region_size_ <= 0) {
+        throw std::invalid_argument("Region size must be positive");
+    }
+}
+
+RegionStore::~RegionStore() = default;
+
+auto RegionStore::contains(const RecordKey& key) -> bool { return load(key).has_value(); }
+
+auto RegionStore::load(const RecordKey& key) -> std::optional<std::string_view>
+{
+    open();
+    const auto* const region {region_for(key, /*create=*/false)};
+
+    if (region == nullptr) {
+        return std::nullopt;
+    }
+
+    return region->read(slot_for(key));
+}
+
+void RegionStore::store(const RecordKey& key, const std::string_view data)
+{
+    open();
+    region_for(key, /*create=*/true)->write(slot_for(key), data);
+}
+
+void RegionStore::flush()
+{
+    for (const auto& [key, region] : regions_) {
+        region->flush();
+    }
+}
+
+void RegionStore::close()
+{
+    flush();
+    regions_.clear();
+    missing_regions_.clear();
+    open_ = false;
+}
+
+void RegionStore::open()
+{
+    if (open_) {
+        return;
+    }
+
+    open_ = true;
+    // Listed first: importing adds region files to the same directory.
+    std::vector<std::pair<RecordKey, std::filesystem::path>> legacy;
+    std::error_code error;
+
+    for (const auto& entry : std::filesystem::directory_iterator {directory_, error}) {
+        const auto name {entry.path().filename().string()};
+
+        if (!name.starts_with(prefix_ + ".") || !entry.is_regular_file()) {
+            continue;
+        }
+
+        if (const auto key {parse_legacy_key(std::string_view {name}.substr(prefix_.size() + 1))}) {
+            legacy.emplace_back(*key, entry.path());
+        }
+    }
+
+    for (const auto& [key, path] : legacy) {
+        if (contains(key)) {
+            continue;
+        }
+
+        std::ifstream fin {path, std::ios::binary};
+        const std::string data {std::istreambuf_iterator<char> {fin},
+                                std::istreambuf_iterator<char> {}};
+        fin.close();
+        store(key, data);
+        std::filesystem::remove(path);
+    }
+}
+
+auto RegionStore::region_for(const RecordKey& key, const bool create) -> RegionFile*
+{
+    const RecordKey region_key {floor_div(key.x, region_size_), floor_div(key.y, region_size_),
+                                key.z};
+
+    if (const auto it {regions_.find(region_key)}; it != regions_.end()) {
+        return it->second.get();
+    }
+
+    if (!create && missing_regions_.contains(region_key)) {
+        return nullptr;
+    }
+
+    const auto path {directory_
+                     / (prefix_ + "." + std::to_string(region_key.x) + "."
+                        + std::to_string(region_key.y) + "." + std::to_string(region_key.z)
+                        + ".region")};
+
+    if (!create && !std::filesystem::exists(path)) {
+        missing_regions_.insert(region_key);
+        return nullptr;
+    }
+
+    missing_regions_.erase(region_key);
+
+    const auto num_slots {static_cast<std::uint32_t>(region_size_ * region_size_)};
+    auto region {std::make_unique<RegionFile>(path, num_slots, create)};
+    return regions_.emplace(region_key, std::move(region)).first->second.get();
+}
+
+auto RegionStore::slot_for(const RecordKey& key) const -> int
+{
+    const int local_x {key.x - floor_div(key.x, region_size_) * region_size_};
+    const int local_y {key.y - floor_div(key.y, region_size_) * region_size_};
+    return local_x + local_y * region_size_;
+}
+
+auto submap_records() -> RecordStore&
+{
+    static RegionStore regions {"save", "m", 32};
+    static AsyncRecordStore store {regions, io_worker()};
+    return store;
+}
+
+auto overmap_records() -> RecordStore&
+{
+    static RegionStore regions {"save", "o", 4};
+    static AsyncRecordStore store {regions, io_worker()};
+    return store;
+}
+} // namespace oocdda
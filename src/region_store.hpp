@@ -0,0 +1,122 @@
+#ifndef OOCDDA_REGION_STORE_HPP
+#define OOCDDA_REGION_STORE_HPP
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace oocdda {
+/// Identifies one persisted record, e.g. a submap or an overmap, by its world coordinates.
+struct RecordKey {
+    constexpr auto operator<=>(const RecordKey&) const noexcept = default;
+
+    int x {0};
+    int y {0};
+    int z {0};
+};
+
+/**
+ * \brief Keyed storage for serialized world data.
+ *
+ * Map and overmap persistence only talk to this interface, so the on-disk layout can change
+ * without touching the game code.
+ */
+class RecordStore {
+public:
+    RecordStore() = default;
+    RecordStore(const RecordStore&) = delete;
+    RecordStore(RecordStore&&) = delete;
+    auto operator=(const RecordStore&) -> RecordStore& = delete;
+    auto operator=(RecordStore&&) -> RecordStore& = delete;
+    virtual ~RecordStore() = default;
+
+    [[nodiscard]] virtual auto contains(const RecordKey& key) -> bool = 0;
+
+    /**
+     * \brief Looks up a record.
+     *
+     * \return A view of the stored bytes, or std::nullopt if nothing was stored under \p key. The
+     * view is only valid until the next call on this store.
+     */
+    [[nodiscard]] virtual auto load(const RecordKey& key) -> std::optional<std::string_view> = 0;
+
+    /// Stores \p data under \p key, replacing any previous record.
+    virtual void store(const RecordKey& key, std::string_view data) = 0;
+
+    /// Pushes all stored records to disk.
+    virtual void flush() = 0;
+
+    /// Hints that \p key will be loaded soon. Stores that cannot read ahead ignore it.
+    virtual void prefetch([[maybe_unused]] const RecordKey& key) { }
+
+    /// Flushes, then lets go of open files and anything held in memory, so later calls start
+    /// afresh from disk.
+    virtual void close() { flush(); }
+};
+
+/**
+ * \brief A RecordStore that packs a square block of records into one memory-mapped file.
+ *
+ * Each region file holds a fixed index of `region_size * region_size` slots followed by the record
+ * data. Loading is a lookup in the mapped index; storing copies into the slot, moving it to the end
+ * of the file only when the record outgrows its current capacity.
+ *
+ * Older versions saved each record in a file of its own, `<prefix>.<x>.<y>.<z>`. The first call
+ * after construction or close() moves any such files in the directory into the store.
+ */
+class RegionStore final : public RecordStore {
+public:
+    /**
+     * \param directory Where the region files live.
+     * \param prefix Distinguishes stores sharing a directory; region files are named
+     * `<prefix>.<rx>.<ry>.<z>.region`.
+     * \param region_size Records per region side.
+     */
+    RegionStore(std::filesystem::path directory, std::string prefix, int region_size);
+    RegionStore(const RegionStore&) = delete;
+    RegionStore(RegionStore&&) = delete;
+    auto operator=(const RegionStore&) -> RegionStore& = delete;
+    auto operator=(RegionStore&&) -> RegionStore& = delete;
+    ~RegionStore() override;
+
+    [[nodiscard]] auto contains(const RecordKey& key) -> bool override;
+    [[nodiscard]] auto load(const RecordKey& key) -> std::optional<std::string_view> override;
+    void store(const RecordKey& key, std::string_view data) override;
+    void flush() override;
+    void close() override;
+
+private:
+    class RegionFile;
+
+    /// Imports the legacy per-record files, once per open.
+    void open();
+    /// Returns the region holding \p key, opening (and creating, if \p create) it as needed.
+    [[nodiscard]] auto region_for(const RecordKey& key, bool create) -> RegionFile*;
+    [[nodiscard]] auto slot_for(const RecordKey& key) const -> int;
+
+    std::filesystem::path directory_;
+    std::string prefix_;
+    int region_size_;
+    bool open_ {false};
+    std::map<RecordKey, std::unique_ptr<RegionFile>> regions_;
+    // Regions with no file yet, so a miss is only looked up on disk once.
+    std::set<RecordKey> missing_regions_;
+};
+
+/**
+ * \brief The store holding every submap of the current world, 32x32 submaps per region file.
+ *
+ * Writes and prefetches run on io_worker().
+ */
+[[nodiscard]] auto submap_records() -> RecordStore&;
+
+/// The store holding every overmap of the current world, 4x4 overmaps per region file, also
+/// written in the background.
+[[nodiscard]] auto overmap_records() -> RecordStore&;
+} // namespace oocdda
+
+#endif // OOCDDA_REGION_STORE_HPP
@@ -1,26 +1,44 @@
-#include <cstdlib>
-
 #include "rng.hpp"
 
 namespace oocdda {
-long rng(long low, long high)
+namespace {
+using Streams = std::array<Rng, static_cast<std::size_t>(RngStream::count)>;
+
+auto seeded(const std::uint64_t seed) -> Streams
+{
+    Streams seeded;
+
+    for (std::size_t i {0}; i < seeded.size(); ++i) {
+        // Rng::seed() scrambles, so neighbouring seeds still give unrelated streams.
+        seeded[i].seed(seed + i * 0x632be59bd9b4e019);
+    }
+
+    return seeded;
+}
+
+Streams streams {seeded(0)};
+} // namespace
+
+Rng* detail::active_rng {&streams[static_cast<std::size_t>(RngStream::general)]};
+
+void seed_rng(const std::uint64_t seed)
 {
-    return low + long((high - low + 1) * double(rand() / double(RAND_MAX + 1.0)));
+    streams = seeded(seed);
 }
 
-bool one_in(int chance)
+auto rng_stream(const RngStream stream) -> Rng&
 {
-    if (chance <= 1 || rng(0, chance - 1) == 0)
-        return true;
-    return false;
+    return streams[static_cast<std::size_t>(stream)];
 }
 
-int dice(int number, int sides)
+RngScope::RngScope(const RngStream stream)
+    : previous_ {detail::active_rng}
 {
-    int ret = 0;
-    for (int i = 0; i < number; i++) {
-        ret += rng(1, sides);
-    }
-    return ret;
+    detail::active_rng = &rng_stream(stream);
+}
+
+RngScope::~RngScope()
+{
+    detail::active_rng = previous_;
 }
 } // namespace oocdda
@@ -1,10 +1,205 @@
 #ifndef OOCDDA_RNG_HPP
 #define OOCDDA_RNG_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
 namespace oocdda {
-long rng(long low, long high);
-bool one_in(int chance);
-int dice(int number, int sides);
+/**
+ * \brief A small, fast, seedable random number engine (xoshiro256**).
+ *
+ * Satisfies UniformRandomBitGenerator, so it also works with the <random> distributions. The same
+ * seed always gives the same draws, on every platform.
+ */
+class Rng {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Rng(const std::uint64_t seed = 0) { this->seed(seed); }
+
+    void seed(std::uint64_t seed)
+    {
+        // SplitMix64 spreads even a seed of 0 over the whole state, which must not be all zeroes.
+        for (auto& word : state_) {
+            seed += 0x9e3779b97f4a7c15;
+            std::uint64_t z {seed};
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr auto min() -> result_type { return 0; }
+    static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    auto operator()() -> result_type
+    {
+        const std::uint64_t result {rotl(state_[1] * 5, 7) * 9};
+        const std::uint64_t t {state_[1] << 17};
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    /**
+     * \brief A number from \p low to \p high inclusive, every one equally likely.
+     *
+     * Reversed bounds give what the old rand() formula did: \p low, or down to \p high + 2.
+     */
+    auto range(const long low, const long high) -> long
+    {
+        if (high < low) {
+            const long span {low - high - 1};
+            const auto drop {span <= 0 ? 0 : below(static_cast<std::uint64_t>(span))};
+            return low - static_cast<long>(drop);
+        }
+
+        const std::uint64_t span {width(low, high)};
+        // span is 0 only if it covers every long.
+        return span == 0 ? static_cast<long>((*this)()) : low + static_cast<long>(below(span));
+    }
+
+    /// True one time in \p chance; always for \p chance of 1 or less.
+    auto one_in(const int chance) -> bool
+    {
+        return chance <= 1 || below(static_cast<std::uint64_t>(chance)) == 0;
+    }
+
+    /// The total of \p number rolls of a die with \p sides sides.
+    auto dice(const int number, const int sides) -> int
+    {
+        int total {0};
+
+        for (int i {0}; i < number; ++i) {
+            total += static_cast<int>(range(1, sides));
+        }
+
+        return total;
+    }
+
+    /// A number in [\p low, \p high).
+    auto real(const double low, const double high) -> double
+    {
+        // The top 53 bits, as many as a double holds.
+        return low + (high - low) * static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    /// Fills \p out with range(\p low, \p high) draws, for loops that want many at once.
+    void fill(const long low, const long high, const std::span<int> out)
+    {
+        if (high < low || width(low, high) - 1 >= 0xffffffff) {
+            for (auto& value : out) {
+                value = static_cast<int>(range(low, high));
+            }
+            return;
+        }
+
+        const auto span {static_cast<std::uint32_t>(width(low, high))};
+        const std::uint32_t threshold {(0U - span) % span}; // Worked out once for the lot
+
+        for (auto& value : out) {
+            value = static_cast<int>(low + below32(span, threshold));
+        }
+    }
+
+private:
+    /// How many numbers \p low to \p high covers, for \p low <= \p high; 0 for all of them.
+    static auto width(const long low, const long high) -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(high) - static_cast<std::uint64_t>(low) + 1;
+    }
+
+    static auto rotl(const std::uint64_t x, const int k) -> std::uint64_t
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    /// Uniform in [0, \p n), \p n > 0.
+    auto below(const std::uint64_t n) -> std::uint64_t
+    {
+        if (n <= 0xffffffff) {
+            const auto n32 {static_cast<std::uint32_t>(n)};
+            return below32(n32, (0U - n32) % n32);
+        }
+
+        // Wider than anything the game asks for; plain rejection sampling will do.
+        const std::uint64_t limit {max() - max() % n};
+        std::uint64_t x {(*this)()};
+
+        while (x >= limit) {
+            x = (*this)();
+        }
+
+        return x % n;
+    }
+
+    /**
+     * \brief Uniform in [0, \p n) by Lemire's multiply-and-shift, which needs no division unless
+     * the draw lands in the biased sliver below \p threshold, 2^32 mod \p n.
+     */
+    auto below32(const std::uint32_t n, const std::uint32_t threshold) -> std::uint32_t
+    {
+        std::uint64_t m {((*this)() >> 32) * n};
+
+        while (static_cast<std::uint32_t>(m) < threshold) {
+            m = ((*this)() >> 32) * n;
+        }
+
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+    std::array<std::uint64_t, 4> state_ {};
+};
+
+/// Independent sequences, so that e.g. how a fight goes doesn't change what the next town looks
+/// like.
+enum class RngStream {
+    general,
+    mapgen,
+    overmap,
+    combat,
+    ai,
+    count
+};
+
+/// Reseeds every stream from \p seed.
+void seed_rng(std::uint64_t seed);
+auto rng_stream(RngStream stream) -> Rng&;
+
+namespace detail {
+extern Rng* active_rng;
+} // namespace detail
+
+/// Sends rng(), one_in() and dice() to \p stream until it goes out of scope.
+class RngScope {
+public:
+    explicit RngScope(RngStream stream);
+    RngScope(const RngScope&) = delete;
+    RngScope(RngScope&&) = delete;
+    auto operator=(const RngScope&) -> RngScope& = delete;
+    auto operator=(RngScope&&) -> RngScope& = delete;
+    ~RngScope();
+
+private:
+    Rng* previous_;
+};
+
+inline long rng(long low, long high) { return detail::active_rng->range(low, high); }
+inline bool one_in(int chance) { return detail::active_rng->one_in(chance); }
+inline int dice(int number, int sides) { return detail::active_rng->dice(number, sides); }
+inline double rng_float(double low, double high) { return detail::active_rng->real(low, high); }
+inline void rng_fill(long low, long high, std::span<int> out)
+{
+    detail::active_rng->fill(low, high, out);
+}
 } // namespace oocdda
 
 #endif // OOCDDA_RNG_HPP
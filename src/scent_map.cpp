@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "scent_map.hpp"
+
+namespace oocdda {
+namespace {
+/// Adds \p neighbour to the running sum if it smells at least as strongly as \p centre.
+inline void gather(const int centre, const int neighbour, int& sum, int& used)
+{
+    const int taken {neighbour >= centre ? 1 : 0};
+    sum += neighbour & -taken;
+    used += taken;
+}
+} // namespace
+
+ScentMap::ScentMap(const int width, const int height)
+    : width_ {width}
+    , height_ {height}
+    , stride_ {width + 2}
+{
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Scent map dimensions must be positive");
+    }
+
+    const auto size {static_cast<std::size_t>(stride_ * (height + 2))};
+    current_.resize(size);
+    next_.resize(size);
+    spreads_.resize(size);
+    floors_.resize(size, no_floor);
+}
+
+void ScentMap::clear()
+{
+    std::fill(current_.begin(), current_.end(), 0);
+}
+
+void ScentMap::set_square(const int x, const int y, const bool spreads, const int floor)
+{
+    spreads_[cell(x, y)] = spreads ? 1 : 0;
+    floors_[cell(x, y)] = floor;
+}
+
+void ScentMap::shift(const int dx, const int dy)
+{
+    for (int y {0}; y < height_; ++y) {
+        for (int x {0}; x < width_; ++x) {
+            const int fromx {x + dx};
+            const int fromy {y + dy};
+            const bool inside {fromx >= 0 && fromx < width_ && fromy >= 0 && fromy < height_};
+            next_[cell(x, y)] = inside ? current_[cell(fromx, fromy)] : 0;
+        }
+    }
+
+    std::swap(current_, next_);
+}
+
+auto ScentMap::diffuse() -> int
+{
+    int reset {0};
+
+    for (int y {0}; y < height_; ++y) {
+        const int* const above {&current_[cell(0, y - 1)]};
+        const int* const row {&current_[cell(0, y)]};
+        const int* const below {&current_[cell(0, y + 1)]};
+        const std::int32_t* const spreads {&spreads_[cell(0, y)]};
+        const int* const floors {&floors_[cell(0, y)]};
+        int* const out {&next_[cell(0, y)]};
+
+        // Branch-free apart from the rare reset, so the compiler can vectorize it across the row.
+        for (int x {0}; x < width_; ++x) {
+            const int centre {row[x]};
+            int sum {0};
+            int used {0};
+
+            gather(centre, above[x - 1], sum, used);
+            gather(centre, above[x], sum, used);
+            gather(centre, above[x + 1], sum, used);
+            gather(centre, row[x - 1], sum, used);
+            gather(centre, centre, sum, used);
+            gather(centre, row[x + 1], sum, used);
+            gather(centre, below[x - 1], sum, used);
+            gather(centre, below[x], sum, used);
+            gather(centre, below[x + 1], sum, used);
+
+            // A double quotient is exact enough for any int sum over at most ten to truncate to
+            // the same value as integer division, and unlike it has a vector instruction.
+            int scent {static_cast<int>(static_cast<double>(sum & -spreads[x])
+                                        / static_cast<double>((used & -spreads[x]) + 1))};
+            scent = std::max(scent, floors[x]);
+
+            if (scent > max_scent) {
+                scent = 0;
+                ++reset;
+            }
+
+            out[x] = scent;
+        }
+    }
+
+    std::swap(current_, next_);
+    return reset;
+}
+} // namespace oocdda
@@ -0,0 +1,80 @@
+#ifndef OOCDDA_SCENT_MAP_HPP
+#define OOCDDA_SCENT_MAP_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace oocdda {
+/**
+ * \brief How strongly each square of the active map smells of the player, and how that spreads.
+ *
+ * Scent is kept in two row-major buffers padded with a border of unscented squares, so the
+ * diffusion kernel reads every neighbour without bounds checks and writes its result into the
+ * other buffer. Which squares let scent in, and the floor slime keeps them at, are set per square
+ * before each step rather than looked up from the map nine times per square.
+ */
+class ScentMap {
+public:
+    /// Diffusion resets any square above this; something has gone wrong if it's ever reached.
+    static constexpr int max_scent {10000};
+
+    /// The floor of a square without slime.
+    static constexpr int no_floor {INT_MIN};
+
+    ScentMap(int width, int height);
+
+    [[nodiscard]] auto width() const -> int { return width_; }
+    [[nodiscard]] auto height() const -> int { return height_; }
+
+    /// The scent at (\p x, \p y), which must be on the map.
+    [[nodiscard]] auto at(int x, int y) -> int& { return current_[cell(x, y)]; }
+    [[nodiscard]] auto at(int x, int y) const -> int { return current_[cell(x, y)]; }
+
+    void clear();
+
+    /**
+     * \brief Sets how (\p x, \p y) takes part in the next diffuse().
+     *
+     * \param spreads false for squares scent can't get into, i.e. impassable and unbashable ones.
+     * \param floor The least scent the square is left with, or no_floor.
+     */
+    void set_square(int x, int y, bool spreads, int floor);
+
+    /**
+     * \brief Moves the scent \p dx squares left and \p dy squares up, as when the map shifts.
+     *
+     * Squares uncovered at the far edges start out unscented.
+     */
+    void shift(int dx, int dy);
+
+    /**
+     * \brief Spreads the scent by one step.
+     *
+     * Each square that lets scent in becomes the average of itself and those of its eight
+     * neighbours that smell at least as strongly, divided by one more than their count and
+     * truncated; squares off the map count as unscented. Other squares lose their scent. The
+     * result is then raised to the square's floor.
+     *
+     * \return How many squares came out above max_scent and were reset to 0.
+     */
+    auto diffuse() -> int;
+
+private:
+    [[nodiscard]] auto cell(const int x, const int y) const -> std::size_t
+    {
+        return static_cast<std::size_t>((y + 1) * stride_ + x + 1);
+    }
+
+    int width_;
+    int height_;
+    int stride_; ///< Row length including the border.
+    std::vector<int> current_;
+    std::vector<int> next_;
+    std::vector<std::int32_t> spreads_; ///< 1 or 0, laid out like the scent.
+    std::vector<int> floors_;
+};
+} // namespace oocdda
+
+#endif // OOCDDA_SCENT_MAP_HPP
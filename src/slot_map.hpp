@@ -0,0 +1,140 @@
+#ifndef OOCDDA_SLOT_MAP_HPP
+#define OOCDDA_SLOT_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace oocdda {
+/// Names one element of a SlotMap for as long as it lives; a default-constructed one names none.
+struct SlotHandle {
+    constexpr auto operator==(const SlotHandle&) const noexcept -> bool = default;
+
+    std::uint32_t slot {0};
+    std::uint32_t generation {0}; ///< 0 is never handed out.
+};
+
+/**
+ * \brief A vector whose elements can also be reached through handles that survive erasing.
+ *
+ * Elements are kept densely, in a std::vector, and are indexed and iterated like one. Erasing
+ * moves the last element into the gap, so it costs the same however many there are, but the
+ * order isn't kept and the last element changes index. Handles go through a table of slots that
+ * follows every move; a slot's generation goes up when its element is erased, so handles to it
+ * then find nothing rather than whatever took its place.
+ */
+template<typename T>
+class SlotMap {
+public:
+    [[nodiscard]] auto size() const -> std::size_t { return dense_.size(); }
+    [[nodiscard]] auto empty() const -> bool { return dense_.empty(); }
+
+    [[nodiscard]] auto operator[](const std::size_t index) -> T& { return dense_[index]; }
+    [[nodiscard]] auto operator[](const std::size_t index) const -> const T&
+    {
+        return dense_[index];
+    }
+
+    [[nodiscard]] auto begin() { return dense_.begin(); }
+    [[nodiscard]] auto end() { return dense_.end(); }
+    [[nodiscard]] auto begin() const { return dense_.begin(); }
+    [[nodiscard]] auto end() const { return dense_.end(); }
+
+    /// The elements in index order.
+    [[nodiscard]] auto dense() const -> const std::vector<T>& { return dense_; }
+
+    /// Appends \p value, which gets index size() - 1.
+    auto push_back(T value) -> SlotHandle
+    {
+        std::uint32_t slot {0};
+
+        if (free_.empty()) {
+            slot = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back({0, 1});
+        } else {
+            slot = free_.back();
+            free_.pop_back();
+        }
+
+        slots_[slot].index = static_cast<std::uint32_t>(dense_.size());
+        dense_.push_back(std::move(value));
+        owners_.push_back(slot);
+        return {slot, slots_[slot].generation};
+    }
+
+    /// Erases the element at \p index, moving the last element there.
+    void erase(const std::size_t index)
+    {
+        const std::uint32_t slot {owners_[index]};
+        const std::size_t last {dense_.size() - 1};
+
+        if (index != last) {
+            dense_[index] = std::move(dense_[last]);
+            owners_[index] = owners_[last];
+            slots_[owners_[index]].index = static_cast<std::uint32_t>(index);
+        }
+
+        dense_.pop_back();
+        owners_.pop_back();
+        release(slot);
+    }
+
+    void clear()
+    {
+        for (const auto slot : owners_) {
+            release(slot);
+        }
+
+        dense_.clear();
+        owners_.clear();
+    }
+
+    [[nodiscard]] auto handle(const std::size_t index) const -> SlotHandle
+    {
+        const std::uint32_t slot {owners_[index]};
+        return {slot, slots_[slot].generation};
+    }
+
+    /// Index of the element \p handle names; -1 if it's been erased.
+    [[nodiscard]] auto index_of(const SlotHandle handle) const -> int
+    {
+        if (handle.slot >= slots_.size() || handle.generation == 0
+            || slots_[handle.slot].generation != handle.generation) {
+            return -1;
+        }
+
+        return static_cast<int>(slots_[handle.slot].index);
+    }
+
+    /// The element \p handle names; nullptr if it's been erased.
+    [[nodiscard]] auto get(const SlotHandle handle) -> T*
+    {
+        const int index {index_of(handle)};
+        return index < 0 ? nullptr : &dense_[static_cast<std::size_t>(index)];
+    }
+
+private:
+    struct Slot {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+    void release(const std::uint32_t slot)
+    {
+        // Skipping 0 keeps default handles from ever matching.
+        if (++slots_[slot].generation == 0) {
+            slots_[slot].generation = 1;
+        }
+
+        free_.push_back(slot);
+    }
+
+    std::vector<T> dense_;
+    std::vector<std::uint32_t> owners_; ///< Slot of each element, by index.
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> free_; ///< Slots with no element, to be reused.
+};
+} // namespace oocdda
+
+#endif // OOCDDA_SLOT_MAP_HPP
@@ -0,0 +1,95 @@
+#include <stdexcept>
+#include <utility>
+
+#include "submap_cache.hpp"
+
+#include "submap_io.hpp"
+
+namespace oocdda {
+SubmapCache::SubmapCache(RecordStore& store, const std::size_t capacity)
+    : store_ {store}
+    , capacity_ {capacity}
+{
+    if (capacity_ == 0) {
+        throw std::invalid_argument("Submap cache capacity must be positive");
+    }
+}
+
+SubmapCache::~SubmapCache() { flush(); }
+
+auto SubmapCache::contains(const RecordKey& key) const -> bool { return nodes_.contains(key); }
+
+auto SubmapCache::size() const -> std::size_t { return nodes_.size(); }
+
+auto SubmapCache::take(const RecordKey& key) -> std::optional<Entry>
+{
+    const auto it {nodes_.find(key)};
+
+    if (it == nodes_.end()) {
+        return std::nullopt;
+    }
+
+    // Once taken, the caller's copy is the authoritative one, so nothing is written back here.
+    Entry entry {std::move(it->second.entry)};
+    uses_.erase(it->second.use);
+    nodes_.erase(it);
+    return entry;
+}
+
+void SubmapCache::put(const RecordKey& key, std::unique_ptr<submap> data, const unsigned int turn)
+{
+    if (const auto it {nodes_.find(key)}; it != nodes_.end()) {
+        uses_.erase(it->second.use);
+        nodes_.erase(it);
+    }
+
+    while (nodes_.size() >= capacity_) {
+        evict_oldest();
+    }
+
+    uses_.push_front(key);
+    nodes_.emplace(key, Node {Entry {std::move(data), turn}, uses_.begin(), true});
+}
+
+void SubmapCache::flush()
+{
+    for (auto& [key, node] : nodes_) {
+        write_back(key, node);
+    }
+}
+
+void SubmapCache::clear()
+{
+    flush();
+    nodes_.clear();
+    uses_.clear();
+}
+
+void SubmapCache::write_back(const RecordKey& key, Node& node)
+{
+    if (!node.dirty) {
+        return;
+    }
+
+    const auto data {encode_submap(*node.entry.data, node.entry.turn)};
+    store_.store(key, {data.data(), data.size()});
+    node.dirty = false;
+}
+
+void SubmapCache::evict_oldest()
+{
+    const auto key {uses_.back()};
+    const auto it {nodes_.find(key)};
+    write_back(key, it->second);
+    nodes_.erase(it);
+    uses_.pop_back();
+}
+
+auto submap_cache() -> SubmapCache&
+{
+    // A 9x9 block of submaps: enough to walk back and forth across a few map shifts without
+    // touching the store.
+    static SubmapCache cache {submap_records(), 81};
+    return cache;
+}
+} // namespace oocdda
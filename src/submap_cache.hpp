@@ -0,0 +1,74 @@
+#ifndef OOCDDA_SUBMAP_CACHE_HPP
+#define OOCDDA_SUBMAP_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "mapdata.hpp"
+#include "region_store.hpp"
+
+namespace oocdda {
+/**
+ * \brief Keeps recently visited submaps in memory after they leave the active map.
+ *
+ * The cache owns every submap handed to it until it is taken back out. A submap is in at most one
+ * of the active map and the cache, so the cached copy is always the newest one; the backing store
+ * only sees it when it is evicted or when the cache is flushed.
+ */
+class SubmapCache {
+public:
+    struct Entry {
+        std::unique_ptr<submap> data;
+        unsigned int turn {0}; ///< The turn the submap was last active.
+    };
+
+    /**
+     * \param store Where evicted and flushed submaps are written.
+     * \param capacity How many submaps to keep before evicting the least recently used one.
+     */
+    SubmapCache(RecordStore& store, std::size_t capacity);
+    SubmapCache(const SubmapCache&) = delete;
+    SubmapCache(SubmapCache&&) = delete;
+    auto operator=(const SubmapCache&) -> SubmapCache& = delete;
+    auto operator=(SubmapCache&&) -> SubmapCache& = delete;
+    ~SubmapCache();
+
+    [[nodiscard]] auto contains(const RecordKey& key) const -> bool;
+    [[nodiscard]] auto size() const -> std::size_t;
+
+    /// Removes the submap stored under \p key from the cache and hands it back, if there is one.
+    [[nodiscard]] auto take(const RecordKey& key) -> std::optional<Entry>;
+
+    /// Takes ownership of a submap that left the active map, evicting old entries as needed.
+    void put(const RecordKey& key, std::unique_ptr<submap> data, unsigned int turn);
+
+    /// Writes every submap changed since it was cached to the store, keeping them cached.
+    void flush();
+
+    /// Writes every changed submap to the store, then drops them all.
+    void clear();
+
+private:
+    struct Node {
+        Entry entry;
+        std::list<RecordKey>::iterator use;
+        bool dirty {true};
+    };
+
+    void write_back(const RecordKey& key, Node& node);
+    void evict_oldest();
+
+    RecordStore& store_;
+    std::size_t capacity_;
+    std::list<RecordKey> uses_; ///< Most recently cached first.
+    std::map<RecordKey, Node> nodes_;
+};
+
+/// The cache in front of submap_records(), shared by every Map.
+[[nodiscard]] auto submap_cache() -> SubmapCache&;
+} // namespace oocdda
+
+#endif // OOCDDA_SUBMAP_CACHE_HPP
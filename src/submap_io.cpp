@@ -0,0 +1,426 @@
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "submap_io.hpp"
+
+#include "byte_buffer.hpp"
+#include "item.hpp"
+#include "trap.hpp"
+
+namespace oocdda {
+namespace {
+static_assert(num_terrain_types <= 256, "Terrain ids are stored as single bytes");
+static_assert(num_trap_types <= 256, "Trap ids are stored as single bytes");
+static_assert(num_fields <= 256, "Field ids are stored as single bytes");
+
+constexpr std::uint8_t item_active_bit {1U << 0U};
+constexpr std::uint8_t item_owned_bit {1U << 1U};
+constexpr std::int32_t no_corpse {-1};
+
+void write_item(ByteWriter& out, const Item& item)
+{
+    const auto ammo_id {item.type->is_gun() && item.curammo != nullptr ? item.curammo->id : 0U};
+    const auto corpse_id {item.type->id == itm_corpse && item.corpse != nullptr
+                              ? static_cast<std::int32_t>(item.corpse->id)
+                              : no_corpse};
+    std::uint8_t flags {0};
+
+    if (item.active) {
+        flags |= item_active_bit;
+    }
+
+    if (item.owned) {
+        flags |= item_owned_bit;
+    }
+
+    out.write(static_cast<std::int8_t>(item.invlet));
+    out.write(static_cast<std::uint32_t>(item.type->id));
+    out.write(static_cast<std::int32_t>(item.charges));
+    out.write(static_cast<std::int8_t>(item.damage));
+    out.write(static_cast<std::uint32_t>(ammo_id));
+    out.write(static_cast<std::uint32_t>(item.bday));
+    out.write(flags);
+    out.write(corpse_id);
+    out.write_string(item.name);
+    out.write(static_cast<std::uint32_t>(item.contents.size()));
+
+    for (const auto& content : item.contents) {
+        write_item(out, content);
+    }
+}
+
+[[nodiscard]] auto read_item(ByteReader& in,
+                             const std::vector<itype*>& itypes,
+                             const std::vector<MonsterType*>& mtypes,
+                             Item& item) -> bool
+{
+    std::int8_t invlet {0};
+    std::uint32_t type_id {0};
+    std::int32_t charges {0};
+    std::int8_t damage {0};
+    std::uint32_t ammo_id {0};
+    std::uint32_t bday {0};
+    std::uint8_t flags {0};
+    std::int32_t corpse_id {no_corpse};
+    std::uint32_t num_contents {0};
+
+    if (!in.read(invlet) || !in.read(type_id) || !in.read(charges) || !in.read(damage)
+        || !in.read(ammo_id) || !in.read(bday) || !in.read(flags) || !in.read(corpse_id)
+        || !in.read_string(item.name) || !in.read(num_contents)) {
+        return false;
+    }
+
+    if (type_id >= itypes.size() || ammo_id >= itypes.size()
+        || (corpse_id != no_corpse
+            && (corpse_id < 0 || static_cast<std::size_t>(corpse_id) >= mtypes.size()))) {
+        return false;
+    }
+
+    item.make(itypes[type_id]);
+    item.invlet = static_cast<char>(invlet);
+    item.charges = charges;
+    item.damage = damage;
+    item.bday = bday;
+    item.active = (flags & item_active_bit) != 0;
+    item.owned = (flags & item_owned_bit) != 0;
+    item.corpse = corpse_id == no_corpse ? nullptr : mtypes[static_cast<std::size_t>(corpse_id)];
+    item.curammo = nullptr;
+
+    if (item.is_gun() && ammo_id > 0) {
+        item.curammo = dynamic_cast<it_ammo*>(itypes[ammo_id]);
+    }
+
+    for (std::uint32_t i {0}; i < num_contents; ++i) {
+        Item content;
+
+        if (!read_item(in, itypes, mtypes, content)) {
+            return false;
+        }
+
+        item.contents.push_back(content);
+    }
+
+    return true;
+}
+
+void clear_submap(submap& sm)
+{
+    for (int i {0}; i < SEEX; ++i) {
+        for (int j {0}; j < SEEY; ++j) {
+            sm.ter[i][j] = t_null;
+            sm.itm[i][j].clear();
+            sm.trp[i][j] = tr_null;
+            sm.fld[i][j] = field();
+            sm.rad[i][j] = 0;
+        }
+    }
+
+    sm.spawns.clear();
+}
+} // namespace
+
+auto encode_submap(const submap& sm, const unsigned int turn) -> std::vector<char>
+{
+    ByteWriter out;
+
+    out.write_bytes(submap_magic.data(), submap_magic.size());
+    out.write(submap_format_version);
+    out.write(std::uint16_t {0}); // Reserved
+    out.write(static_cast<std::uint32_t>(turn));
+
+    // Fixed-size planes, stored in the same [x][y] order as the submap arrays.
+    for (const auto& column : sm.ter) {
+        for (const auto terrain : column) {
+            out.write(static_cast<std::uint8_t>(terrain));
+        }
+    }
+
+    for (const auto& column : sm.trp) {
+        for (const auto trap : column) {
+            out.write(static_cast<std::uint8_t>(trap));
+        }
+    }
+
+    for (const auto& column : sm.fld) {
+        for (const auto& fd : column) {
+            out.write(static_cast<std::uint8_t>(fd.type));
+            out.write(static_cast<std::int8_t>(fd.density));
+            out.write(static_cast<std::int32_t>(fd.age));
+        }
+    }
+
+    for (const auto& column : sm.rad) {
+        for (const auto radiation : column) {
+            out.write(static_cast<std::int32_t>(radiation));
+        }
+    }
+
+    out.write(static_cast<std::uint32_t>(sm.spawns.size()));
+
+    for (const auto& spawn : sm.spawns) {
+        out.write(static_cast<std::int32_t>(spawn.type));
+        out.write(static_cast<std::int32_t>(spawn.count));
+        out.write(static_cast<std::int32_t>(spawn.posx));
+        out.write(static_cast<std::int32_t>(spawn.posy));
+    }
+
+    // The item section is prefixed with its length in bytes so readers can skip it wholesale.
+    const auto items_length_offset {out.size()};
+    out.write(std::uint32_t {0});
+    const auto items_begin {out.size()};
+    std::uint32_t num_records {0};
+
+    for (const auto& column : sm.itm) {
+        for (const auto& items : column) {
+            num_records += static_cast<std::uint32_t>(items.size());
+        }
+    }
+
+    out.write(num_records);
+
+    for (int i {0}; i < SEEX; ++i) {
+        for (int j {0}; j < SEEY; ++j) {
+            for (const auto& item : sm.itm[i][j]) {
+                out.write(static_cast<std::uint8_t>(i));
+                out.write(static_cast<std::uint8_t>(j));
+                write_item(out, item);
+            }
+        }
+    }
+
+    out.patch(items_length_offset, static_cast<std::uint32_t>(out.size() - items_begin));
+    return std::move(out).bytes();
+}
+
+auto decode_submap(const std::string_view data,
+                   const std::vector<itype*>& itypes,
+                   const std::vector<MonsterType*>& mtypes,
+                   submap& sm,
+                   unsigned int& turn) -> bool
+{
+    if (!data.starts_with(std::string_view {submap_magic.data(), submap_magic.size()})) {
+        return decode_legacy_submap(data, itypes, mtypes, sm, turn);
+    }
+
+    ByteReader in {data};
+    std::uint16_t version {0};
+    std::uint16_t reserved {0};
+    std::uint32_t saved_turn {0};
+
+    if (!in.skip(submap_magic.size()) || !in.read(version) || !in.read(reserved)
+        || !in.read(saved_turn) || version == 0 || version > submap_format_version) {
+        return false;
+    }
+
+    clear_submap(sm);
+
+    for (auto& column : sm.ter) {
+        for (auto& terrain : column) {
+            std::uint8_t value {0};
+
+            if (!in.read(value) || value >= num_terrain_types) {
+                return false;
+            }
+
+            terrain = static_cast<ter_id>(value);
+        }
+    }
+
+    for (auto& column : sm.trp) {
+        for (auto& trap : column) {
+            std::uint8_t value {0};
+
+            if (!in.read(value) || value >= num_trap_types) {
+                return false;
+            }
+
+            trap = static_cast<trap_id>(value);
+        }
+    }
+
+    for (auto& column : sm.fld) {
+        for (auto& fd : column) {
+            std::uint8_t type {0};
+            std::int8_t density {0};
+            std::int32_t age {0};
+
+            if (!in.read(type) || !in.read(density) || !in.read(age) || type >= num_fields) {
+                return false;
+            }
+
+            fd = field(static_cast<field_id>(type), static_cast<char>(density),
+                       static_cast<unsigned int>(age));
+        }
+    }
+
+    for (auto& column : sm.rad) {
+        for (auto& radiation : column) {
+            std::int32_t value {0};
+
+            if (!in.read(value)) {
+                return false;
+            }
+
+            radiation = value;
+        }
+    }
+
+    std::uint32_t num_spawns {0};
+
+    if (!in.read(num_spawns)) {
+        return false;
+    }
+
+    for (std::uint32_t i {0}; i < num_spawns; ++i) {
+        std::int32_t type {0};
+        std::int32_t count {0};
+        std::int32_t posx {0};
+        std::int32_t posy {0};
+
+        if (!in.read(type) || !in.read(count) || !in.read(posx) || !in.read(posy)
+            || type < 0 || type >= num_monsters) {
+            return false;
+        }
+
+        sm.spawns.emplace_back(static_cast<mon_id>(type), count, posx, posy);
+    }
+
+    std::uint32_t items_length {0};
+    std::uint32_t num_records {0};
+
+    if (!in.read(items_length) || in.remaining() < items_length || !in.read(num_records)) {
+        return false;
+    }
+
+    for (std::uint32_t n {0}; n < num_records; ++n) {
+        std::uint8_t x {0};
+        std::uint8_t y {0};
+        Item item;
+
+        if (!in.read(x) || !in.read(y) || x >= SEEX || y >= SEEY
+            || !read_item(in, itypes, mtypes, item)) {
+            return false;
+        }
+
+        sm.itm[x][y].push_back(item);
+    }
+
+    turn = saved_turn;
+    return true;
+}
+
+auto decode_legacy_submap(const std::string_view data,
+                          const std::vector<itype*>& itypes,
+                          const std::vector<MonsterType*>& mtypes,
+                          submap& sm,
+                          unsigned int& turn) -> bool
+{
+    std::istringstream mapin {std::string {data}};
+    std::string line;
+    unsigned int saved_turn {0};
+
+    // Load turn number
+    if (!(mapin >> saved_turn)) {
+        return false;
+    }
+
+    std::getline(mapin, line); // Clear out the endline
+    clear_submap(sm);
+
+    // Load terrain. Each character is the terrain id plus 42.
+    for (int j {0}; j < SEEY; ++j) {
+        if (!std::getline(mapin, line) || static_cast<int>(line.size()) < SEEX) {
+            return false;
+        }
+
+        for (int i {0}; i < SEEX; ++i) {
+            const int terrain {line[static_cast<std::size_t>(i)] - 42};
+
+            if (terrain < 0 || terrain >= num_terrain_types) {
+                return false;
+            }
+
+            sm.ter[i][j] = static_cast<ter_id>(terrain);
+        }
+    }
+
+    // Load irradiation.
+    for (int j {0}; j < SEEY; ++j) {
+        for (auto& radiation : sm.rad) {
+            if (!(mapin >> radiation[j])) {
+                return false;
+            }
+        }
+    }
+
+    // Load items and traps and fields and spawn points
+    int itx {-1};
+    int ity {-1};
+    char ch {0};
+
+    while (mapin >> ch) {
+        if (ch == 'I') {
+            if (!(mapin >> itx >> ity) || itx < 0 || itx >= SEEX || ity < 0 || ity >= SEEY) {
+                return false;
+            }
+
+            std::getline(mapin, line); // Clear out the endline
+            std::getline(mapin, line);
+            Item it_tmp;
+            it_tmp.load_info(line, itypes, mtypes);
+            sm.itm[itx][ity].push_back(it_tmp);
+        } else if (ch == 'C') {
+            if (itx < 0 || sm.itm[itx][ity].empty()) {
+                return false; // Contents without a container
+            }
+
+            std::getline(mapin, line); // Clear out the endline
+            std::getline(mapin, line);
+            Item it_tmp;
+            it_tmp.load_info(line, itypes, mtypes);
+            sm.itm[itx][ity].back().put_in(it_tmp);
+        } else if (ch == 'T') {
+            int x {0};
+            int y {0};
+            int t {0};
+
+            if (!(mapin >> x >> y >> t) || x < 0 || x >= SEEX || y < 0 || y >= SEEY || t < 0
+                || t >= num_trap_types) {
+                return false;
+            }
+
+            sm.trp[x][y] = static_cast<trap_id>(t);
+        } else if (ch == 'F') {
+            int x {0};
+            int y {0};
+            int t {0};
+            int d {0};
+            int a {0};
+
+            if (!(mapin >> x >> y >> t >> d >> a) || x < 0 || x >= SEEX || y < 0 || y >= SEEY
+                || t < 0 || t >= num_fields) {
+                return false;
+            }
+
+            sm.fld[x][y] = field(static_cast<field_id>(t), static_cast<char>(d),
+                                 static_cast<unsigned int>(a));
+        } else if (ch == 'S') {
+            int t {0};
+            int count {0};
+            int x {0};
+            int y {0};
+
+            if (!(mapin >> t >> count >> x >> y) || t < 0 || t >= num_monsters) {
+                return false;
+            }
+
+            sm.spawns.emplace_back(static_cast<mon_id>(t), count, x, y);
+        }
+    }
+
+    turn = saved_turn;
+    return true;
+}
+} // namespace oocdda
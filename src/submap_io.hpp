@@ -0,0 +1,71 @@
+#ifndef OOCDDA_SUBMAP_IO_HPP
+#define OOCDDA_SUBMAP_IO_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "itype.hpp"
+#include "mapdata.hpp"
+#include "monster_type.hpp"
+
+namespace oocdda {
+/**
+ * \brief Tag at the start of every binary submap record.
+ *
+ * Legacy text submaps start with the decimal turn number, so they can never begin with this tag.
+ */
+inline constexpr std::array<char, 4> submap_magic {'O', 'S', 'M', 'B'};
+
+/// Bumped whenever the binary layout changes; older versions are still accepted by the decoder.
+inline constexpr std::uint16_t submap_format_version {1};
+
+/**
+ * \brief Serializes a submap into the binary submap format.
+ *
+ * The layout is a fixed-size header (magic, version, last visited turn) followed by the terrain,
+ * trap, field and radiation planes, the spawn points, and finally a length-prefixed item section.
+ * All integers are little-endian.
+ *
+ * \param sm The submap to serialize.
+ * \param turn The turn the submap was last visited on.
+ *
+ * \return The encoded bytes.
+ */
+[[nodiscard]] auto encode_submap(const submap& sm, unsigned int turn) -> std::vector<char>;
+
+/**
+ * \brief Restores a submap from either the binary format or the legacy text format.
+ *
+ * Radiation is restored as saved; decaying it for the time spent away is left to the caller.
+ *
+ * \param data The raw contents of a submap record.
+ * \param itypes The item type table, indexed by item type id.
+ * \param mtypes The monster type table, indexed by monster id (used for corpses).
+ * \param sm The submap to fill in. Items, traps, fields and spawns are replaced.
+ * \param turn Receives the turn the submap was last visited on.
+ *
+ * \return false if the data is truncated or not a submap at all.
+ */
+[[nodiscard]] auto decode_submap(std::string_view data,
+                                 const std::vector<itype*>& itypes,
+                                 const std::vector<MonsterType*>& mtypes,
+                                 submap& sm,
+                                 unsigned int& turn) -> bool;
+
+/**
+ * \brief Restores a submap from the original `operator<<` text format.
+ *
+ * Only used to import saves written before the binary format existed.
+ *
+ * \copydetails decode_submap
+ */
+[[nodiscard]] auto decode_legacy_submap(std::string_view data,
+                                        const std::vector<itype*>& itypes,
+                                        const std::vector<MonsterType*>& mtypes,
+                                        submap& sm,
+                                        unsigned int& turn) -> bool;
+} // namespace oocdda
+
+#endif // OOCDDA_SUBMAP_IO_HPP
@@ -306,10 +306,13 @@ void trapfuncm::telepad(Game* g, Monster* z, int x, int y)
     int j;
     if (g->u_see(z, j))
         g->add_msg("The air shimmers around the %s...", z->name().c_str());
+    const int oldx {z->posx};
+    const int oldy {z->posy};
     do {
         z->posx = rng(z->posx - SEEX, z->posx + SEEX);
         z->posy = rng(z->posy - SEEY, z->posy + SEEY);
     } while (g->m.move_cost(z->posx, z->posy) == 0);
+    g->mon_grid.moved(*z, oldx, oldy);
 }
 
 void trapfunc::goo(Game* g, int x, int y)
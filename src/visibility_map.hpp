@@ -0,0 +1,166 @@
+#ifndef OOCDDA_VISIBILITY_MAP_HPP
+#define OOCDDA_VISIBILITY_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace oocdda {
+/**
+ * \brief Which squares of a width by height window can be seen from one spot.
+ *
+ * Filled in one recursive shadowcasting pass, so asking about any number of squares afterwards
+ * costs a lookup each. Opaque squares are themselves visible; only what lies behind them is
+ * hidden. The range is square, like Map::sees.
+ */
+class VisibilityMap {
+public:
+    VisibilityMap(const int width, const int height)
+        : width_ {width}
+        , height_ {height}
+        , visible_(static_cast<std::size_t>(width * height))
+    {
+    }
+
+    /**
+     * \brief Recomputes the map as seen from (\p x, \p y).
+     *
+     * \param range How many squares away, along either axis, can be seen at most.
+     * \param transparent Called as transparent(x, y); may be asked about squares outside the
+     * window.
+     */
+    template<typename Transparent>
+    void compute(const int x, const int y, const int range, const Transparent& transparent)
+    {
+        std::fill(visible_.begin(), visible_.end(), false);
+        originx_ = x;
+        originy_ = y;
+        range_ = range;
+
+        if (range < 0) {
+            return;
+        }
+
+        mark(x, y);
+
+        // Nothing past the far edge of the window needs to be looked at.
+        const int reach {std::min(range, std::max(width_, height_))};
+
+        for (const auto& octant : octants) {
+            cast(transparent, octant, reach, 1, 1.0, 0.0);
+        }
+    }
+
+    /// false for squares outside the window.
+    [[nodiscard]] auto visible(const int x, const int y) const -> bool
+    {
+        return inside(x, y) && visible_[cell(x, y)];
+    }
+
+    [[nodiscard]] auto inside(const int x, const int y) const -> bool
+    {
+        return x >= 0 && x < width_ && y >= 0 && y < height_;
+    }
+
+    [[nodiscard]] auto originx() const -> int { return originx_; }
+    [[nodiscard]] auto originy() const -> int { return originy_; }
+    [[nodiscard]] auto range() const -> int { return range_; }
+
+private:
+    /// Maps an octant's (column, row) onto the window's x and y axes.
+    struct Octant {
+        int xx;
+        int xy;
+        int yx;
+        int yy;
+    };
+
+    static constexpr std::array<Octant, 8> octants {{
+        {1, 0, 0, 1},
+        {0, 1, 1, 0},
+        {0, -1, 1, 0},
+        {-1, 0, 0, 1},
+        {-1, 0, 0, -1},
+        {0, -1, -1, 0},
+        {0, 1, -1, 0},
+        {1, 0, 0, -1},
+    }};
+
+    [[nodiscard]] auto cell(const int x, const int y) const -> std::size_t
+    {
+        return static_cast<std::size_t>(y * width_ + x);
+    }
+
+    void mark(const int x, const int y)
+    {
+        if (inside(x, y)) {
+            visible_[cell(x, y)] = true;
+        }
+    }
+
+    /// Lights rows \p row to \p reach of one octant between the slopes \p start and \p end.
+    template<typename Transparent>
+    void cast(const Transparent& transparent, const Octant& octant, const int reach, const int row,
+              double start, const double end)
+    {
+        if (start < end) {
+            return;
+        }
+
+        double next_start {start};
+
+        for (int distance {row}; distance <= reach; ++distance) {
+            const int dy {-distance};
+            bool blocked {false};
+
+            for (int dx {-distance}; dx <= 0; ++dx) {
+                const double left_slope {(dx - 0.5) / (dy + 0.5)};
+                const double right_slope {(dx + 0.5) / (dy - 0.5)};
+
+                if (start < right_slope) {
+                    continue;
+                }
+
+                if (end > left_slope) {
+                    break;
+                }
+
+                const int x {originx_ + dx * octant.xx + dy * octant.xy};
+                const int y {originy_ + dx * octant.yx + dy * octant.yy};
+                mark(x, y);
+
+                const bool opaque {!transparent(x, y)};
+
+                if (blocked) {
+                    if (opaque) {
+                        next_start = right_slope;
+                    } else {
+                        blocked = false;
+                        start = next_start;
+                    }
+                } else if (opaque && distance < reach) {
+                    // Light the part of the next rows this square doesn't shade, then carry on
+                    // past it.
+                    blocked = true;
+                    cast(transparent, octant, reach, distance + 1, start, left_slope);
+                    next_start = right_slope;
+                }
+            }
+
+            if (blocked) {
+                break;
+            }
+        }
+    }
+
+    int width_;
+    int height_;
+    std::vector<bool> visible_;
+    int originx_ {0};
+    int originy_ {0};
+    int range_ {-1};
+};
+} // namespace oocdda
+
+#endif // OOCDDA_VISIBILITY_MAP_HPP
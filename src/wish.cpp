@@ -9,6 +9,7 @@
 #include "game.hpp"
 #include "item.hpp"
 #include "itype.hpp"
+#include "keypress.hpp"
 #include "output.hpp"
 #include "player.hpp"
 
@@ -100,13 +101,13 @@ void Game::wish()
         info = tmp.info();
         line = 2;
         mvprintw(line, 1, "%s", info.c_str());
-        ch = getch();
+        ch = get_key();
     } while (ch != ' ');
     clear();
     mvprintw(0, 0, "\nWish granted.");
     tmp.invlet = nextinv;
     u.i_add(tmp);
     advance_nextinv();
-    getch();
+    get_key();
 }
 } // namespace oocdda
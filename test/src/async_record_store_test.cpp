@@ -0,0 +1,99 @@
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "async_record_store.hpp"
+#include "io_worker.hpp"
+#include "memory_store.hpp"
+
+using oocdda::AsyncRecordStore;
+using oocdda::IoWorker;
+
+TEST(AsyncRecordStoreTest, StoreIsVisibleImmediately)
+{
+    MemoryStore backing;
+    IoWorker worker;
+    AsyncRecordStore store {backing, worker};
+
+    store.store({1, 2, 0}, "hello");
+
+    EXPECT_TRUE(store.contains({1, 2, 0}));
+    EXPECT_EQ(store.load({1, 2, 0}).value(), "hello");
+    EXPECT_FALSE(store.load({2, 1, 0}).has_value());
+}
+
+TEST(AsyncRecordStoreTest, FlushWritesThrough)
+{
+    MemoryStore backing;
+    IoWorker worker;
+    AsyncRecordStore store {backing, worker};
+
+    store.store({0, 0, 0}, "first");
+    store.store({0, 0, 0}, "second");
+    store.store({0, 1, 0}, "other");
+    store.flush();
+
+    EXPECT_EQ(backing.records.at({0, 0, 0}), "second");
+    EXPECT_EQ(backing.records.at({0, 1, 0}), "other");
+    EXPECT_EQ(backing.flushes, 1);
+}
+
+TEST(AsyncRecordStoreTest, PrefetchedRecordLoads)
+{
+    MemoryStore backing;
+    backing.records[{3, 4, 0}] = "on disk";
+    IoWorker worker;
+    AsyncRecordStore store {backing, worker};
+
+    store.prefetch({3, 4, 0});
+    store.prefetch({5, 5, 0});
+    worker.wait_idle();
+    backing.records.clear();
+
+    EXPECT_EQ(store.load({3, 4, 0}).value(), "on disk");
+    EXPECT_FALSE(store.contains({5, 5, 0}));
+}
+
+TEST(AsyncRecordStoreTest, StoreAfterPrefetchWins)
+{
+    MemoryStore backing;
+    backing.records[{0, 0, 0}] = "old";
+    IoWorker worker;
+    AsyncRecordStore store {backing, worker};
+
+    store.prefetch({0, 0, 0});
+    store.store({0, 0, 0}, "new");
+    worker.wait_idle();
+
+    EXPECT_EQ(store.load({0, 0, 0}).value(), "new");
+}
+
+TEST(AsyncRecordStoreTest, CloseForgetsPrefetchedRecords)
+{
+    MemoryStore backing;
+    backing.records[{3, 4, 0}] = "old world";
+    IoWorker worker;
+    AsyncRecordStore store {backing, worker};
+
+    store.prefetch({3, 4, 0});
+    store.store({0, 0, 0}, "written");
+    store.close();
+    backing.records.erase({3, 4, 0});
+
+    EXPECT_EQ(backing.records.at({0, 0, 0}), "written");
+    EXPECT_EQ(backing.flushes, 1);
+    EXPECT_FALSE(store.contains({3, 4, 0}));
+}
+
+TEST(AsyncRecordStoreTest, DestructionFinishesWrites)
+{
+    MemoryStore backing;
+    IoWorker worker;
+
+    {
+        AsyncRecordStore store {backing, worker};
+        store.store({7, 7, 7}, std::string(10000, 'x'));
+    }
+
+    EXPECT_EQ(backing.records.at({7, 7, 7}).size(), 10000);
+}
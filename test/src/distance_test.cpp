@@ -0,0 +1,62 @@
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "distance.hpp"
+
+using oocdda::isqrt;
+using oocdda::rl_dist;
+using oocdda::square_dist;
+using oocdda::trig_dist;
+
+namespace {
+/// What trig_dist() used to work out, to match.
+auto old_trig_dist(const int x1, const int y1, const int x2, const int y2) -> int
+{
+    return int(std::sqrt(std::pow(x1 - x2, 2) + std::pow(y1 - y2, 2)));
+}
+} // namespace
+
+// Checked while compiling, so a broken table doesn't even build.
+static_assert(isqrt(0) == 0);
+static_assert(isqrt(1) == 1);
+static_assert(isqrt(15) == 3);
+static_assert(isqrt(16) == 4);
+static_assert(isqrt(std::int64_t {3037000499} * 3037000499) == 3037000499);
+static_assert(isqrt(std::int64_t {3037000499} * 3037000499 - 1) == 3037000498);
+static_assert(trig_dist(0, 0, 3, 4) == 5);
+static_assert(trig_dist(0, 0, 1, 1) == 1);
+static_assert(trig_dist(10, 10, 0, 0) == 14);
+static_assert(trig_dist(-100, 0, 100, 0) == 200);
+static_assert(trig_dist(0, 0, 127, 127) == 179);
+static_assert(square_dist(1, 2, 4, 6) == 25);
+static_assert(rl_dist(0, 0, -3, 2) == 3);
+
+TEST(DistanceTest, MatchesOldTrigDistAcrossTheTable)
+{
+    for (int dy {-140}; dy <= 140; ++dy) {
+        for (int dx {-140}; dx <= 140; ++dx) {
+            ASSERT_EQ(trig_dist(5, -7, 5 + dx, -7 + dy), old_trig_dist(5, -7, 5 + dx, -7 + dy))
+                << dx << ", " << dy;
+        }
+    }
+}
+
+TEST(DistanceTest, MatchesOldTrigDistFarAway)
+{
+    for (int x {0}; x <= 100000; x += 997) {
+        for (int y {0}; y <= 100000; y += 1009) {
+            ASSERT_EQ(trig_dist(0, 0, x, y), old_trig_dist(0, 0, x, y)) << x << ", " << y;
+        }
+    }
+}
+
+TEST(DistanceTest, IsqrtIsExactAroundSquares)
+{
+    for (std::int64_t r {1}; r < 100000; r += 7) {
+        EXPECT_EQ(isqrt(r * r), r);
+        EXPECT_EQ(isqrt(r * r - 1), r - 1);
+        EXPECT_EQ(isqrt(r * r + 2 * r), r);
+    }
+}
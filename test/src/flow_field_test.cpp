@@ -0,0 +1,99 @@
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "flow_field.hpp"
+#include "point.hpp"
+
+using oocdda::FlowField;
+using oocdda::Point;
+
+namespace {
+/// '#' can't be entered, '~' costs 5 and anything else 1.
+struct Grid {
+    std::vector<std::string> rows;
+
+    [[nodiscard]] auto width() const -> int { return static_cast<int>(rows[0].size()); }
+    [[nodiscard]] auto height() const -> int { return static_cast<int>(rows.size()); }
+
+    auto operator()(const int x, const int y) const -> int
+    {
+        const char square {rows[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)]};
+        return square == '#' ? 0 : square == '~' ? 5 : 1;
+    }
+};
+
+/// Follows next_step() from (x, y) until it stops, counting the steps.
+auto walk(const FlowField& field, Point from, const Point goal) -> int
+{
+    int steps {0};
+
+    for (Point next {field.next_step(from.x, from.y)}; next != from;
+         next = field.next_step(from.x, from.y)) {
+        from = next;
+        ++steps;
+    }
+
+    EXPECT_EQ(from, goal);
+    return steps;
+}
+} // namespace
+
+TEST(FlowFieldTest, CountsStepsOnOpenGround)
+{
+    const Grid grid {{".....", ".....", "....."}};
+    FlowField field {grid.width(), grid.height()};
+    field.compute({{2, 1}}, grid);
+
+    EXPECT_EQ(field.distance(2, 1), 0);
+    EXPECT_EQ(field.distance(0, 0), 2);
+    EXPECT_EQ(field.distance(4, 2), 2);
+    EXPECT_EQ(field.next_step(2, 1), (Point {2, 1}));
+    EXPECT_EQ(walk(field, {0, 0}, {2, 1}), 2);
+}
+
+TEST(FlowFieldTest, LeadsAroundWalls)
+{
+    const Grid grid {{".....", "####.", ".....", ".####", "....."}};
+    FlowField field {grid.width(), grid.height()};
+    field.compute({{0, 4}}, grid);
+
+    EXPECT_EQ(field.distance(0, 0), 9);
+    EXPECT_EQ(field.distance(1, 1), FlowField::unreachable);
+    EXPECT_EQ(walk(field, {0, 0}, {0, 4}), 9);
+}
+
+TEST(FlowFieldTest, AvoidsCostlySquares)
+{
+    const Grid grid {{".~.", ".~.", "..."}};
+    FlowField field {grid.width(), grid.height()};
+    field.compute({{2, 0}}, grid);
+
+    EXPECT_EQ(field.distance(0, 0), 4);
+    EXPECT_EQ(field.distance(1, 0), 5);
+    EXPECT_EQ(walk(field, {0, 0}, {2, 0}), 4);
+}
+
+TEST(FlowFieldTest, HeadsForTheNearestGoal)
+{
+    const Grid grid {{"..........."}};
+    FlowField field {grid.width(), grid.height()};
+    field.compute({{0, 0}, {10, 0}}, grid);
+
+    EXPECT_EQ(field.distance(3, 0), 3);
+    EXPECT_EQ(field.distance(7, 0), 3);
+    EXPECT_EQ(field.next_step(7, 0), (Point {8, 0}));
+    EXPECT_FALSE(field.reachable(-1, 0));
+}
+
+TEST(FlowFieldTest, CutOffSquaresStayPut)
+{
+    const Grid grid {{"..#..", "..#..", "..#.."}};
+    FlowField field {grid.width(), grid.height()};
+    field.compute({{0, 1}}, grid);
+
+    EXPECT_FALSE(field.reachable(4, 1));
+    EXPECT_EQ(field.next_step(4, 1), (Point {4, 1}));
+    EXPECT_TRUE(field.reachable(1, 2));
+}
@@ -0,0 +1,90 @@
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "headless.hpp"
+#include "keypress.hpp"
+
+using oocdda::BotInput;
+using oocdda::SaveDir;
+
+TEST(HeadlessTest, PlaysTheScriptFirst)
+{
+    BotInput bot {1, "ll.e"};
+
+    EXPECT_EQ(bot.next_key(), 'l');
+    EXPECT_EQ(bot.next_key(), 'l');
+    EXPECT_EQ(bot.next_key(), '.');
+    EXPECT_EQ(bot.next_key(), 'e');
+}
+
+TEST(HeadlessTest, ThenWandersAndDismisses)
+{
+    constexpr std::string_view expected {"hjklyubn. NY10"};
+    BotInput bot {2};
+    std::string seen;
+
+    for (int i {0}; i < 1000; ++i) {
+        const long key {bot.next_key()};
+
+        if (key == KEY_ESCAPE) {
+            continue;
+        }
+
+        ASSERT_NE(expected.find(static_cast<char>(key)), std::string_view::npos) << key;
+
+        if (seen.find(static_cast<char>(key)) == std::string::npos) {
+            seen += static_cast<char>(key);
+        }
+    }
+
+    // Every key turns up, so no prompt waits forever.
+    EXPECT_EQ(seen.size(), expected.size());
+}
+
+TEST(HeadlessTest, SameSeedSameKeys)
+{
+    BotInput a {3, "x"};
+    BotInput b {3, "x"};
+
+    for (int i {0}; i < 100; ++i) {
+        EXPECT_EQ(a.next_key(), b.next_key());
+    }
+}
+
+TEST(HeadlessTest, PlaysInAThrowawayDirectory)
+{
+    const auto started {std::filesystem::current_path()};
+    std::filesystem::path played;
+
+    {
+        const SaveDir dir;
+        played = dir.path();
+
+        EXPECT_EQ(std::filesystem::current_path(), played);
+        EXPECT_NE(played, started);
+        EXPECT_FALSE(std::filesystem::exists(played / "save"));
+        EXPECT_EQ(std::filesystem::read_symlink(played / "data"), started / "data");
+    }
+
+    EXPECT_EQ(std::filesystem::current_path(), started);
+    EXPECT_FALSE(std::filesystem::exists(played));
+}
+
+TEST(HeadlessTest, KeepsAGivenDirectory)
+{
+    const auto started {std::filesystem::current_path()};
+    const auto given {std::filesystem::temp_directory_path() / "oocdda_headless_test"};
+    std::filesystem::remove_all(given);
+
+    {
+        const SaveDir dir {given};
+        EXPECT_EQ(std::filesystem::current_path(), given);
+    }
+
+    EXPECT_EQ(std::filesystem::current_path(), started);
+    EXPECT_TRUE(std::filesystem::is_symlink(given / "data"));
+    std::filesystem::remove_all(given);
+}
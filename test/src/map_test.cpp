@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "game.hpp"
+#include "headless.hpp"
+#include "item.hpp"
+#include "itype.hpp"
+#include "keypress.hpp"
+#include "map.hpp"
+#include "mapdata.hpp"
+#include "point.hpp"
+#include "rng.hpp"
+
+using oocdda::Game;
+using oocdda::Map;
+using oocdda::Point;
+using oocdda::ter_id;
+
+/// A headless game in a directory of its own, for what a Map can't do without one.
+class MapWorldTest : public ::testing::Test {
+protected:
+    MapWorldTest()
+    {
+        oocdda::seed_rng(1);
+        oocdda::set_input_source(&input);
+        game = std::make_unique<Game>(true);
+    }
+
+    MapWorldTest(const MapWorldTest&) = delete;
+    MapWorldTest(MapWorldTest&&) = delete;
+    auto operator=(const MapWorldTest&) -> MapWorldTest& = delete;
+    auto operator=(MapWorldTest&&) -> MapWorldTest& = delete;
+
+    ~MapWorldTest() override
+    {
+        game.reset();
+        oocdda::set_input_source(nullptr);
+    }
+
+    /// Clears (x, y) down to bare dirt.
+    void clear_square(const int x, const int y)
+    {
+        game->m.set_ter(x, y, ter_id::t_dirt);
+        game->m.i_clear(x, y);
+        game->m.field_at(x, y) = oocdda::field();
+    }
+
+    /// A running chainsaw, which burns a charge a turn.
+    [[nodiscard]] auto running_chainsaw() const -> oocdda::Item
+    {
+        oocdda::Item saw {game->itypes[oocdda::itm_chainsaw_on], 0};
+        saw.active = true;
+        saw.charges = 100;
+        return saw;
+    }
+
+    oocdda::SaveDir dir {{}, OOCDDA_DATA_DIR};
+    oocdda::NullScreen screen;
+    oocdda::BotInput input {1};
+    std::unique_ptr<Game> game;
+};
+
+TEST(MapTest, WritingTerrainUpdatesMoveCostAndTransparency)
+{
+    Map m;
+
+    m.set_ter(5, 5, ter_id::t_dirt);
+    EXPECT_EQ(m.move_cost(5, 5), 2);
+    EXPECT_TRUE(m.trans(5, 5));
+
+    m.set_ter(5, 5, ter_id::t_wall_v);
+    EXPECT_EQ(m.ter(5, 5), ter_id::t_wall_v);
+    EXPECT_EQ(m.move_cost(5, 5), 0);
+    EXPECT_FALSE(m.trans(5, 5));
+}
+
+TEST(MapTest, ReadingTerrainLeavesTheCacheAlone)
+{
+    // Reading is const, so drawing the map can't throw the cached planes away.
+    static_assert(std::is_same_v<decltype(std::declval<const Map&>().ter(0, 0)), ter_id>);
+
+    Map m;
+    m.set_ter(3, 4, ter_id::t_floor);
+    ASSERT_EQ(m.move_cost(3, 4), 2);
+
+    const Map& view {m};
+    EXPECT_EQ(view.ter(3, 4), ter_id::t_floor);
+    EXPECT_EQ(m.move_cost(3, 4), 2);
+    EXPECT_TRUE(m.trans(3, 4));
+}
+
+TEST(MapTest, OutOfBoundsTerrainIsNull)
+{
+    Map m;
+
+    m.set_ter(-1, 0, ter_id::t_wall_v);
+    EXPECT_EQ(m.ter(-1, 0), ter_id::t_null);
+    EXPECT_EQ(m.ter(0, SEEY * 3), ter_id::t_null);
+}
+
+TEST_F(MapWorldTest, ActiveItemsAreListedWhereTheyLie)
+{
+    Map& m {game->m};
+    const int x {SEEX * 2 + 3};
+    const int y {SEEY + 4};
+    clear_square(x, y);
+
+    m.add_item(x, y, running_chainsaw());
+    EXPECT_EQ(m.listed_active_items(), std::vector<Point> {Point(x, y)});
+    m.process_active_items(game.get());
+    EXPECT_EQ(m.i_at(x, y).front().charges, 99);
+
+    // Removing it drops the square; an item slipped in behind add_item's back isn't run.
+    m.i_rem(x, y, 0);
+    EXPECT_TRUE(m.listed_active_items().empty());
+    m.i_at(x, y).push_back(running_chainsaw());
+    m.process_active_items(game.get());
+    EXPECT_EQ(m.i_at(x, y).front().charges, 100);
+
+    // Shifting a submap east moves the square SEEX west, and it is listed there.
+    m.shift(game.get(), game->levx, game->levy, 1, 0);
+    EXPECT_EQ(m.listed_active_items(), std::vector<Point> {Point(x - SEEX, y)});
+    m.process_active_items(game.get());
+    EXPECT_EQ(m.i_at(x - SEEX, y).front().charges, 99);
+}
+
+TEST_F(MapWorldTest, FieldsAreListedUntilTheyBurnOut)
+{
+    Map& m {game->m};
+    const Map& view {m};
+    const int x {SEEX + 2};
+    const int y {SEEY + 6};
+    clear_square(x, y);
+    clear_square(x + 1, y);
+    m.process_fields(game.get()); // Forgets the squares clear_square looked at
+
+    ASSERT_TRUE(m.add_field(game.get(), x, y, oocdda::fd_blood, 1));
+    ASSERT_TRUE(m.add_field(game.get(), x + 1, y, oocdda::fd_blood, 1));
+    m.field_at(x + 1, y).age = 1000000; // Long past its half-life
+    const auto listed {m.listed_fields()};
+    EXPECT_NE(std::find(listed.begin(), listed.end(), Point(x, y)), listed.end());
+    EXPECT_NE(std::find(listed.begin(), listed.end(), Point(x + 1, y)), listed.end());
+
+    m.process_fields(game.get());
+    EXPECT_EQ(view.field_at(x, y).type, oocdda::fd_blood);
+    EXPECT_EQ(view.field_at(x, y).age, 1);
+    EXPECT_TRUE(view.field_at(x + 1, y).is_null());
+    const auto pruned {m.listed_fields()};
+    EXPECT_NE(std::find(pruned.begin(), pruned.end(), Point(x, y)), pruned.end());
+    EXPECT_EQ(std::find(pruned.begin(), pruned.end(), Point(x + 1, y)), pruned.end());
+}
+
+TEST_F(MapWorldTest, ShiftedFieldsAreRelisted)
+{
+    Map& m {game->m};
+    const Map& view {m};
+
+    for (int i {0}; i < SEEX * 3; i += 5) {
+        clear_square(i, i % (SEEY * 3));
+        m.add_field(game.get(), i, i % (SEEY * 3), oocdda::fd_blood, 2);
+    }
+
+    m.shift(game.get(), game->levx, game->levy, 1, 1);
+
+    std::vector<Point> scanned;
+    for (int j {0}; j < SEEY * 3; ++j) {
+        for (int i {0}; i < SEEX * 3; ++i) {
+            if (view.field_at(i, j).type != oocdda::fd_null) {
+                scanned.push_back(Point(i, j));
+            }
+        }
+    }
+
+    EXPECT_FALSE(scanned.empty());
+    EXPECT_EQ(m.listed_fields(), scanned);
+}
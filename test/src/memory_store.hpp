@@ -0,0 +1,39 @@
+#ifndef OOCDDA_TEST_MEMORY_STORE_HPP
+#define OOCDDA_TEST_MEMORY_STORE_HPP
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "region_store.hpp"
+
+/// A RecordStore kept in memory, counting writes, for testing what sits in front of a store.
+class MemoryStore final : public oocdda::RecordStore {
+public:
+    [[nodiscard]] auto contains(const oocdda::RecordKey& key) -> bool override
+    {
+        return records.contains(key);
+    }
+
+    [[nodiscard]] auto load(const oocdda::RecordKey& key)
+        -> std::optional<std::string_view> override
+    {
+        const auto it {records.find(key)};
+        return it == records.end() ? std::nullopt : std::optional<std::string_view> {it->second};
+    }
+
+    void store(const oocdda::RecordKey& key, const std::string_view data) override
+    {
+        records[key] = data;
+        ++writes;
+    }
+
+    void flush() override { ++flushes; }
+
+    std::map<oocdda::RecordKey, std::string> records;
+    int writes {0};
+    int flushes {0};
+};
+
+#endif // OOCDDA_TEST_MEMORY_STORE_HPP
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "noise_map.hpp"
+
+using oocdda::NoiseMap;
+
+namespace {
+auto open_air(const int, const int) -> int { return 1; }
+} // namespace
+
+TEST(NoiseMapTest, MeasuresHowFarTheNoiseTravelled)
+{
+    NoiseMap map {16, 16};
+    map.add(5, 5, 10);
+    map.resolve(open_air);
+
+    const auto straight {map.heard(9, 5)};
+    ASSERT_TRUE(straight.has_value());
+    EXPECT_EQ(straight->source.x, 5);
+    EXPECT_EQ(straight->source.y, 5);
+    EXPECT_EQ(straight->volume, 10);
+    EXPECT_EQ(straight->distance, 4);
+
+    // Three diagonal steps are about 4.2 squares.
+    EXPECT_EQ(map.heard(8, 8)->distance, 4);
+    EXPECT_EQ(map.heard(5, 5)->distance, 0);
+}
+
+TEST(NoiseMapTest, KeepsTheLoudestNoise)
+{
+    NoiseMap map {16, 16};
+    map.add(2, 2, 10);
+    map.add(14, 2, 16);
+    map.resolve(open_air);
+
+    EXPECT_EQ(map.heard(3, 2)->volume, 10);
+    // Nearer the quiet one, but the loud one still has more left to it.
+    EXPECT_EQ(map.heard(7, 2)->volume, 16);
+}
+
+TEST(NoiseMapTest, CarriesTwiceItsVolume)
+{
+    NoiseMap map {32, 4};
+    map.add(0, 0, 5);
+    map.resolve(open_air);
+
+    EXPECT_EQ(map.heard(10, 0)->distance, 10);
+    EXPECT_FALSE(map.heard(11, 0).has_value());
+}
+
+TEST(NoiseMapTest, DampingMuffles)
+{
+    NoiseMap map {9, 3};
+    map.add(0, 1, 20);
+    // A wall down column 4 that sound has to go through.
+    map.resolve([](const int x, const int) { return x == 4 ? 3 : 1; });
+
+    EXPECT_EQ(map.heard(3, 1)->distance, 3);
+    EXPECT_EQ(map.heard(4, 1)->distance, 6);
+    EXPECT_EQ(map.heard(5, 1)->distance, 7);
+
+    map.clear();
+    map.add(0, 1, 20);
+    map.resolve([](const int x, const int) { return x == 4 ? 0 : 1; });
+    EXPECT_FALSE(map.heard(5, 1).has_value());
+}
+
+TEST(NoiseMapTest, OutsideTheWindowGoesByStraightLine)
+{
+    NoiseMap map {8, 8};
+    map.add(-4, 2, 10);
+    map.resolve(open_air);
+
+    EXPECT_EQ(map.heard(2, 2)->source.x, -4);
+    EXPECT_EQ(map.heard(2, 2)->distance, 6);
+    EXPECT_EQ(map.heard(10, 2)->distance, 14);
+    EXPECT_FALSE(map.heard(17, 2).has_value());
+}
+
+TEST(NoiseMapTest, InsideAndOutsideMix)
+{
+    NoiseMap map {8, 8};
+    map.add(1, 1, 10);
+    map.add(-3, 6, 8);
+    map.add(12, 6, 2);
+    map.resolve(open_air);
+
+    // Inside, noises from outside still count, as long as they're the loudest.
+    EXPECT_EQ(map.heard(1, 2)->source.x, 1);
+    EXPECT_EQ(map.heard(0, 6)->source.x, -3);
+    // Outside, every noise is reckoned by straight line, those inside too.
+    EXPECT_EQ(map.heard(-1, 1)->source.x, 1);
+    EXPECT_EQ(map.heard(12, 7)->source.x, 12);
+}
+
+TEST(NoiseMapTest, ShiftFollowsTheWindowAndClearForgets)
+{
+    NoiseMap map {8, 8};
+    map.add(6, 6, 3);
+    map.shift(4, 4);
+    map.resolve(open_air);
+
+    EXPECT_EQ(map.heard(2, 2)->distance, 0);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.heard(2, 2).has_value());
+}
@@ -0,0 +1,177 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "occupancy_grid.hpp"
+
+using oocdda::OccupancyGrid;
+
+namespace {
+struct Critter {
+    int posx;
+    int posy;
+};
+} // namespace
+
+TEST(OccupancyGridTest, FindsAppendedCreatures)
+{
+    std::vector<Critter> critters {{1, 2}, {3, 4}};
+    OccupancyGrid grid {critters, 8, 8};
+
+    EXPECT_EQ(grid.at(1, 2), 0);
+    EXPECT_EQ(grid.at(3, 4), 1);
+    EXPECT_EQ(grid.at(5, 5), -1);
+
+    critters.push_back({5, 5});
+    EXPECT_EQ(grid.at(5, 5), 2);
+}
+
+TEST(OccupancyGridTest, FollowsMoves)
+{
+    std::vector<Critter> critters {{1, 2}, {3, 4}};
+    OccupancyGrid grid {critters, 8, 8};
+    ASSERT_EQ(grid.at(1, 2), 0);
+
+    critters[0].posx = 2;
+    grid.moved(critters[0], 1, 2);
+
+    EXPECT_EQ(grid.at(1, 2), -1);
+    EXPECT_EQ(grid.at(2, 2), 0);
+}
+
+TEST(OccupancyGridTest, StackedCreaturesReportLowestIndex)
+{
+    std::vector<Critter> critters {{1, 1}, {2, 2}, {1, 1}};
+    OccupancyGrid grid {critters, 8, 8};
+    EXPECT_EQ(grid.at(1, 1), 0);
+
+    critters[0].posx = 0;
+    grid.moved(critters[0], 1, 1);
+    EXPECT_EQ(grid.at(1, 1), 2);
+
+    critters[0].posx = 1;
+    grid.moved(critters[0], 0, 1);
+    EXPECT_EQ(grid.at(1, 1), 0);
+    EXPECT_EQ(grid.at(0, 1), -1);
+}
+
+TEST(OccupancyGridTest, RebuildsAfterInvalidate)
+{
+    std::vector<Critter> critters {{1, 1}, {2, 2}, {3, 3}};
+    OccupancyGrid grid {critters, 8, 8};
+    ASSERT_EQ(grid.at(3, 3), 2);
+
+    critters.erase(critters.begin());
+    grid.invalidate();
+
+    EXPECT_EQ(grid.at(1, 1), -1);
+    EXPECT_EQ(grid.at(2, 2), 0);
+    EXPECT_EQ(grid.at(3, 3), 1);
+}
+
+TEST(OccupancyGridTest, ScansOutsideWindow)
+{
+    std::vector<Critter> critters {{-3, 20}, {1, 1}};
+    OccupancyGrid grid {critters, 8, 8};
+
+    EXPECT_EQ(grid.at(-3, 20), 0);
+    EXPECT_EQ(grid.at(1, 1), 1);
+
+    critters[1].posx = 30;
+    grid.moved(critters[1], 1, 1);
+
+    EXPECT_EQ(grid.at(1, 1), -1);
+    EXPECT_EQ(grid.at(30, 1), 1);
+}
+
+TEST(OccupancyGridTest, IgnoresTemporaries)
+{
+    std::vector<Critter> critters {{1, 1}};
+    OccupancyGrid grid {critters, 8, 8};
+    ASSERT_EQ(grid.at(1, 1), 0);
+
+    Critter temp {4, 4};
+    temp.posx = 5;
+    grid.moved(temp, 4, 4);
+
+    EXPECT_EQ(grid.at(1, 1), 0);
+    EXPECT_EQ(grid.at(5, 4), -1);
+}
+
+TEST(OccupancyGridTest, OffersNearestFirst)
+{
+    std::vector<Critter> critters {{9, 9}, {5, 4}, {2, 2}, {4, 6}, {-5, 3}, {0, 14}};
+    OccupancyGrid grid {critters, 16, 16};
+    std::vector<int> order;
+
+    EXPECT_EQ(grid.nearest(4, 4, -1,
+                           [&](const int index) {
+                               order.push_back(index);
+                               return false;
+                           }),
+              -1);
+
+    // Ties go to the lower index; creatures off the window are never offered.
+    EXPECT_EQ(order, (std::vector<int> {1, 2, 3, 0, 5}));
+}
+
+TEST(OccupancyGridTest, NearestStopsEarlyAndKeepsToRange)
+{
+    std::vector<Critter> critters {{1, 1}, {12, 12}, {3, 2}, {3, 2}};
+    OccupancyGrid grid {critters, 16, 16};
+    int offered {0};
+
+    EXPECT_EQ(grid.nearest(3, 3, -1,
+                           [&](const int index) {
+                               ++offered;
+                               return index == 3;
+                           }),
+              3);
+    EXPECT_EQ(offered, 2);
+
+    offered = 0;
+    EXPECT_EQ(grid.nearest(12, 9, 2,
+                           [&](const int) {
+                               ++offered;
+                               return false;
+                           }),
+              -1);
+    EXPECT_EQ(offered, 0);
+
+    critters[1].posy = 10;
+    grid.moved(critters[1], 12, 12);
+    EXPECT_EQ(grid.nearest(12, 9, 2, [](const int) { return true; }), 1);
+}
+
+TEST(OccupancyGridTest, NearestFromOutsideWindow)
+{
+    std::vector<Critter> critters {{7, 0}, {0, 0}, {0, 7}};
+    OccupancyGrid grid {critters, 8, 8};
+
+    EXPECT_EQ(grid.nearest(-2, 1, -1, [](const int) { return true; }), 1);
+}
+
+TEST(OccupancyGridTest, LeavesOutTheDeadAndFollowsSwappedErase)
+{
+    struct Mortal {
+        int posx;
+        int posy;
+        bool dead;
+    };
+
+    std::vector<Mortal> mortals {{1, 1, false}, {2, 2, false}, {3, 3, false}};
+    OccupancyGrid grid {mortals, 8, 8};
+    ASSERT_EQ(grid.at(1, 1), 0);
+
+    mortals[0].dead = true;
+    grid.removed(mortals[0]);
+    EXPECT_EQ(grid.at(1, 1), -1);
+
+    mortals[0] = mortals.back();
+    mortals.pop_back();
+    grid.swapped_out(0);
+
+    EXPECT_EQ(grid.at(3, 3), 0);
+    EXPECT_EQ(grid.at(2, 2), 1);
+    EXPECT_EQ(grid.nearest(0, 0, -1, [](const int) { return true; }), 1);
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include "headless.hpp"
+#include "output.hpp"
+
+using oocdda::wpresent;
+
+namespace {
+/// A window and a back buffer of its size, over a screen that writes to nowhere.
+class PresentTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        front_ = newwin(3, 4, 1, 2);
+        back_ = newpad(3, 4);
+        werase(back_);
+    }
+
+    void TearDown() override
+    {
+        delwin(back_);
+        delwin(front_);
+    }
+
+    oocdda::NullScreen screen_;
+    WINDOW* front_ {nullptr};
+    WINDOW* back_ {nullptr};
+};
+} // namespace
+
+TEST_F(PresentTest, OnlyCopiesTheCellsThatChanged)
+{
+    mvwaddch(back_, 1, 1, 'a');
+    EXPECT_EQ(wpresent(back_, front_), 1); // The blanks are already on the blank screen
+
+    EXPECT_EQ(wpresent(back_, front_), 0);
+    EXPECT_EQ(mvwinch(front_, 1, 1) & A_CHARTEXT, 'a');
+
+    mvwaddch(back_, 1, 1, 'b');
+    mvwaddch(back_, 2, 3, 'c');
+    EXPECT_EQ(wpresent(back_, front_), 2);
+    EXPECT_EQ(mvwinch(front_, 1, 1) & A_CHARTEXT, 'b');
+    EXPECT_EQ(mvwinch(front_, 2, 3) & A_CHARTEXT, 'c');
+    EXPECT_EQ(mvwinch(curscr, 3, 5) & A_CHARTEXT, 'c');
+}
+
+TEST_F(PresentTest, RepaintsWhatWasDrawnOver)
+{
+    mvwaddch(back_, 0, 0, 'a');
+    wpresent(back_, front_);
+
+    WINDOW* const popup {newwin(1, 2, 1, 2)};
+    mvwaddstr(popup, 0, 0, "xy");
+    wrefresh(popup);
+    delwin(popup);
+
+    EXPECT_EQ(wpresent(front_, front_), 2);
+    EXPECT_EQ(mvwinch(curscr, 1, 2) & A_CHARTEXT, 'a');
+    EXPECT_EQ(mvwinch(curscr, 1, 3) & A_CHARTEXT, ' ');
+    EXPECT_EQ(wpresent(back_, front_), 0);
+}
@@ -0,0 +1,124 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "memory_store.hpp"
+#include "omdata.hpp"
+#include "overmap.hpp"
+#include "overmap_cache.hpp"
+#include "overmap_io.hpp"
+
+using oocdda::overmap;
+using oocdda::OvermapCache;
+
+namespace {
+/// Stands in for opening an overmap: an all-field one at x, y, z, and a count of calls.
+struct BlankLoader {
+    auto operator()(oocdda::Game* /*g*/, const int x, const int y, const int z)
+        -> std::shared_ptr<overmap>
+    {
+        ++*loads;
+        auto om {std::make_shared<overmap>()};
+        om->posx = x;
+        om->posy = y;
+        om->posz = z;
+
+        for (int i {0}; i < OMAPX; ++i) {
+            for (int j {0}; j < OMAPY; ++j) {
+                om->ter(i, j) = oocdda::ot_field;
+                om->seen(i, j) = false;
+            }
+        }
+
+        return om;
+    }
+
+    std::shared_ptr<int> loads {std::make_shared<int>(0)};
+};
+} // namespace
+
+TEST(OvermapCacheTest, HitReturnsTheSameInstance)
+{
+    MemoryStore store;
+    BlankLoader loader;
+    OvermapCache cache {store, 4, loader};
+
+    const auto first {cache.get(nullptr, 1, 2, 0)};
+    const auto second {cache.get(nullptr, 1, 2, 0)};
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(*loader.loads, 1);
+    EXPECT_TRUE(cache.contains(1, 2, 0));
+}
+
+TEST(OvermapCacheTest, EvictionSavesDirtyOvermaps)
+{
+    MemoryStore store;
+    BlankLoader loader;
+    OvermapCache cache {store, 2, loader};
+
+    (void)cache.get(nullptr, 0, 0, 0);
+    (void)cache.get(nullptr, 1, 0, 0);
+    cache.mark_dirty(0, 0, 0);
+    (void)cache.get(nullptr, 1, 0, 0); // (0, 0, 0) is now the least recently used
+    (void)cache.get(nullptr, 2, 0, 0);
+
+    EXPECT_FALSE(cache.contains(0, 0, 0));
+    EXPECT_TRUE(cache.contains(1, 0, 0));
+    EXPECT_TRUE(cache.contains(2, 0, 0));
+    EXPECT_EQ(store.writes, 1);
+    EXPECT_TRUE(store.contains({0, 0, 0}));
+
+    // A clean overmap goes without being written.
+    (void)cache.get(nullptr, 3, 0, 0);
+    EXPECT_FALSE(cache.contains(1, 0, 0));
+    EXPECT_EQ(store.writes, 1);
+}
+
+TEST(OvermapCacheTest, SavingAnotherInstanceReplacesTheCachedCopy)
+{
+    MemoryStore store;
+    BlankLoader loader;
+    OvermapCache cache {store, 4, loader};
+
+    const auto cached {cache.get(nullptr, 0, 0, 0)};
+    cache.mark_dirty(0, 0, 0);
+
+    const auto elsewhere {BlankLoader {}(nullptr, 0, 0, 0)};
+    elsewhere->ter(5, 5) = oocdda::ot_forest;
+    cache.saved(*elsewhere, 0, 0, 0);
+
+    EXPECT_EQ(cache.get(nullptr, 0, 0, 0), cached);
+    EXPECT_EQ(cached->ter(5, 5), oocdda::ot_forest);
+
+    // It was just saved, so it's clean again.
+    cache.flush();
+    EXPECT_EQ(store.writes, 0);
+
+    // Saving the cached instance itself leaves it be.
+    cached->ter(6, 6) = oocdda::ot_forest;
+    cache.saved(*cached, 0, 0, 0);
+    EXPECT_EQ(cached->ter(6, 6), oocdda::ot_forest);
+}
+
+TEST(OvermapCacheTest, FlushKeepsOvermapsCached)
+{
+    MemoryStore store;
+    BlankLoader loader;
+    OvermapCache cache {store, 4, loader};
+
+    const auto om {cache.get(nullptr, 0, 1, 0)};
+    om->ter(2, 3) = oocdda::ot_forest;
+    cache.mark_dirty(0, 1, 0);
+    cache.flush();
+    cache.flush();
+
+    EXPECT_EQ(store.writes, 1);
+    EXPECT_TRUE(cache.contains(0, 1, 0));
+    EXPECT_EQ(cache.get(nullptr, 0, 1, 0), om);
+    EXPECT_EQ(*loader.loads, 1);
+
+    overmap decoded;
+    ASSERT_TRUE(oocdda::decode_overmap(*store.load({0, 1, 0}), decoded));
+    EXPECT_EQ(decoded.ter(2, 3), oocdda::ot_forest);
+}
@@ -0,0 +1,140 @@
+#include <memory>
+#include <sstream>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "mongroup.hpp"
+#include "omdata.hpp"
+#include "overmap.hpp"
+#include "overmap_io.hpp"
+
+using oocdda::decode_overmap;
+using oocdda::encode_overmap;
+using oocdda::overmap;
+
+namespace {
+void fill(overmap& om)
+{
+    for (int i {0}; i < OMAPX; ++i) {
+        for (int j {0}; j < OMAPY; ++j) {
+            om.ter(i, j) = j < OMAPY / 2 ? oocdda::ot_field : oocdda::ot_forest;
+            om.seen(i, j) = (i + j) % 3 == 0;
+        }
+    }
+
+    om.ter(7, 9) = oocdda::ot_house_north;
+    om.zg.emplace_back(oocdda::mcat_ant, 10, 20, 5, 1234);
+    om.cities.emplace_back(50, 60, 8);
+    om.roads_out.emplace_back(0, 90, 0);
+    om.radios.emplace_back(14, 18, 120, "Hello, anyone?");
+    om.add_note(3, 4, "Stash here");
+}
+} // namespace
+
+TEST(OvermapIoTest, StartsWithMagic)
+{
+    const auto om {std::make_unique<overmap>()};
+    fill(*om);
+
+    const auto data {encode_overmap(*om)};
+
+    ASSERT_GE(data.size(), oocdda::overmap_magic.size());
+    EXPECT_EQ(std::string_view(data.data(), oocdda::overmap_magic.size()),
+              std::string_view(oocdda::overmap_magic.data(), oocdda::overmap_magic.size()));
+}
+
+TEST(OvermapIoTest, RoundTrip)
+{
+    const auto original {std::make_unique<overmap>()};
+    fill(*original);
+
+    const auto data {encode_overmap(*original)};
+
+    // Two long terrain runs and a bitset take far less than one byte per square.
+    EXPECT_LT(data.size(), static_cast<std::size_t>(OMAPX * OMAPY / 4));
+
+    const auto loaded {std::make_unique<overmap>()};
+    loaded->zg.emplace_back(oocdda::mcat_forest, 0, 0, 1, 1);
+    ASSERT_TRUE(decode_overmap({data.data(), data.size()}, *loaded));
+
+    for (int i {0}; i < OMAPX; ++i) {
+        for (int j {0}; j < OMAPY; ++j) {
+            EXPECT_EQ(loaded->ter(i, j), original->ter(i, j));
+            EXPECT_EQ(loaded->seen(i, j), original->seen(i, j));
+        }
+    }
+
+    ASSERT_EQ(loaded->zg.size(), 1);
+    EXPECT_EQ(loaded->zg[0].type, oocdda::mcat_ant);
+    EXPECT_EQ(loaded->zg[0].radius, 5);
+    EXPECT_EQ(loaded->zg[0].population, 1234);
+    ASSERT_EQ(loaded->cities.size(), 1);
+    EXPECT_EQ(loaded->cities[0].s, 8);
+    ASSERT_EQ(loaded->roads_out.size(), 1);
+    EXPECT_EQ(loaded->roads_out[0].y, 90);
+    ASSERT_EQ(loaded->radios.size(), 1);
+    EXPECT_EQ(loaded->radios[0].message, "Hello, anyone?");
+    EXPECT_TRUE(loaded->has_note(3, 4));
+    EXPECT_EQ(loaded->note(3, 4), "Stash here");
+}
+
+TEST(OvermapIoTest, RejectsTruncatedData)
+{
+    const auto om {std::make_unique<overmap>()};
+    fill(*om);
+
+    const auto data {encode_overmap(*om)};
+
+    const auto loaded {std::make_unique<overmap>()};
+    EXPECT_FALSE(decode_overmap({data.data(), data.size() - 1}, *loaded));
+    EXPECT_FALSE(decode_overmap({data.data(), 16}, *loaded));
+}
+
+TEST(OvermapIoTest, ImportsLegacyTextFormat)
+{
+    std::ostringstream legacy;
+
+    for (int j {0}; j < OMAPY; ++j) {
+        for (int i {0}; i < OMAPX; ++i) {
+            legacy << static_cast<char>((i == 1 && j == 2 ? oocdda::ot_road_ns : oocdda::ot_field)
+                                        + 32);
+        }
+    }
+
+    for (int j {0}; j < OMAPY; ++j) {
+        for (int i {0}; i < OMAPX; ++i) {
+            legacy << (i == j ? '1' : '0');
+        }
+
+        legacy << '\n';
+    }
+
+    legacy << "Z " << oocdda::mcat_zombie << " 1 2 3 400\n";
+    legacy << "C 10 11 4\n";
+    legacy << "R 0 5\n";
+    legacy << "T 6 7 80 \nStatic...\n";
+    legacy << "N 8 9 0\nMy note\n";
+
+    const auto loaded {std::make_unique<overmap>()};
+    ASSERT_TRUE(decode_overmap(legacy.str(), *loaded));
+
+    EXPECT_EQ(loaded->ter(1, 2), oocdda::ot_road_ns);
+    EXPECT_EQ(loaded->ter(2, 1), oocdda::ot_field);
+    EXPECT_TRUE(loaded->seen(5, 5));
+    EXPECT_FALSE(loaded->seen(5, 6));
+    ASSERT_EQ(loaded->zg.size(), 1);
+    EXPECT_EQ(loaded->zg[0].population, 400);
+    ASSERT_EQ(loaded->cities.size(), 1);
+    EXPECT_EQ(loaded->cities[0].s, 4);
+    ASSERT_EQ(loaded->radios.size(), 1);
+    EXPECT_EQ(loaded->radios[0].message, "Static...");
+    EXPECT_EQ(loaded->note(8, 9), "My note");
+
+    // Re-encoding upgrades the overmap to the binary format losslessly.
+    const auto data {encode_overmap(*loaded)};
+    const auto upgraded {std::make_unique<overmap>()};
+    ASSERT_TRUE(decode_overmap({data.data(), data.size()}, *upgraded));
+    EXPECT_EQ(upgraded->ter(1, 2), oocdda::ot_road_ns);
+    EXPECT_EQ(upgraded->note(8, 9), "My note");
+}
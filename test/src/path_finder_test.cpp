@@ -0,0 +1,124 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "path_finder.hpp"
+#include "point.hpp"
+
+using oocdda::PathFinder;
+using oocdda::Point;
+
+namespace {
+/// '#' can't be entered, '+' costs 5 and anything else 1.
+struct Grid {
+    std::vector<std::string> rows;
+
+    [[nodiscard]] auto width() const -> int { return static_cast<int>(rows[0].size()); }
+    [[nodiscard]] auto height() const -> int { return static_cast<int>(rows.size()); }
+
+    auto operator()(const int x, const int y) const -> int
+    {
+        const char square {rows[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)]};
+        return square == '#' ? 0 : square == '+' ? 5 : 1;
+    }
+};
+
+auto total_cost(const Grid& grid, const std::vector<Point>& path) -> int
+{
+    int total {0};
+
+    for (const auto& step : path) {
+        total += grid(step.x, step.y);
+    }
+
+    return total;
+}
+
+void expect_connected(const Point from, const std::vector<Point>& path)
+{
+    Point last {from};
+
+    for (const auto& step : path) {
+        EXPECT_LE(std::abs(step.x - last.x), 1);
+        EXPECT_LE(std::abs(step.y - last.y), 1);
+        last = step;
+    }
+}
+} // namespace
+
+TEST(PathFinderTest, WalksStraightAcrossOpenGround)
+{
+    const Grid grid {{".......", ".......", "......."}};
+    PathFinder finder {grid.width(), grid.height()};
+    std::vector<Point> path;
+
+    ASSERT_TRUE(finder.find({0, 1}, {6, 1}, grid, 1000, path));
+    EXPECT_EQ(path.size(), 6U);
+    EXPECT_EQ(path.back(), (Point {6, 1}));
+    expect_connected({0, 1}, path);
+}
+
+TEST(PathFinderTest, GoesAroundWalls)
+{
+    const Grid grid {{".....", "####.", ".....", ".####", "....."}};
+    PathFinder finder {grid.width(), grid.height()};
+    std::vector<Point> path;
+
+    ASSERT_TRUE(finder.find({0, 0}, {0, 4}, grid, 1000, path));
+    expect_connected({0, 0}, path);
+
+    for (const auto& step : path) {
+        EXPECT_GT(grid(step.x, step.y), 0);
+    }
+
+    EXPECT_EQ(path.size(), 9U);
+    EXPECT_EQ(path.back(), (Point {0, 4}));
+}
+
+TEST(PathFinderTest, PrefersCheaperDetours)
+{
+    const Grid grid {{"...", ".#.", ".+.", ".#.", "..."}};
+    PathFinder finder {grid.width(), grid.height()};
+    std::vector<Point> path;
+
+    ASSERT_TRUE(finder.find({1, 0}, {1, 4}, grid, 1000, path));
+    EXPECT_EQ(total_cost(grid, path), 4);
+}
+
+TEST(PathFinderTest, FailsWhenWalledOffOrOutOfBudget)
+{
+    const Grid grid {{"..#..", "..#..", "..#.."}};
+    PathFinder finder {grid.width(), grid.height()};
+    std::vector<Point> path {{9, 9}};
+
+    EXPECT_FALSE(finder.find({0, 1}, {4, 1}, grid, 1000, path));
+    EXPECT_TRUE(path.empty());
+
+    const Grid open {{"..........", "..........", ".........."}};
+    PathFinder bounded {open.width(), open.height()};
+    EXPECT_FALSE(bounded.find({0, 1}, {9, 1}, open, 3, path));
+    EXPECT_TRUE(bounded.find({0, 1}, {9, 1}, open, 1000, path));
+}
+
+TEST(PathFinderTest, ReusesBuffersBetweenSearches)
+{
+    Grid grid {{".....", ".....", "....."}};
+    PathFinder finder {grid.width(), grid.height()};
+    std::vector<Point> path;
+
+    ASSERT_TRUE(finder.find({0, 0}, {4, 2}, grid, 1000, path));
+    EXPECT_EQ(path.size(), 4U);
+
+    grid.rows[1] = "####.";
+    ASSERT_TRUE(finder.find({0, 0}, {4, 2}, grid, 1000, path));
+    EXPECT_EQ(path.size(), 5U);
+    expect_connected({0, 0}, path);
+
+    for (const auto& step : path) {
+        EXPECT_GT(grid(step.x, step.y), 0);
+    }
+
+    EXPECT_FALSE(finder.find({0, 0}, {0, 0}, grid, 1000, path));
+}
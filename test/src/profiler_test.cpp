@@ -0,0 +1,113 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "profiler.hpp"
+
+using oocdda::DurationHistogram;
+using oocdda::Phase;
+using oocdda::Profiler;
+
+TEST(ProfilerTest, BucketsHoldWhatTheySay)
+{
+    for (std::uint64_t ns {0}; ns < 100000; ns += 7) {
+        const auto bucket {DurationHistogram::bucket_for(ns)};
+        EXPECT_LE(DurationHistogram::lower_bound(bucket), ns);
+        EXPECT_GT(DurationHistogram::lower_bound(bucket + 1), ns);
+    }
+
+    EXPECT_EQ(DurationHistogram::bucket_for(5), 5U);
+    EXPECT_EQ(DurationHistogram::bucket_for(std::uint64_t {1} << 50),
+              DurationHistogram::num_buckets - 1);
+}
+
+TEST(ProfilerTest, BucketsAreWithinAnEighth)
+{
+    for (std::size_t b {8}; b + 1 < DurationHistogram::num_buckets; ++b) {
+        const auto low {DurationHistogram::lower_bound(b)};
+        const auto high {DurationHistogram::lower_bound(b + 1)};
+        EXPECT_LT(low, high);
+        EXPECT_LE((high - low) * 8, low);
+    }
+}
+
+TEST(ProfilerTest, Percentiles)
+{
+    DurationHistogram histogram;
+    EXPECT_EQ(histogram.percentile(0.5), 0U);
+
+    for (int i {0}; i < 99; ++i) {
+        histogram.add(1000);
+    }
+
+    histogram.add(1000000);
+
+    const auto p50 {histogram.percentile(0.5)};
+    EXPECT_GT(p50, 1000U);
+    EXPECT_LE(p50, 1125U);
+    EXPECT_LE(histogram.percentile(0.99), 1125U);
+    EXPECT_GT(histogram.percentile(1.0), 1000000U);
+}
+
+TEST(ProfilerTest, TotalsAndRollingWindow)
+{
+    Profiler profiler {4};
+
+    for (int i {0}; i < 10; ++i) {
+        profiler.record(Phase::monsters, i < 5 ? 100000 : 10);
+    }
+
+    const auto& totals {profiler.totals(Phase::monsters)};
+    EXPECT_EQ(totals.calls, 10U);
+    EXPECT_EQ(totals.nanoseconds, 5U * 100000 + 5U * 10);
+    EXPECT_EQ(totals.longest, 100000U);
+
+    // Only the last window to two windows are kept: here the last six.
+    const auto recent {profiler.recent(Phase::monsters)};
+    EXPECT_EQ(recent.count(), 6U);
+    EXPECT_LE(recent.percentile(0.5), 11U);
+
+    EXPECT_EQ(profiler.totals(Phase::scent).calls, 0U);
+
+    profiler.clear();
+    EXPECT_EQ(profiler.totals(Phase::monsters).calls, 0U);
+    EXPECT_EQ(profiler.recent(Phase::monsters).count(), 0U);
+}
+
+TEST(ProfilerTest, WritesEveryPhase)
+{
+    Profiler profiler;
+    profiler.record(Phase::mapgen, 5000);
+
+    std::ostringstream out;
+    profiler.write(out);
+    const std::string text {out.str()};
+
+    for (int i {0}; i < static_cast<int>(Phase::count); ++i) {
+        EXPECT_NE(text.find(oocdda::phase_name(static_cast<Phase>(i))), std::string::npos);
+    }
+
+    EXPECT_NE(text.find("4608 5120 1"), std::string::npos);
+}
+
+TEST(ProfilerTest, TableRowsAreWhatWriteWrites)
+{
+    Profiler profiler {16};
+    profiler.record(Phase::scent, 2500);
+    EXPECT_EQ(profiler.window(), 16U);
+
+    std::ostringstream out;
+    profiler.write(out);
+    std::istringstream lines {out.str()};
+    std::string line;
+
+    std::getline(lines, line);
+    EXPECT_EQ(line, Profiler::table_header());
+
+    for (int i {0}; i < static_cast<int>(Phase::count); ++i) {
+        std::getline(lines, line);
+        EXPECT_EQ(line, profiler.table_row(static_cast<Phase>(i)));
+    }
+}
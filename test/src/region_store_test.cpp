@@ -0,0 +1,175 @@
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "region_store.hpp"
+
+using oocdda::RegionStore;
+
+class RegionStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "oocdda_region_store_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(RegionStoreTest, MissingRecord)
+{
+    RegionStore store {directory, "m", 4};
+
+    EXPECT_FALSE(store.contains({1, 2, 0}));
+    EXPECT_FALSE(store.load({1, 2, 0}).has_value());
+}
+
+TEST_F(RegionStoreTest, StoreAfterMiss)
+{
+    RegionStore store {directory, "m", 4};
+
+    EXPECT_FALSE(store.contains({1, 2, 0}));
+    store.store({1, 2, 0}, "found");
+    EXPECT_EQ(store.load({1, 2, 0}).value(), "found");
+}
+
+TEST_F(RegionStoreTest, StoreAndLoad)
+{
+    RegionStore store {directory, "m", 4};
+
+    store.store({1, 2, 0}, "hello");
+    store.store({-1, -7, 0}, "negative");
+    store.store({1, 2, -1}, "below");
+
+    EXPECT_EQ(store.load({1, 2, 0}).value(), "hello");
+    EXPECT_EQ(store.load({-1, -7, 0}).value(), "negative");
+    EXPECT_EQ(store.load({1, 2, -1}).value(), "below");
+    EXPECT_FALSE(store.contains({2, 1, 0}));
+}
+
+TEST_F(RegionStoreTest, PacksRecordsIntoRegionFiles)
+{
+    RegionStore store {directory, "m", 4};
+
+    for (int x {0}; x < 4; ++x) {
+        for (int y {0}; y < 4; ++y) {
+            store.store({x, y, 0}, std::to_string(x * 10 + y));
+        }
+    }
+
+    store.store({4, 0, 0}, "next region");
+
+    int num_files {0};
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator {directory}) {
+        ++num_files;
+    }
+
+    EXPECT_EQ(num_files, 2);
+    EXPECT_EQ(store.load({3, 2, 0}).value(), "32");
+}
+
+TEST_F(RegionStoreTest, GrowingRecordMovesSlot)
+{
+    RegionStore store {directory, "m", 4};
+    const std::string big(5000, 'x');
+
+    store.store({0, 0, 0}, "small");
+    store.store({1, 0, 0}, "neighbour");
+    store.store({0, 0, 0}, big);
+    store.store({0, 0, 0}, "shrunk");
+
+    EXPECT_EQ(store.load({0, 0, 0}).value(), "shrunk");
+    EXPECT_EQ(store.load({1, 0, 0}).value(), "neighbour");
+}
+
+TEST_F(RegionStoreTest, PersistsAcrossInstances)
+{
+    {
+        RegionStore store {directory, "o", 4};
+        store.store({5, 6, 0}, "persisted");
+    }
+
+    RegionStore store {directory, "o", 4};
+    EXPECT_EQ(store.load({5, 6, 0}).value(), "persisted");
+}
+
+TEST_F(RegionStoreTest, CloseLetsGoOfRegionFiles)
+{
+    RegionStore store {directory, "m", 4};
+    store.store({1, 1, 0}, "old world");
+    store.close();
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    EXPECT_FALSE(store.contains({1, 1, 0}));
+    store.store({1, 1, 0}, "new world");
+    EXPECT_EQ(store.load({1, 1, 0}).value(), "new world");
+}
+
+TEST_F(RegionStoreTest, ImportsLegacyFilesOnOpen)
+{
+    for (const auto* const name : {"m.3.4.0", "m.-1.-2.1", "m.1.2", "o.0.0.0"}) {
+        std::ofstream legacy {directory / name};
+        legacy << "legacy " << name;
+    }
+
+    RegionStore store {directory, "m", 4};
+
+    EXPECT_EQ(store.load({3, 4, 0}).value(), "legacy m.3.4.0");
+    EXPECT_EQ(store.load({-1, -2, 1}).value(), "legacy m.-1.-2.1");
+    EXPECT_FALSE(std::filesystem::exists(directory / "m.3.4.0"));
+    EXPECT_FALSE(std::filesystem::exists(directory / "m.-1.-2.1"));
+    // Not a record name, or another store's.
+    EXPECT_TRUE(std::filesystem::exists(directory / "m.1.2"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "o.0.0.0"));
+}
+
+TEST_F(RegionStoreTest, ImportsLegacyFilesAgainAfterClose)
+{
+    RegionStore store {directory, "m", 4};
+    EXPECT_FALSE(store.contains({0, 0, 0}));
+
+    {
+        std::ofstream legacy {directory / "m.0.0.0"};
+        legacy << "legacy data";
+    }
+
+    EXPECT_FALSE(store.contains({0, 0, 0}));
+    store.close();
+    EXPECT_EQ(store.load({0, 0, 0}).value(), "legacy data");
+}
+
+TEST_F(RegionStoreTest, KeepsStoredRecordOverLegacyFile)
+{
+    {
+        RegionStore store {directory, "m", 4};
+        store.store({0, 0, 0}, "current");
+    }
+
+    {
+        std::ofstream legacy {directory / "m.0.0.0"};
+        legacy << "stale";
+    }
+
+    RegionStore store {directory, "m", 4};
+    EXPECT_EQ(store.load({0, 0, 0}).value(), "current");
+}
+
+TEST_F(RegionStoreTest, RejectsForeignFile)
+{
+    {
+        std::ofstream foreign {directory / "m.0.0.0.region"};
+        foreign << "definitely not a region file, but long enough to have a header";
+    }
+
+    RegionStore store {directory, "m", 4};
+    EXPECT_THROW([[maybe_unused]] const auto data {store.load({0, 0, 0})}, std::runtime_error);
+}
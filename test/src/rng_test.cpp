@@ -0,0 +1,125 @@
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rng.hpp"
+
+using oocdda::Rng;
+using oocdda::RngScope;
+using oocdda::RngStream;
+
+TEST(RngTest, SameSeedSameDraws)
+{
+    Rng a {42};
+    Rng b {42};
+    Rng c {43};
+    bool differs {false};
+
+    for (int i {0}; i < 100; ++i) {
+        const auto next {a()};
+        EXPECT_EQ(next, b());
+        differs = differs || next != c();
+    }
+
+    EXPECT_TRUE(differs);
+}
+
+TEST(RngTest, RangeCoversBothEndsEvenly)
+{
+    Rng rng {7};
+    std::array<int, 6> counts {};
+
+    for (int i {0}; i < 60000; ++i) {
+        const long roll {rng.range(-2, 3)};
+        ASSERT_GE(roll, -2);
+        ASSERT_LE(roll, 3);
+        ++counts[static_cast<std::size_t>(roll + 2)];
+    }
+
+    for (const int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+}
+
+TEST(RngTest, ReversedBoundsMatchTheOldFormula)
+{
+    Rng rng {7};
+
+    for (int i {0}; i < 1000; ++i) {
+        EXPECT_EQ(rng.range(5, 4), 5);
+        EXPECT_EQ(rng.range(5, 3), 5);
+
+        const long roll {rng.range(5, 1)};
+        EXPECT_GE(roll, 3);
+        EXPECT_LE(roll, 5);
+    }
+}
+
+TEST(RngTest, OneInAndDice)
+{
+    Rng rng {9};
+    int hits {0};
+
+    for (int i {0}; i < 40000; ++i) {
+        EXPECT_TRUE(rng.one_in(1));
+        EXPECT_TRUE(rng.one_in(0));
+        hits += rng.one_in(4) ? 1 : 0;
+
+        const int roll {rng.dice(3, 6)};
+        ASSERT_GE(roll, 3);
+        ASSERT_LE(roll, 18);
+    }
+
+    EXPECT_NEAR(hits, 10000, 500);
+    EXPECT_EQ(rng.dice(0, 6), 0);
+}
+
+TEST(RngTest, FillDrawsTheSameAsRange)
+{
+    Rng a {11};
+    Rng b {11};
+    std::vector<int> filled(500);
+    a.fill(0, 9, filled);
+
+    for (const int value : filled) {
+        EXPECT_EQ(value, b.range(0, 9));
+    }
+}
+
+TEST(RngTest, RealStaysInRange)
+{
+    Rng rng {13};
+
+    for (int i {0}; i < 10000; ++i) {
+        const double value {rng.real(0, .5)};
+        ASSERT_GE(value, 0);
+        ASSERT_LT(value, .5);
+    }
+}
+
+TEST(RngTest, StreamsAreIndependentAndReproducible)
+{
+    oocdda::seed_rng(1234);
+    std::vector<long> first;
+
+    {
+        const RngScope scope {RngStream::mapgen};
+
+        for (int i {0}; i < 20; ++i) {
+            first.push_back(oocdda::rng(0, 1000000));
+        }
+    }
+
+    oocdda::seed_rng(1234);
+    // Draws elsewhere don't disturb the mapgen sequence.
+    for (int i {0}; i < 50; ++i) {
+        static_cast<void>(oocdda::rng(0, 10));
+    }
+
+    const RngScope scope {RngStream::mapgen};
+
+    for (const long expected : first) {
+        EXPECT_EQ(oocdda::rng(0, 1000000), expected);
+    }
+}
@@ -0,0 +1,171 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "scent_map.hpp"
+
+using oocdda::ScentMap;
+
+namespace {
+/// The stencil Game::update_scent ran before the kernel, kept as the reference to match.
+struct Reference {
+    int width;
+    int height;
+    std::vector<int> scent;
+    std::vector<bool> spreads;
+    std::vector<int> floors;
+
+    [[nodiscard]] auto at(const int x, const int y) const -> int
+    {
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return 0;
+        }
+
+        return scent[static_cast<std::size_t>(y * width + x)];
+    }
+
+    auto diffuse() -> int
+    {
+        std::vector<int> next(scent.size());
+        int reset {0};
+
+        for (int x {0}; x < width; ++x) {
+            for (int y {0}; y < height; ++y) {
+                const auto n {static_cast<std::size_t>(y * width + x)};
+                int sum {0};
+                int used {0};
+
+                for (int i {-1}; i <= 1; ++i) {
+                    for (int j {-1}; j <= 1; ++j) {
+                        if (spreads[n] && at(x, y) <= at(x + i, y + j)) {
+                            sum += at(x + i, y + j);
+                            ++used;
+                        }
+                    }
+                }
+
+                sum /= used + 1;
+
+                if (floors[n] != ScentMap::no_floor && sum < floors[n]) {
+                    sum = floors[n];
+                }
+
+                if (sum > ScentMap::max_scent) {
+                    sum = 0;
+                    ++reset;
+                }
+
+                next[n] = sum;
+            }
+        }
+
+        scent = next;
+        return reset;
+    }
+};
+
+void randomize(ScentMap& map, Reference& reference, std::mt19937& rng, const int max_scent)
+{
+    std::uniform_int_distribution<int> scent {0, max_scent};
+    std::uniform_int_distribution<int> percent {0, 99};
+
+    for (int y {0}; y < reference.height; ++y) {
+        for (int x {0}; x < reference.width; ++x) {
+            const auto n {static_cast<std::size_t>(y * reference.width + x)};
+            const bool spreads {percent(rng) >= 20};
+            const int floor {percent(rng) < 5 ? 10 * (1 + percent(rng) % 3) : ScentMap::no_floor};
+
+            reference.scent[n] = percent(rng) < 30 ? scent(rng) : 0;
+            reference.spreads[n] = spreads;
+            reference.floors[n] = floor;
+            map.at(x, y) = reference.scent[n];
+            map.set_square(x, y, spreads, floor);
+        }
+    }
+}
+
+void expect_same(const ScentMap& map, const Reference& reference)
+{
+    for (int y {0}; y < reference.height; ++y) {
+        for (int x {0}; x < reference.width; ++x) {
+            ASSERT_EQ(map.at(x, y), reference.at(x, y)) << x << ", " << y;
+        }
+    }
+}
+} // namespace
+
+TEST(ScentMapTest, MatchesReferenceStencil)
+{
+    constexpr int width {36};
+    constexpr int height {36};
+    std::mt19937 rng {1234};
+
+    for (int round {0}; round < 20; ++round) {
+        ScentMap map {width, height};
+        Reference reference {width,
+                             height,
+                             std::vector<int>(width * height),
+                             std::vector<bool>(width * height),
+                             std::vector<int>(width * height)};
+        randomize(map, reference, rng, 600);
+
+        for (int step {0}; step < 10; ++step) {
+            EXPECT_EQ(map.diffuse(), reference.diffuse());
+            expect_same(map, reference);
+        }
+    }
+}
+
+TEST(ScentMapTest, ResetsScentAboveMaximum)
+{
+    constexpr int width {7};
+    constexpr int height {5};
+    std::mt19937 rng {99};
+
+    ScentMap map {width, height};
+    Reference reference {width,
+                         height,
+                         std::vector<int>(width * height),
+                         std::vector<bool>(width * height),
+                         std::vector<int>(width * height)};
+    randomize(map, reference, rng, 3 * ScentMap::max_scent);
+
+    const int reset {map.diffuse()};
+    EXPECT_EQ(reset, reference.diffuse());
+    EXPECT_GT(reset, 0);
+    expect_same(map, reference);
+}
+
+TEST(ScentMapTest, BlockedSquaresKeepOnlyTheirFloor)
+{
+    ScentMap map {3, 3};
+
+    for (int y {0}; y < 3; ++y) {
+        for (int x {0}; x < 3; ++x) {
+            map.at(x, y) = 90;
+            map.set_square(x, y, true, ScentMap::no_floor);
+        }
+    }
+
+    map.set_square(0, 0, false, ScentMap::no_floor);
+    map.set_square(2, 2, false, 30);
+    map.diffuse();
+
+    EXPECT_EQ(map.at(0, 0), 0);
+    EXPECT_EQ(map.at(2, 2), 30);
+    EXPECT_EQ(map.at(1, 1), 90 * 9 / 10);
+}
+
+TEST(ScentMapTest, ShiftMovesScentAndClearsUncoveredSquares)
+{
+    ScentMap map {4, 4};
+    map.at(2, 3) = 50;
+    map.at(0, 0) = 70;
+
+    map.shift(2, 1);
+
+    EXPECT_EQ(map.at(0, 2), 50);
+    EXPECT_EQ(map.at(0, 0), 0);
+    EXPECT_EQ(map.at(3, 3), 0);
+}
@@ -0,0 +1,69 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "slot_map.hpp"
+
+using oocdda::SlotHandle;
+using oocdda::SlotMap;
+
+TEST(SlotMapTest, HandlesFindWhatWasPushed)
+{
+    SlotMap<int> map;
+    const SlotHandle a {map.push_back(10)};
+    const SlotHandle b {map.push_back(20)};
+
+    ASSERT_EQ(map.size(), 2U);
+    EXPECT_EQ(map.index_of(a), 0);
+    EXPECT_EQ(map.index_of(b), 1);
+    EXPECT_EQ(*map.get(b), 20);
+    EXPECT_EQ(map.handle(1), b);
+}
+
+TEST(SlotMapTest, EraseMovesTheLastElementIntoTheGap)
+{
+    SlotMap<int> map;
+    const SlotHandle a {map.push_back(10)};
+    map.push_back(20);
+    const SlotHandle c {map.push_back(30)};
+
+    map.erase(0);
+
+    EXPECT_EQ(std::vector<int>(map.begin(), map.end()), (std::vector<int> {30, 20}));
+    EXPECT_EQ(map.index_of(c), 0);
+    EXPECT_EQ(map.index_of(a), -1);
+    EXPECT_EQ(map.get(a), nullptr);
+}
+
+TEST(SlotMapTest, ReusedSlotsDoNotAnswerOldHandles)
+{
+    SlotMap<int> map;
+    const SlotHandle old {map.push_back(10)};
+    map.erase(0);
+    const SlotHandle fresh {map.push_back(20)};
+
+    EXPECT_EQ(fresh.slot, old.slot);
+    EXPECT_EQ(map.get(old), nullptr);
+    EXPECT_EQ(*map.get(fresh), 20);
+}
+
+TEST(SlotMapTest, ClearForgetsEveryHandle)
+{
+    SlotMap<int> map;
+    const SlotHandle a {map.push_back(10)};
+    const SlotHandle b {map.push_back(20)};
+
+    map.clear();
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.index_of(a), -1);
+    EXPECT_EQ(map.index_of(b), -1);
+}
+
+TEST(SlotMapTest, DefaultHandleNamesNothing)
+{
+    SlotMap<int> map;
+    map.push_back(10);
+
+    EXPECT_EQ(map.index_of(SlotHandle {}), -1);
+}
@@ -0,0 +1,92 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "mapdata.hpp"
+#include "memory_store.hpp"
+#include "submap_cache.hpp"
+
+using oocdda::submap;
+using oocdda::SubmapCache;
+
+namespace {
+[[nodiscard]] auto make_submap(const int radiation) -> std::unique_ptr<submap>
+{
+    auto sm {std::make_unique<submap>()};
+    sm->rad[0][0] = radiation;
+    return sm;
+}
+} // namespace
+
+TEST(SubmapCacheTest, TakeReturnsWhatWasPut)
+{
+    MemoryStore store;
+    SubmapCache cache {store, 4};
+
+    cache.put({1, 2, 0}, make_submap(7), 42);
+
+    const auto entry {cache.take({1, 2, 0})};
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->data->rad[0][0], 7);
+    EXPECT_EQ(entry->turn, 42);
+    EXPECT_FALSE(cache.contains({1, 2, 0}));
+    EXPECT_FALSE(cache.take({1, 2, 0}).has_value());
+    EXPECT_EQ(store.writes, 0);
+}
+
+TEST(SubmapCacheTest, EvictsLeastRecentlyUsed)
+{
+    MemoryStore store;
+    SubmapCache cache {store, 2};
+
+    cache.put({0, 0, 0}, make_submap(0), 0);
+    cache.put({1, 0, 0}, make_submap(1), 0);
+    cache.put({2, 0, 0}, make_submap(2), 0);
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(cache.contains({0, 0, 0}));
+    EXPECT_TRUE(store.contains({0, 0, 0}));
+    EXPECT_TRUE(cache.contains({1, 0, 0}));
+    EXPECT_TRUE(cache.contains({2, 0, 0}));
+}
+
+TEST(SubmapCacheTest, FlushWritesEachDirtySubmapOnce)
+{
+    MemoryStore store;
+    SubmapCache cache {store, 4};
+
+    cache.put({0, 0, 0}, make_submap(0), 0);
+    cache.put({0, 1, 0}, make_submap(1), 0);
+    cache.flush();
+    cache.flush();
+
+    EXPECT_EQ(store.writes, 2);
+    EXPECT_TRUE(cache.contains({0, 0, 0}));
+    EXPECT_TRUE(store.contains({0, 1, 0}));
+}
+
+TEST(SubmapCacheTest, ClearWritesAndDropsEverything)
+{
+    MemoryStore store;
+    SubmapCache cache {store, 4};
+
+    cache.put({0, 0, 0}, make_submap(0), 0);
+    cache.put({0, 1, 0}, make_submap(1), 0);
+    cache.clear();
+
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(store.writes, 2);
+    EXPECT_TRUE(store.contains({0, 1, 0}));
+}
+
+TEST(SubmapCacheTest, FlushesOnDestruction)
+{
+    MemoryStore store;
+
+    {
+        SubmapCache cache {store, 4};
+        cache.put({3, 3, -1}, make_submap(3), 0);
+    }
+
+    EXPECT_TRUE(store.contains({3, 3, -1}));
+}
@@ -0,0 +1,199 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "item.hpp"
+#include "itype.hpp"
+#include "mapdata.hpp"
+#include "monster_type.hpp"
+#include "submap_io.hpp"
+#include "trap.hpp"
+
+using oocdda::decode_submap;
+using oocdda::encode_submap;
+using oocdda::field;
+using oocdda::Item;
+using oocdda::itype;
+using oocdda::MonsterType;
+using oocdda::submap;
+
+class SubmapIoTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (unsigned int id {0}; id <= oocdda::itm_water; ++id) {
+            owned_itypes.push_back(std::make_unique<itype>());
+            owned_itypes.back()->id = id;
+            itypes.push_back(owned_itypes.back().get());
+        }
+
+        owned_mtypes.push_back(std::make_unique<MonsterType>());
+        owned_mtypes.push_back(std::make_unique<MonsterType>());
+        owned_mtypes.back()->id = oocdda::mon_squirrel;
+
+        for (const auto& mtype : owned_mtypes) {
+            mtypes.push_back(mtype.get());
+        }
+    }
+
+    void fill(submap& sm) const
+    {
+        for (int i {0}; i < SEEX; ++i) {
+            for (int j {0}; j < SEEY; ++j) {
+                sm.ter[i][j] = static_cast<oocdda::ter_id>((i + j) % oocdda::num_terrain_types);
+                sm.trp[i][j] = oocdda::tr_null;
+                sm.fld[i][j] = field();
+                sm.rad[i][j] = i * j;
+            }
+        }
+
+        sm.trp[3][4] = oocdda::tr_beartrap;
+        sm.fld[5][6] = field(oocdda::fd_fire, 2, 17);
+
+        Item bottle {itypes[oocdda::itm_water], 12};
+        bottle.name = "my bottle";
+        bottle.owned = true;
+        bottle.put_in(Item {itypes[oocdda::itm_water], 13});
+        sm.itm[1][2].push_back(bottle);
+
+        Item corpse;
+        corpse.make_corpse(itypes[oocdda::itm_corpse], mtypes[1], 99);
+        sm.itm[SEEX - 1][SEEY - 1].push_back(corpse);
+
+        sm.spawns.emplace_back(oocdda::mon_zombie, 3, 7, 8);
+    }
+
+    std::vector<itype*> itypes;
+    std::vector<MonsterType*> mtypes;
+
+private:
+    std::vector<std::unique_ptr<itype>> owned_itypes;
+    std::vector<std::unique_ptr<MonsterType>> owned_mtypes;
+};
+
+TEST_F(SubmapIoTest, StartsWithMagic)
+{
+    submap sm;
+    fill(sm);
+
+    const auto data {encode_submap(sm, 0)};
+
+    ASSERT_GE(data.size(), oocdda::submap_magic.size());
+    EXPECT_EQ(std::string_view(data.data(), oocdda::submap_magic.size()),
+              std::string_view(oocdda::submap_magic.data(), oocdda::submap_magic.size()));
+}
+
+TEST_F(SubmapIoTest, RoundTrip)
+{
+    submap original;
+    fill(original);
+
+    const auto data {encode_submap(original, 1234)};
+
+    submap loaded;
+    unsigned int turn {0};
+    ASSERT_TRUE(decode_submap({data.data(), data.size()}, itypes, mtypes, loaded, turn));
+
+    EXPECT_EQ(turn, 1234);
+
+    for (int i {0}; i < SEEX; ++i) {
+        for (int j {0}; j < SEEY; ++j) {
+            EXPECT_EQ(loaded.ter[i][j], original.ter[i][j]);
+            EXPECT_EQ(loaded.trp[i][j], original.trp[i][j]);
+            EXPECT_EQ(loaded.fld[i][j].type, original.fld[i][j].type);
+            EXPECT_EQ(loaded.fld[i][j].density, original.fld[i][j].density);
+            EXPECT_EQ(loaded.fld[i][j].age, original.fld[i][j].age);
+            EXPECT_EQ(loaded.rad[i][j], original.rad[i][j]);
+            EXPECT_EQ(loaded.itm[i][j].size(), original.itm[i][j].size());
+        }
+    }
+
+    const auto& bottle {loaded.itm[1][2].at(0)};
+    EXPECT_EQ(bottle.type, itypes[oocdda::itm_water]);
+    EXPECT_EQ(bottle.name, "my bottle");
+    EXPECT_EQ(bottle.bday, 12);
+    EXPECT_TRUE(bottle.owned);
+    EXPECT_FALSE(bottle.active);
+    ASSERT_EQ(bottle.contents.size(), 1);
+    EXPECT_EQ(bottle.contents[0].bday, 13);
+
+    const auto& corpse {loaded.itm[SEEX - 1][SEEY - 1].at(0)};
+    EXPECT_EQ(corpse.type, itypes[oocdda::itm_corpse]);
+    EXPECT_EQ(corpse.corpse, mtypes[1]);
+
+    ASSERT_EQ(loaded.spawns.size(), 1);
+    EXPECT_EQ(loaded.spawns[0].type, oocdda::mon_zombie);
+    EXPECT_EQ(loaded.spawns[0].count, 3);
+    EXPECT_EQ(loaded.spawns[0].posx, 7);
+    EXPECT_EQ(loaded.spawns[0].posy, 8);
+}
+
+TEST_F(SubmapIoTest, RejectsTruncatedData)
+{
+    submap sm;
+    fill(sm);
+
+    const auto data {encode_submap(sm, 0)};
+
+    submap loaded;
+    unsigned int turn {0};
+    EXPECT_FALSE(decode_submap({data.data(), data.size() - 1}, itypes, mtypes, loaded, turn));
+    EXPECT_FALSE(decode_submap({data.data(), 16}, itypes, mtypes, loaded, turn));
+}
+
+TEST_F(SubmapIoTest, ImportsLegacyTextFormat)
+{
+    std::ostringstream legacy;
+    legacy << 500 << '\n';
+
+    for (int j {0}; j < SEEY; ++j) {
+        for (int i {0}; i < SEEX; ++i) {
+            legacy << static_cast<char>(oocdda::t_grass + 42);
+        }
+
+        legacy << '\n';
+    }
+
+    for (int j {0}; j < SEEY; ++j) {
+        for (int i {0}; i < SEEX; ++i) {
+            legacy << (i == 2 && j == 3 ? 40 : 0) << ' ';
+        }
+    }
+
+    legacy << '\n';
+    legacy << "I 4 5\n" << Item {itypes[oocdda::itm_water], 7}.save_info() << '\n';
+    legacy << "C \n" << Item {itypes[oocdda::itm_water], 8}.save_info() << '\n';
+    legacy << "T 1 1 " << oocdda::tr_snare << '\n';
+    legacy << "F 6 6 " << oocdda::fd_smoke << " 3 25\n";
+    legacy << "S " << oocdda::mon_dog << " 2 9 10\n";
+
+    submap loaded;
+    unsigned int turn {0};
+    ASSERT_TRUE(decode_submap(legacy.str(), itypes, mtypes, loaded, turn));
+
+    EXPECT_EQ(turn, 500);
+    EXPECT_EQ(loaded.ter[0][0], oocdda::t_grass);
+    EXPECT_EQ(loaded.rad[2][3], 40);
+    EXPECT_EQ(loaded.rad[3][2], 0);
+    ASSERT_EQ(loaded.itm[4][5].size(), 1);
+    EXPECT_EQ(loaded.itm[4][5][0].bday, 7);
+    ASSERT_EQ(loaded.itm[4][5][0].contents.size(), 1);
+    EXPECT_EQ(loaded.itm[4][5][0].contents[0].bday, 8);
+    EXPECT_EQ(loaded.trp[1][1], oocdda::tr_snare);
+    EXPECT_EQ(loaded.fld[6][6].type, oocdda::fd_smoke);
+    EXPECT_EQ(loaded.fld[6][6].density, 3);
+    EXPECT_EQ(loaded.fld[6][6].age, 25);
+    ASSERT_EQ(loaded.spawns.size(), 1);
+    EXPECT_EQ(loaded.spawns[0].type, oocdda::mon_dog);
+
+    // Re-encoding the imported submap upgrades it to the binary format losslessly.
+    const auto data {encode_submap(loaded, turn)};
+    submap upgraded;
+    ASSERT_TRUE(decode_submap({data.data(), data.size()}, itypes, mtypes, upgraded, turn));
+    EXPECT_EQ(upgraded.itm[4][5][0].contents[0].bday, 8);
+    EXPECT_EQ(upgraded.fld[6][6].age, 25);
+}
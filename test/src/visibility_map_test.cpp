@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "visibility_map.hpp"
+
+using oocdda::VisibilityMap;
+
+namespace {
+/// Squares of a 20x20 test window that block sight.
+class Walls {
+public:
+    void add(const int x, const int y) { walls_.emplace(x, y); }
+
+    [[nodiscard]] auto operator()(const int x, const int y) const -> bool
+    {
+        return !walls_.contains({x, y});
+    }
+
+private:
+    std::set<std::pair<int, int>> walls_;
+};
+} // namespace
+
+TEST(VisibilityMapTest, OpenGroundIsVisibleWithinRange)
+{
+    VisibilityMap fov {20, 20};
+    fov.compute(10, 10, 3, Walls {});
+
+    for (int x {0}; x < 20; ++x) {
+        for (int y {0}; y < 20; ++y) {
+            const bool in_range {std::abs(x - 10) <= 3 && std::abs(y - 10) <= 3};
+            EXPECT_EQ(fov.visible(x, y), in_range) << x << ", " << y;
+        }
+    }
+}
+
+TEST(VisibilityMapTest, WallsHideWhatIsBehindThem)
+{
+    Walls walls;
+
+    for (int y {0}; y < 20; ++y) {
+        walls.add(12, y);
+    }
+
+    VisibilityMap fov {20, 20};
+    fov.compute(10, 10, 20, walls);
+
+    EXPECT_TRUE(fov.visible(11, 10));
+    EXPECT_TRUE(fov.visible(12, 10));
+    EXPECT_TRUE(fov.visible(12, 3));
+    EXPECT_FALSE(fov.visible(13, 10));
+    EXPECT_FALSE(fov.visible(19, 0));
+    EXPECT_TRUE(fov.visible(0, 0));
+}
+
+TEST(VisibilityMapTest, SeesPastPillarAtAnAngle)
+{
+    Walls walls;
+    walls.add(11, 10);
+
+    VisibilityMap fov {20, 20};
+    fov.compute(10, 10, 20, walls);
+
+    EXPECT_TRUE(fov.visible(11, 10));
+    EXPECT_FALSE(fov.visible(12, 10));
+    EXPECT_FALSE(fov.visible(15, 10));
+    EXPECT_TRUE(fov.visible(12, 12));
+    EXPECT_TRUE(fov.visible(12, 8));
+}
+
+TEST(VisibilityMapTest, OutsideWindowIsNotVisible)
+{
+    VisibilityMap fov {20, 20};
+    fov.compute(0, 0, 5, Walls {});
+
+    EXPECT_TRUE(fov.visible(0, 0));
+    EXPECT_TRUE(fov.visible(5, 5));
+    EXPECT_FALSE(fov.visible(-1, 0));
+    EXPECT_FALSE(fov.visible(0, 20));
+    EXPECT_EQ(fov.originx(), 0);
+    EXPECT_EQ(fov.range(), 5);
+}